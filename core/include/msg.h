@@ -147,6 +147,15 @@
  * }
  * ~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * With the `core_msg_lockfree` module a thread can initialize its queue with
+ * @ref msg_init_queue_lockfree() instead. Threads and ISRs then put messages
+ * into that queue without disabling interrupts, so many senders to one
+ * receiver do not add to the interrupt latency of the system. Interrupts are
+ * only disabled briefly to wake up the receiver, or when the queue is full.
+ * A sender preempted while putting its message into the queue does not delay
+ * the messages put in after it, the receiver gets those first. Messages of
+ * one sender are still received in the order they were sent.
+ *
  * Timing & messages
  * =================
  * Timing out the reception of a message or sending messages at a certain time
@@ -374,6 +383,50 @@ int msg_avail(void);
  */
 void msg_init_queue(msg_t *array, int num);
 
+#if defined(MODULE_CORE_MSG_LOCKFREE) || defined(DOXYGEN)
+/**
+ * @brief   Initialize the current thread's message queue as lock-free queue
+ *
+ * Same as @ref msg_init_queue(), but senders put messages into the queue
+ * without disabling interrupts. Only the thread itself may receive from it.
+ *
+ * @note    Only available with module `core_msg_lockfree`.
+ *
+ * @pre @p num **MUST BE A POWER OF TWO!**
+ *
+ * @param[in] array Pointer to preallocated array of ``msg_t`` structures, must
+ *                  not be NULL.
+ * @param[in] num   Number of ``msg_t`` structures in array.
+ *                  **MUST BE POWER OF TWO!**
+ */
+void msg_init_queue_lockfree(msg_t *array, int num);
+#endif
+
+#if defined(MODULE_CORE_MSG_QUEUE_HWM) || defined(DOXYGEN)
+/**
+ * @brief   Get the high-water mark of a thread's message queue
+ *
+ * @note    Only available with module `core_msg_queue_hwm`.
+ *
+ * @param[in] pid   PID of the thread
+ *
+ * @return  Maximum number of messages that were in the queue at once, since
+ *          the queue was initialized or @ref msg_queue_hwm_reset() was called
+ * @return  -1, if the thread has no message queue
+ */
+int msg_queue_hwm(kernel_pid_t pid);
+
+/**
+ * @brief   Reset the high-water mark of a thread's message queue to the
+ *          number of messages currently in it
+ *
+ * @note    Only available with module `core_msg_queue_hwm`.
+ *
+ * @param[in] pid   PID of the thread
+ */
+void msg_queue_hwm_reset(kernel_pid_t pid);
+#endif
+
 /**
  * @brief   Prints the message queue of the current thread.
  */
@@ -178,6 +178,15 @@ struct _thread {
     msg_t *msg_array;               /**< memory holding messages sent
                                          to this thread's message queue */
 #endif
+#if defined(MODULE_CORE_MSG_LOCKFREE) || defined(DOXYGEN)
+    uint8_t msg_queue_lockfree;     /**< thread_t::msg_queue is lock-free,
+                                         see msg_init_queue_lockfree()  */
+#endif
+#if defined(MODULE_CORE_MSG_QUEUE_HWM) || defined(DOXYGEN)
+    uint16_t msg_queue_hwm;         /**< maximum number of messages in
+                                         thread_t::msg_queue, see
+                                         msg_queue_hwm()                */
+#endif
 #if defined(DEVELHELP) || defined(SCHED_TEST_STACK) \
     || defined(MODULE_MPU_STACK_GUARD) || defined(DOXYGEN)
     char *stack_start;              /**< thread's stack start address   */
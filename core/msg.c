@@ -33,6 +33,12 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#if MODULE_CORE_MSG_LOCKFREE
+#include <stdatomic.h>
+#endif
+#ifdef MODULE_TRACE_EVENT
+#include "trace_event.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -41,8 +47,197 @@ static int _msg_receive(msg_t *m, int block);
 static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
                      unsigned state);
 
+/* with interrupts disabled, after a message was put into the queue */
+static inline void _update_hwm(thread_t *target)
+{
+#ifdef MODULE_CORE_MSG_QUEUE_HWM
+    unsigned numof = cib_avail(&target->msg_queue);
+
+    if (numof > target->msg_queue_hwm) {
+        target->msg_queue_hwm = numof;
+    }
+#else
+    (void)target;
+#endif
+}
+
+static inline void _trace_send(kernel_pid_t target_pid)
+{
+#ifdef MODULE_TRACE_EVENT
+    trace_event(TRACE_EVENT_MSG_SEND, "msg_send", target_pid);
+#else
+    (void)target_pid;
+#endif
+}
+
+#if MODULE_CORE_MSG_LOCKFREE
+/*
+ * Lock-free message queues: senders reserve a slot by advancing
+ * cib_t::write_count with a compare-and-swap and publish the message in it by
+ * writing its msg_t::sender_pid last. Only the receiving thread empties slots,
+ * by resetting msg_t::sender_pid to KERNEL_PID_UNDEF before it advances
+ * cib_t::read_count.
+ *
+ * A sender preempted between reserving and publishing its slot must not keep
+ * the receiver from the messages published behind it, so the receiver takes
+ * the first published slot. Slots taken ahead of an unpublished one are
+ * marked with _LOCKFREE_TAKEN and emptied once cib_t::read_count reaches them.
+ */
+#define _LOCKFREE_TAKEN     ((kernel_pid_t)(KERNEL_PID_ISR + 1))
+
+static_assert(sizeof(atomic_uint) == sizeof(unsigned int),
+              "cib_t counters must be usable as atomic_uint");
+
+static inline atomic_uint *_counter(unsigned int *count)
+{
+    return (atomic_uint *)count;
+}
+
+static inline _Atomic(kernel_pid_t) *_slot_sender(msg_t *slot)
+{
+    return (_Atomic(kernel_pid_t) *)&slot->sender_pid;
+}
+
+static int _lockfree_put(thread_t *target, const msg_t *m)
+{
+    cib_t *cib = &target->msg_queue;
+    unsigned int n = atomic_load_explicit(_counter(&cib->write_count),
+                                          memory_order_relaxed);
+    msg_t *dest;
+
+    assert(m->sender_pid != KERNEL_PID_UNDEF);
+    do {
+        /* acquire the emptying of the slot by the receiver */
+        unsigned int read = atomic_load_explicit(_counter(&cib->read_count),
+                                                 memory_order_acquire);
+
+        if ((n - read) > cib->mask) {
+            return 0;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(_counter(&cib->write_count),
+                                                    &n, n + 1,
+                                                    memory_order_relaxed,
+                                                    memory_order_relaxed));
+
+    dest = &target->msg_array[n & cib->mask];
+    dest->type = m->type;
+    dest->content = m->content;
+    atomic_store_explicit(_slot_sender(dest), m->sender_pid,
+                          memory_order_release);
+    return 1;
+}
+
+static msg_t *_lockfree_find(thread_t *me)
+{
+    cib_t *cib = &me->msg_queue;
+    unsigned int write = atomic_load_explicit(_counter(&cib->write_count),
+                                              memory_order_relaxed);
+
+    for (unsigned int n = cib->read_count; n != write; n++) {
+        msg_t *slot = &me->msg_array[n & cib->mask];
+        kernel_pid_t sender = atomic_load_explicit(_slot_sender(slot),
+                                                   memory_order_acquire);
+
+        /* skip slots not yet published by their sender and slots already
+         * taken */
+        if ((sender != KERNEL_PID_UNDEF) && (sender != _LOCKFREE_TAKEN)) {
+            return slot;
+        }
+    }
+    return NULL;
+}
+
+static int _lockfree_get(thread_t *me, msg_t *m)
+{
+    cib_t *cib = &me->msg_queue;
+    msg_t *slot = _lockfree_find(me);
+    unsigned int read = cib->read_count;
+
+    if (slot == NULL) {
+        return 0;
+    }
+    *m = *slot;
+    if (slot != &me->msg_array[read & cib->mask]) {
+        /* an earlier slot is still unpublished, keep this one reserved */
+        atomic_store_explicit(_slot_sender(slot), _LOCKFREE_TAKEN,
+                              memory_order_relaxed);
+        return 1;
+    }
+    /* empty the head and the slots taken ahead of it */
+    do {
+        atomic_store_explicit(_slot_sender(slot), KERNEL_PID_UNDEF,
+                              memory_order_relaxed);
+        slot = &me->msg_array[++read & cib->mask];
+    } while (atomic_load_explicit(_slot_sender(slot), memory_order_relaxed) ==
+             _LOCKFREE_TAKEN);
+    atomic_store_explicit(_counter(&cib->read_count), read,
+                          memory_order_release);
+    return 1;
+}
+
+/* tells the receiver about a message put into its queue, with interrupts
+ * disabled */
+static void _lockfree_notify(thread_t *target)
+{
+    if (target->status == STATUS_RECEIVE_BLOCKED) {
+        sched_set_status(target, STATUS_PENDING);
+        sched_context_switch_request = 1;
+    }
+#if MODULE_CORE_THREAD_FLAGS
+    target->flags |= THREAD_FLAG_MSG_WAITING;
+    thread_flags_wake(target);
+#endif
+}
+
+/* sends from thread context without disabling interrupts for the enqueuing,
+ * returns 0 if the target has no lock-free queue or it is full */
+static int _msg_send_lockfree(msg_t *m, kernel_pid_t target_pid)
+{
+    thread_t *target = thread_get_unchecked(target_pid);
+    unsigned state;
+
+    if ((target == NULL) || !target->msg_queue_lockfree) {
+        return 0;
+    }
+    m->sender_pid = thread_getpid();
+    if (!_lockfree_put(target, m)) {
+        return 0;
+    }
+    state = irq_disable();
+    _lockfree_notify(target);
+    _update_hwm(target);
+    irq_restore(state);
+    if (sched_context_switch_request) {
+        thread_yield_higher();
+    }
+    return 1;
+}
+#endif /* MODULE_CORE_MSG_LOCKFREE */
+
+static inline bool _is_lockfree(const thread_t *thread)
+{
+#if MODULE_CORE_MSG_LOCKFREE
+    return thread->msg_queue_lockfree;
+#else
+    (void)thread;
+    return false;
+#endif
+}
+
 static int queue_msg(thread_t *target, const msg_t *m)
 {
+#if MODULE_CORE_MSG_LOCKFREE
+    if (target->msg_queue_lockfree) {
+        if (!_lockfree_put(target, m)) {
+            DEBUG("queue_msg(): lock-free message queue is full\n");
+            return 0;
+        }
+        _lockfree_notify(target);
+        _update_hwm(target);
+        return 1;
+    }
+#endif
+
     int n = cib_put(&(target->msg_queue));
 
     if (n < 0) {
@@ -53,6 +248,7 @@ static int queue_msg(thread_t *target, const msg_t *m)
     DEBUG("queue_msg(): queuing message\n");
     msg_t *dest = &target->msg_array[n];
     *dest = *m;
+    _update_hwm(target);
 #if MODULE_CORE_THREAD_FLAGS
     target->flags |= THREAD_FLAG_MSG_WAITING;
     thread_flags_wake(target);
@@ -65,9 +261,15 @@ int msg_send(msg_t *m, kernel_pid_t target_pid)
     if (irq_is_in()) {
         return msg_send_int(m, target_pid);
     }
+    _trace_send(target_pid);
     if (thread_getpid() == target_pid) {
         return msg_send_to_self(m);
     }
+#if MODULE_CORE_MSG_LOCKFREE
+    if (_msg_send_lockfree(m, target_pid)) {
+        return 1;
+    }
+#endif
     return _msg_send(m, target_pid, true, irq_disable());
 }
 
@@ -76,9 +278,15 @@ int msg_try_send(msg_t *m, kernel_pid_t target_pid)
     if (irq_is_in()) {
         return msg_send_int(m, target_pid);
     }
+    _trace_send(target_pid);
     if (thread_getpid() == target_pid) {
         return msg_send_to_self(m);
     }
+#if MODULE_CORE_MSG_LOCKFREE
+    if (_msg_send_lockfree(m, target_pid)) {
+        return 1;
+    }
+#endif
     return _msg_send(m, target_pid, false, irq_disable());
 }
 
@@ -108,7 +316,8 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
           __LINE__, thread_getpid(), target_pid,
           block, me->status, target->status);
 
-    if (target->status != STATUS_RECEIVE_BLOCKED) {
+    /* receivers with a lock-free queue always take messages from there */
+    if ((target->status != STATUS_RECEIVE_BLOCKED) || _is_lockfree(target)) {
         DEBUG(
             "msg_send() %s:%i: Target %" PRIkernel_pid " is not RECEIVE_BLOCKED.\n",
             RIOT_FILE_RELATIVE, __LINE__, target_pid);
@@ -118,7 +327,8 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
                   " has a msg_queue. Queueing message.\n", RIOT_FILE_RELATIVE,
                   __LINE__, target_pid);
             irq_restore(state);
-            if (me->status == STATUS_REPLY_BLOCKED) {
+            if ((me->status == STATUS_REPLY_BLOCKED) ||
+                (_is_lockfree(target) && sched_context_switch_request)) {
                 thread_yield_higher();
             }
             return 1;
@@ -202,7 +412,7 @@ static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
         return -1;
     }
 
-    if (target->status == STATUS_RECEIVE_BLOCKED) {
+    if ((target->status == STATUS_RECEIVE_BLOCKED) && !_is_lockfree(target)) {
         DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
               PRIkernel_pid ".\n", __func__, thread_getpid(), target_pid);
 
@@ -229,6 +439,7 @@ int msg_send_int(msg_t *m, kernel_pid_t target_pid)
     int res;
 
     m->sender_pid = KERNEL_PID_ISR;
+    _trace_send(target_pid);
 
     res = _msg_send_oneway(m, target_pid);
 
@@ -269,6 +480,7 @@ int msg_send_bus(msg_t *m, msg_bus_t *bus)
 int msg_send_receive(msg_t *m, msg_t *reply, kernel_pid_t target_pid)
 {
     assert(thread_getpid() != target_pid);
+    _trace_send(target_pid);
     unsigned state = irq_disable();
     thread_t *me = thread_get_active();
     sched_set_status(me, STATUS_REPLY_BLOCKED);
@@ -338,8 +550,76 @@ int msg_receive(msg_t *m)
     return _msg_receive(m, 1);
 }
 
+#if MODULE_CORE_MSG_LOCKFREE
+static int _msg_receive_lockfree(thread_t *me, msg_t *m, int block)
+{
+    while (1) {
+        int queued = _lockfree_get(me, m);
+
+        if (queued && (me->msg_waiters.next == NULL)) {
+            return 1;
+        }
+
+        unsigned state = irq_disable();
+        list_node_t *next = me->msg_waiters.next;
+
+        if (next) {
+            thread_t *sender =
+                container_of((clist_node_t *)next, thread_t, rq_entry);
+            msg_t *sender_msg = (msg_t *)sender->wait_data;
+
+            if (!queued) {
+                *m = *sender_msg;
+            }
+            else if (!_lockfree_put(me, sender_msg)) {
+                /* another sender was faster to take the freed queue space */
+                irq_restore(state);
+                return 1;
+            }
+            list_remove_head(&me->msg_waiters);
+
+            uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+            if (sender->status != STATUS_REPLY_BLOCKED) {
+                sender->wait_data = NULL;
+                sched_set_status(sender, STATUS_PENDING);
+                sender_prio = sender->priority;
+            }
+            irq_restore(state);
+            if (sender_prio < THREAD_PRIORITY_IDLE) {
+                sched_switch(sender_prio);
+            }
+            return 1;
+        }
+        if (queued || _lockfree_find(me)) {
+            irq_restore(state);
+            if (queued) {
+                return 1;
+            }
+            continue;
+        }
+        if (!block) {
+            irq_restore(state);
+            return -1;
+        }
+        /* senders notify after publishing their message, so with interrupts
+         * disabled the queue was checked for the last time */
+        DEBUG("_msg_receive(): %" PRIkernel_pid ": No msg in lock-free queue. "
+              "Going blocked.\n", thread_getpid());
+        sched_set_status(me, STATUS_RECEIVE_BLOCKED);
+        irq_restore(state);
+        thread_yield_higher();
+    }
+}
+#endif /* MODULE_CORE_MSG_LOCKFREE */
+
 static int _msg_receive(msg_t *m, int block)
 {
+#if MODULE_CORE_MSG_LOCKFREE
+    if (thread_get_active()->msg_queue_lockfree) {
+        return _msg_receive_lockfree(thread_get_active(), m, block);
+    }
+#endif
+
     unsigned state = irq_disable();
 
     DEBUG("_msg_receive: %" PRIkernel_pid ": _msg_receive.\n",
@@ -449,8 +729,46 @@ void msg_init_queue(msg_t *array, int num)
 
     me->msg_array = array;
     cib_init(&(me->msg_queue), num);
+#ifdef MODULE_CORE_MSG_QUEUE_HWM
+    me->msg_queue_hwm = 0;
+#endif
 }
 
+#if MODULE_CORE_MSG_LOCKFREE
+void msg_init_queue_lockfree(msg_t *array, int num)
+{
+    /* mark all slots as empty */
+    for (int i = 0; i < num; i++) {
+        array[i].sender_pid = KERNEL_PID_UNDEF;
+    }
+    msg_init_queue(array, num);
+    thread_get_active()->msg_queue_lockfree = 1;
+}
+#endif
+
+#ifdef MODULE_CORE_MSG_QUEUE_HWM
+int msg_queue_hwm(kernel_pid_t pid)
+{
+    thread_t *thread = thread_get(pid);
+
+    if ((thread == NULL) || !thread_has_msg_queue(thread)) {
+        return -1;
+    }
+    return thread->msg_queue_hwm;
+}
+
+void msg_queue_hwm_reset(kernel_pid_t pid)
+{
+    unsigned state = irq_disable();
+    thread_t *thread = thread_get(pid);
+
+    if ((thread != NULL) && thread_has_msg_queue(thread)) {
+        thread->msg_queue_hwm = cib_avail(&thread->msg_queue);
+    }
+    irq_restore(state);
+}
+#endif
+
 void msg_queue_print(void)
 {
     unsigned state = irq_disable();
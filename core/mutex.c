@@ -28,6 +28,9 @@
 #include "sched.h"
 #include "irq.h"
 #include "list.h"
+#ifdef MODULE_TRACE_EVENT
+#include "trace_event.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -59,9 +62,15 @@ int _mutex_lock(mutex_t *mutex, volatile uint8_t *blocking)
             thread_add_to_list(&mutex->queue, me);
         }
         irq_restore(irqstate);
+#ifdef MODULE_TRACE_EVENT
+        trace_event(TRACE_EVENT_BEGIN, "mutex_lock", (uintptr_t)mutex);
+#endif
         thread_yield_higher();
         /* We were woken up by scheduler. Waker removed us from queue.
          * We have the mutex now. */
+#ifdef MODULE_TRACE_EVENT
+        trace_event(TRACE_EVENT_END, "mutex_lock", (uintptr_t)mutex);
+#endif
         return 1;
     }
     else {
@@ -32,6 +32,14 @@
 #include "mpu.h"
 #endif
 
+#ifdef MODULE_TRACE_EVENT
+#include "trace_event.h"
+#endif
+
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+#include "schedstatistics.h"
+#endif
+
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
@@ -149,6 +157,9 @@ thread_t *__attribute__((used)) sched_run(void)
             active_thread = NULL;
         }
 
+#ifdef MODULE_TRACE_EVENT
+        trace_event(TRACE_EVENT_SWITCH, "sched_switch", KERNEL_PID_UNDEF);
+#endif
         do {
             sched_arch_idle();
         } while (!runqueue_bitcache);
@@ -180,6 +191,11 @@ thread_t *__attribute__((used)) sched_run(void)
         if (sched_cb && !active_thread) {
             sched_cb(KERNEL_PID_UNDEF, next_thread->pid);
         }
+#endif
+#ifdef MODULE_TRACE_EVENT
+        if (!active_thread) {
+            trace_event(TRACE_EVENT_SWITCH, "sched_switch", next_thread->pid);
+        }
 #endif
         DEBUG("sched_run: done, sched_active_thread was not changed.\n");
     }
@@ -196,6 +212,9 @@ thread_t *__attribute__((used)) sched_run(void)
             sched_cb(KERNEL_PID_UNDEF, next_thread->pid);
         }
 #endif
+#ifdef MODULE_TRACE_EVENT
+        trace_event(TRACE_EVENT_SWITCH, "sched_switch", next_thread->pid);
+#endif
 
 #ifdef PICOLIBC_TLS
         _set_tls(next_thread->tls);
@@ -239,6 +258,9 @@ void sched_set_status(thread_t *process, thread_status_t status)
         }
     }
 
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+    sched_statistics_status_cb(process->pid, process->status, status);
+#endif
     process->status = status;
 }
 
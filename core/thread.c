@@ -294,6 +294,12 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
     cib_init(&(thread->msg_queue), 0);
     thread->msg_array = NULL;
 #endif
+#ifdef MODULE_CORE_MSG_LOCKFREE
+    thread->msg_queue_lockfree = 0;
+#endif
+#ifdef MODULE_CORE_MSG_QUEUE_HWM
+    thread->msg_queue_hwm = 0;
+#endif
 
     sched_num_threads++;
 
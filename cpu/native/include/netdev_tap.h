@@ -26,6 +26,7 @@ extern "C" {
 
 #include <stdint.h>
 #include "net/netdev.h"
+#include "net/netstats.h"
 
 #include "net/ethernet/hdr.h"
 
@@ -35,6 +36,17 @@ extern "C" {
 #include "net/if.h"
 #endif
 
+/**
+ * @brief Maximum number of frames received per event of the TAP
+ *
+ * All frames pending on the TAP are received in a single run of the driver's
+ * ISR, up to this number. If there are still frames pending afterwards, the
+ * ISR is triggered again, so other threads get a chance to run in between.
+ */
+#ifndef CONFIG_NETDEV_TAP_RX_BATCH_MAX
+#define CONFIG_NETDEV_TAP_RX_BATCH_MAX  (16U)
+#endif
+
 /**
  * @brief tap interface state
  */
@@ -44,6 +56,9 @@ typedef struct netdev_tap {
     int tap_fd;                         /**< host file descriptor for the TAP */
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     uint8_t promiscuous;                 /**< Flag for promiscuous mode */
+#ifdef MODULE_NETSTATS_RX_BATCH
+    netstats_rx_batch_t rx_batch;       /**< frames received per event */
+#endif
 } netdev_tap_t;
 
 /**
@@ -94,16 +94,39 @@ static inline int _set_promiscous(netdev_t *netdev, int value)
     return value;
 }
 
+static bool _rx_pending(netdev_tap_t *dev);
+static void _continue_reading(netdev_tap_t *dev);
+
 static inline void _isr(netdev_t *netdev)
 {
-    if (netdev->event_callback) {
-        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
-    }
+    netdev_tap_t *dev = (netdev_tap_t*)netdev;
+    unsigned frames = 0;
+
+    if (!netdev->event_callback) {
 #if DEVELHELP
-    else {
         puts("netdev_tap: _isr(): no event_callback set.");
+#endif
+        return;
+    }
+
+    /* receive all pending frames instead of waiting for a signal per frame */
+    do {
+        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+    } while ((++frames < CONFIG_NETDEV_TAP_RX_BATCH_MAX) && _rx_pending(dev));
+    DEBUG("netdev_tap: received %u frames\n", frames);
+
+#ifdef MODULE_NETSTATS_RX_BATCH
+    dev->rx_batch.events++;
+    dev->rx_batch.frames += frames;
+    if (frames > dev->rx_batch.frames_max) {
+        dev->rx_batch.frames_max = frames;
+    }
+    if (frames == CONFIG_NETDEV_TAP_RX_BATCH_MAX) {
+        dev->rx_batch.limit_reached++;
     }
 #endif
+
+    _continue_reading(dev);
 }
 
 static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
@@ -124,6 +147,13 @@ static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
             *((bool*)value) = (bool)_get_promiscous(dev);
             res = sizeof(bool);
             break;
+#ifdef MODULE_NETSTATS_RX_BATCH
+        case NETOPT_RX_BATCH_STATS:
+            assert(max_len == sizeof(netstats_rx_batch_t *));
+            *((netstats_rx_batch_t **)value) = &((netdev_tap_t *)dev)->rx_batch;
+            res = sizeof(netstats_rx_batch_t *);
+            break;
+#endif
         default:
             res = netdev_eth_get(dev, opt, value, max_len);
             break;
@@ -177,18 +207,29 @@ static inline bool _is_addr_multicast(uint8_t *addr)
     return (addr[0] & 0x01);
 }
 
-static void _continue_reading(netdev_tap_t *dev)
+static bool _rx_pending(netdev_tap_t *dev)
 {
-    /* work around lost signals */
     fd_set rfds;
     struct timeval t;
+    int res;
+
     memset(&t, 0, sizeof(t));
     FD_ZERO(&rfds);
     FD_SET(dev->tap_fd, &rfds);
 
+    _native_in_syscall++; /* no switching here */
+    res = real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t);
+    _native_in_syscall--;
+
+    return res == 1;
+}
+
+static void _continue_reading(netdev_tap_t *dev)
+{
     _native_in_syscall++; /* no switching here */
 
-    if (real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t) == 1) {
+    /* work around lost signals */
+    if (_rx_pending(dev)) {
         int sig = SIGIO;
         extern int _sig_pipefd[2];
         extern ssize_t (*real_write)(int fd, const void * buf, size_t count);
@@ -225,8 +266,6 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
             static uint8_t nullbuf[ETHERNET_FRAME_LEN];
 
             real_read(dev->tap_fd, nullbuf, sizeof(nullbuf));
-
-            _continue_reading(dev);
         }
 
         /* no way of figuring out packet size without racey buffering,
@@ -247,13 +286,9 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
                   hdr->dst[0], hdr->dst[1], hdr->dst[2],
                   hdr->dst[3], hdr->dst[4], hdr->dst[5]);
 
-            native_async_read_continue(dev->tap_fd);
-
             return 0;
         }
 
-        _continue_reading(dev);
-
         return nread;
     }
     else if (nread == -1) {
@@ -0,0 +1,342 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 agent
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+#
+# @author   agent <agent@local>
+
+"""
+Load generator for CoAP servers, e.g. `tests/bench_gcoap_latency` on `native`.
+
+Sends requests at a fixed rate (open loop, independent of the responses) and
+reports the latency percentiles, the throughput and the high-water marks of
+the packet buffer and message queues of the node (as provided by the
+`/bench/stats` resource of `tests/bench_gcoap_latency`).
+"""
+
+import argparse
+import json
+import math
+import select
+import socket
+import struct
+import sys
+import time
+
+COAP_VERSION = 1
+COAP_CON = 0
+COAP_NON = 1
+COAP_ACK = 2
+COAP_RST = 3
+
+COAP_GET = 1
+COAP_POST = 2
+COAP_DELETE = 4
+
+COAP_OPT_URI_PATH = 11
+COAP_PAYLOAD_MARKER = 0xff
+
+# name and value of the reported percentiles
+PERCENTILES = (("p50", 50), ("p90", 90), ("p99", 99), ("p999", 99.9))
+
+
+def _opt_nibble(value):
+    """Returns the nibble and extended bytes of an option delta or length"""
+    if value < 13:
+        return value, b""
+    if value < 269:
+        return 13, struct.pack("!B", value - 13)
+    return 14, struct.pack("!H", value - 269)
+
+
+def _opt_value(nibble, msg, pos):
+    """Returns an option delta or length and the position behind it"""
+    if nibble == 13:
+        return msg[pos] + 13, pos + 1
+    if nibble == 14:
+        return struct.unpack("!H", msg[pos:pos + 2])[0] + 269, pos + 2
+    return nibble, pos
+
+
+def encode(type_, code, msg_id, token, path, payload=b""):
+    """Encodes a CoAP request"""
+    msg = struct.pack("!BBH", (COAP_VERSION << 6) | (type_ << 4) | len(token),
+                      code, msg_id) + token
+    last = 0
+    for segment in path.strip("/").split("/"):
+        if not segment:
+            continue
+        value = segment.encode()
+        delta, delta_ext = _opt_nibble(COAP_OPT_URI_PATH - last)
+        length, length_ext = _opt_nibble(len(value))
+        msg += struct.pack("!B", (delta << 4) | length)
+        msg += delta_ext + length_ext + value
+        last = COAP_OPT_URI_PATH
+    if payload:
+        msg += struct.pack("!B", COAP_PAYLOAD_MARKER) + payload
+    return msg
+
+
+def decode(msg):
+    """
+    Returns type, code, message ID, token and payload of a CoAP message, None
+    if it is malformed.
+    """
+    if len(msg) < 4:
+        return None
+    first, code, msg_id = struct.unpack("!BBH", msg[:4])
+    tkl = first & 0xf
+    if (first >> 6) != COAP_VERSION or tkl > 8 or len(msg) < 4 + tkl:
+        return None
+    token = msg[4:4 + tkl]
+    payload = b""
+    pos = 4 + tkl
+    # skip the options
+    try:
+        while pos < len(msg):
+            byte = msg[pos]
+            pos += 1
+            if byte == COAP_PAYLOAD_MARKER:
+                payload = msg[pos:]
+                break
+            _, pos = _opt_value(byte >> 4, msg, pos)
+            length, pos = _opt_value(byte & 0xf, msg, pos)
+            pos += length
+    except (IndexError, struct.error):
+        return None
+    return (first >> 4) & 0x3, code, msg_id, token, payload
+
+
+def percentile(values, pct):
+    """Nearest-rank percentile of sorted values"""
+    if not values:
+        return None
+    rank = max(1, math.ceil(pct / 100 * len(values)))
+    return values[rank - 1]
+
+
+class Node:
+    def __init__(self, addr, port, iface):
+        if iface and "%" not in addr:
+            addr = "{}%{}".format(addr, iface)
+        self.remote = socket.getaddrinfo(addr, port, socket.AF_INET6,
+                                         socket.SOCK_DGRAM)[0][4]
+        self.sock = socket.socket(socket.AF_INET6, socket.SOCK_DGRAM)
+        self.sock.setblocking(False)
+        self.msg_id = 0
+        # tokens of the benchmark requests, unique across runs so late
+        # responses to a previous run are not taken for ones of the current
+        self.token = 0
+
+    def next_msg_id(self):
+        self.msg_id = (self.msg_id + 1) & 0xffff
+        return self.msg_id
+
+    def next_token(self):
+        self.token = (self.token + 1) & 0xffffffff
+        return struct.pack("!I", self.token)
+
+    def ack(self, msg_id):
+        self.sock.sendto(encode(COAP_ACK, 0, msg_id, b"", ""), self.remote)
+
+    def request(self, code, path, timeout):
+        """Sends a single confirmable request and returns the response"""
+        msg_id = self.next_msg_id()
+        token = struct.pack("!H", msg_id)
+        self.sock.sendto(encode(COAP_CON, code, msg_id, token, path),
+                         self.remote)
+        deadline = time.monotonic() + timeout
+        while True:
+            left = deadline - time.monotonic()
+            if left <= 0 or not select.select([self.sock], [], [], left)[0]:
+                return None
+            resp = decode(self.sock.recv(2048))
+            if resp is None or resp[3] != token or resp[1] == 0:
+                continue
+            if resp[0] == COAP_CON:
+                self.ack(resp[2])
+            return resp
+
+    def run(self, rate, duration, timeout, path, payload, confirmable):
+        """
+        Sends requests at rate for duration seconds and collects the
+        responses, waiting at most timeout seconds for the last ones.
+        """
+        type_ = COAP_CON if confirmable else COAP_NON
+        code = COAP_POST if payload else COAP_GET
+        numof = max(1, int(rate * duration))
+        sent = {}
+        latencies = []
+        errors = 0
+        seq = 0
+        last_resp = None
+
+        start = time.monotonic()
+        end = start + numof / rate + timeout
+        while True:
+            now = time.monotonic()
+            # send all requests that are due, catching up if we are late
+            while seq < numof and now >= start + seq / rate:
+                token = self.next_token()
+                msg = encode(type_, code, self.next_msg_id(), token, path,
+                             payload)
+                try:
+                    self.sock.sendto(msg, self.remote)
+                    sent[token] = time.monotonic()
+                except BlockingIOError:
+                    pass
+                seq += 1
+            if seq >= numof and not sent:
+                break
+            if now >= end:
+                break
+            wait = end - now
+            if seq < numof:
+                wait = min(wait, start + seq / rate - now)
+            if not select.select([self.sock], [], [], max(0, wait))[0]:
+                continue
+            while True:
+                try:
+                    data = self.sock.recv(2048)
+                except BlockingIOError:
+                    break
+                received = time.monotonic()
+                resp = decode(data)
+                if resp is None:
+                    continue
+                resp_type, resp_code, msg_id, token, _ = resp
+                if resp_type == COAP_CON:
+                    self.ack(msg_id)
+                # empty ACKs of separate responses and RSTs carry no token
+                if resp_code == 0 or token not in sent:
+                    continue
+                last_resp = received
+                if (resp_code >> 5) == 2:
+                    latencies.append(received - sent.pop(token))
+                else:
+                    sent.pop(token)
+                    errors += 1
+
+        # in milliseconds
+        latencies = sorted(latency * 1000 for latency in latencies)
+        elapsed = ((last_resp - start) if last_resp else 0)
+        return {
+            "rate": rate,
+            "sent": seq,
+            "received": len(latencies),
+            "errors": errors,
+            "lost": len(sent),
+            "throughput": (len(latencies) / elapsed) if elapsed else 0,
+            "latency_ms": dict(
+                [(name, percentile(latencies, pct))
+                 for name, pct in PERCENTILES] +
+                [("max", latencies[-1] if latencies else None)]
+            ),
+        }
+
+    def reset_stats(self, stats_path, timeout):
+        return self.request(COAP_DELETE, stats_path, timeout) is not None
+
+    def stats(self, stats_path, timeout):
+        """Returns the high-water marks reported by the node, None if there
+        is no reply"""
+        resp = self.request(COAP_GET, stats_path, timeout)
+        if resp is None or (resp[1] >> 5) != 2:
+            return None
+        stats = {"pktbuf": None, "slab": [], "msgq": []}
+        for line in resp[4].decode(errors="replace").splitlines():
+            fields = line.split()
+            if len(fields) == 3 and fields[0] == "pktbuf":
+                stats["pktbuf"] = {"max_used": int(fields[1]),
+                                   "size": int(fields[2])}
+            elif len(fields) == 6 and fields[0] == "slab":
+                stats["slab"].append({"class": int(fields[1]),
+                                      "max_used": int(fields[2]),
+                                      "numof": int(fields[3]),
+                                      "size": int(fields[4]),
+                                      "fallbacks": int(fields[5])})
+            elif len(fields) == 5 and fields[0] == "msgq":
+                stats["msgq"].append({"pid": int(fields[1]),
+                                      "name": fields[2],
+                                      "hwm": int(fields[3]),
+                                      "size": int(fields[4])})
+        return stats
+
+
+def print_result(result):
+    print("rate {:g} req/s: sent {}, received {}, errors {}, lost {}"
+          .format(result["rate"], result["sent"], result["received"],
+                  result["errors"], result["lost"]))
+    print("  throughput: {:.1f} responses/s".format(result["throughput"]))
+    print("  latency [ms]: " + ", ".join(
+        "{} {}".format(name, "-" if value is None else "{:.3f}".format(value))
+        for name, value in result["latency_ms"].items()
+    ))
+    stats = result.get("stats")
+    if stats is None:
+        return
+    if stats["pktbuf"]:
+        print("  pktbuf: max used {max_used} of {size} bytes"
+              .format(**stats["pktbuf"]))
+    for slab in stats["slab"]:
+        print("  slab {class} ({size} byte slots): max used {max_used} of "
+              "{numof}, fallbacks {fallbacks}".format(**slab))
+    for queue in stats["msgq"]:
+        print("  msg queue {pid} ({name}): high-water mark {hwm} of {size}"
+              .format(**queue))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("addr", help="IPv6 address of the node")
+    parser.add_argument("-i", "--iface", default="tap0",
+                        help="Interface for link-local addresses, "
+                        "default: tap0")
+    parser.add_argument("-p", "--port", type=int, default=5683,
+                        help="CoAP port of the node, default: 5683")
+    parser.add_argument("-r", "--rate", type=float, nargs="+", default=[100],
+                        help="Requests per second, runs one measurement per "
+                        "rate given, default: 100")
+    parser.add_argument("-d", "--duration", type=float, default=10,
+                        help="Seconds to send requests per rate, default: 10")
+    parser.add_argument("-t", "--timeout", type=float, default=2,
+                        help="Seconds after which a request is considered "
+                        "lost, default: 2")
+    parser.add_argument("-s", "--payload-size", type=int, default=0,
+                        help="Bytes of payload to POST, 0 to GET, default: 0")
+    parser.add_argument("--path", default="/bench",
+                        help="Resource to request, default: /bench")
+    parser.add_argument("--stats-path", default="/bench/stats",
+                        help="Resource providing the high-water marks, "
+                        "default: /bench/stats")
+    parser.add_argument("--no-stats", action="store_true",
+                        help="Do not query the high-water marks")
+    parser.add_argument("--non", action="store_true",
+                        help="Send non-confirmable requests")
+    parser.add_argument("--json", action="store_true",
+                        help="Print one JSON object per rate")
+    args = parser.parse_args()
+
+    node = Node(args.addr, args.port, args.iface)
+    payload = bytes(i & 0xff for i in range(args.payload_size))
+    for rate in args.rate:
+        if not args.no_stats and \
+           not node.reset_stats(args.stats_path, args.timeout):
+            print("Node does not answer on {}".format(args.stats_path),
+                  file=sys.stderr)
+            sys.exit(1)
+        result = node.run(rate, args.duration, args.timeout, args.path,
+                          payload, not args.non)
+        if not args.no_stats:
+            result["stats"] = node.stats(args.stats_path, args.timeout)
+        if args.json:
+            print(json.dumps(result))
+        else:
+            print_result(result)
+
+
+if __name__ == "__main__":
+    main()
@@ -341,6 +341,18 @@ def parse_hexdump(dump):
             - "size" (int): size in bytes of the packet buffer.
             - "last_byte_used" (int): the maximum number of byte used by the
               packet buffer at that point in time.
+            - "slabs" (list, optional): list of slab dictionaries of the size
+              classes of `gnrc_pktbuf_slab` (the packet buffer itself
+              describes its fallback arena in that case):
+                - "idx" (int): Index of the slab.
+                - "start" (int): Start address of the slab.
+                - "slot_size" (int): Size in bytes of a slot in the slab.
+                - "slots" (int): Number of slots in the slab.
+                - "used" (int): Number of slots currently in use.
+                - "max_used" (int): Maximum number of slots in use so far.
+                - "fallbacks" (int): Number of allocations that had to use
+                  a larger class or the fallback arena since this slab was
+                  exhausted.
             - "segments" (list): list of segment dictionaries marked in the
               packet buffer. There are two types of segments "unused" and
               "chunk". "unused" segments are not in use and have the following
@@ -366,6 +378,25 @@ def parse_hexdump(dump):
     current_bytes = None
     chunk_bytes = 0
     for line in dump.readlines():
+        if ("size" in pktbuf) and (number_of_bytes >= pktbuf["size"]):
+            res = pktbuf
+            pktbuf = {"segments": []}
+            number_of_bytes = 0
+            yield res
+        m = re.search(r"slab +(\d+): 0x([0-9A-Fa-f]+) \(slot size: +(\d+), "
+                      r"slots: +(\d+), used: +(\d+), max used: +(\d+), "
+                      r"fallbacks: +(\d+)\)", line)
+        if m is not None:
+            pktbuf.setdefault("slabs", []).append({
+                "idx": int(m.group(1)),
+                "start": int(m.group(2), base=16),
+                "slot_size": int(m.group(3)),
+                "slots": int(m.group(4)),
+                "used": int(m.group(5)),
+                "max_used": int(m.group(6)),
+                "fallbacks": int(m.group(7)),
+            })
+            continue
         if "size" not in pktbuf:
             m = re.search(r"packet buffer: first byte: 0x([0-9A-Fa-f]+), "
                           r"last byte: 0x([0-9A-Fa-f]+) \(size: +(\d+)\)",
@@ -376,11 +407,6 @@ def parse_hexdump(dump):
                 pktbuf["last_byte"] = int(m.group(2), base=16)
                 pktbuf["size"] = int(m.group(3))
         else:
-            if number_of_bytes >= pktbuf["size"]:
-                res = pktbuf
-                pktbuf = {"segments": []}
-                number_of_bytes = 0
-                yield res
             m = re.search(r"  position of last byte used: (\d+)", line)
             if m is not None:
                 pktbuf["last_byte_used"] = int(m.group(1))
@@ -451,6 +477,70 @@ def empty_pktbuf(pktbuf):
             pktbuf["segments"][0]["size"])
 
 
+def occupancy(pktbuf):
+    """
+    Calculates the occupancy of the slabs and the fallback arena.
+
+    Parameters:
+        pktbuf (dict): packet buffer descriptor as returned by parse_hexdump().
+
+    Returns:
+        list: A dictionary for each slab and the arena (last entry) with
+            - "name" (str): Human-readable name of the slab or arena.
+            - "used" (int): Bytes in use.
+            - "size" (int): Size in bytes.
+            - "max_used" (int): Maximum number of bytes used so far.
+            - "fallbacks" (int): Allocations that could not be served by a
+              slab (slabs only).
+            - "fragmentation" (float): Share of the unused bytes in the
+              arena that are not part of the largest unused segment, i.e.
+              0.0 if all unused bytes are in one block (arena only).
+    """
+    res = []
+    for slab in pktbuf.get("slabs", []):
+        res.append({
+            "name": "slab {} ({} B slots)".format(slab["idx"],
+                                                  slab["slot_size"]),
+            "used": slab["used"] * slab["slot_size"],
+            "size": slab["slots"] * slab["slot_size"],
+            "max_used": slab["max_used"] * slab["slot_size"],
+            "fallbacks": slab["fallbacks"],
+        })
+    unused = [s["size"] for s in pktbuf["segments"] if s["type"] == "unused"]
+    free = sum(unused)
+    res.append({
+        "name": "arena" if "slabs" in pktbuf else "pktbuf",
+        "used": pktbuf["size"] - free,
+        "size": pktbuf["size"],
+        "max_used": pktbuf.get("last_byte_used"),
+        "fragmentation": (1 - (max(unused) / free)) if free else 0.0,
+    })
+    return res
+
+
+def print_occupancy(pktbuf):
+    """
+    Prints the result of occupancy() as a table.
+
+    Parameters:
+        pktbuf (dict): packet buffer descriptor as returned by parse_hexdump().
+    """
+    for o in occupancy(pktbuf):
+        line = "{:<24} {:>6}/{:>6} B ({:5.1f}%)".format(
+            o["name"], o["used"], o["size"],
+            (100 * o["used"] / o["size"]) if o["size"] else 0.0
+        )
+        if o["max_used"] is not None:
+            line += ", max. used: {:>6} B".format(o["max_used"])
+        if "fallbacks" in o:
+            line += ", fallbacks: {}".format(o["fallbacks"])
+        if "fragmentation" in o:
+            line += ", fragmentation: {:5.1f}%".format(
+                100 * o["fragmentation"]
+            )
+        print(line)
+
+
 def in_pktbuf(pktbuf, addr):
     """
     Checks if a given address is in the packet buffer.
@@ -463,9 +553,14 @@ def in_pktbuf(pktbuf, addr):
         True, if the address is in the packet buffer.
         False, if the address is not in the packet buffer.
     """
-    return addr is not None and \
-        (pktbuf["first_byte"] <= addr <
-         (pktbuf["first_byte"] + pktbuf["size"]))
+    if addr is None:
+        return False
+    for slab in pktbuf.get("slabs", []):
+        if slab["start"] <= addr < (slab["start"] +
+                                    (slab["slots"] * slab["slot_size"])):
+            return True
+    return pktbuf["first_byte"] <= addr < \
+        (pktbuf["first_byte"] + pktbuf["size"])
 
 
 def in_segment(segment, addr):
@@ -663,9 +758,11 @@ def main():
     args = args_parser.parse_args()
     get_struct(args.elffile, PKTSNIP_STRUCT["name"])
     for i, pktbuf in enumerate(parse_hexdump(args.dump), 1):
-        if empty_pktbuf(pktbuf):
+        if empty_pktbuf(pktbuf) and \
+           all(slab["used"] == 0 for slab in pktbuf.get("slabs", [])):
             print("pktbuf output {} shows an empty pktbuf".format(i))
             pprint.pprint(pktbuf)
+            print_occupancy(pktbuf)
             continue
         pktsnip = None
         while True:
@@ -694,6 +791,7 @@ def main():
                     }
         print("pktbuf output {}".format(i))
         pprint.pprint(pktbuf)
+        print_occupancy(pktbuf)
 
 
 # Subparsers
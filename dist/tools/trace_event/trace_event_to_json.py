@@ -0,0 +1,185 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 agent
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+#
+# @author   agent <agent@local>
+
+"""
+Script to convert the output of `trace_event_dump()` (provided by the
+`trace_event` module) to the JSON trace format understood by Chrome's
+`about:tracing` and https://ui.perfetto.dev.
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+DUMP_VERSION = 1
+
+EVENT_BEGIN = 0
+EVENT_END = 1
+EVENT_INSTANT = 2
+EVENT_COUNTER = 3
+EVENT_FLOW = 4
+EVENT_SWITCH = 5
+EVENT_MSG_SEND = 6
+FLAG_ISR = 0x80
+
+KERNEL_PID_UNDEF = 0
+# thread IDs used in the JSON output for events not belonging to a thread
+TID_IDLE = 0
+TID_ISR = -1
+
+EVENT_STRUCT = struct.Struct("<IIIBBh")
+
+HEADER_RE = re.compile(r"TRACE_EVENT (\d+) (\d+) (\d+)\s*$")
+END_RE = re.compile(r"TRACE_EVENT END\s*$")
+STRING_RE = re.compile(r"S ([0-9a-fA-F]{8}) ?(.*?)\s*$")
+THREAD_RE = re.compile(r"T (\d+) ?(.*?)\s*$")
+EVENT_RE = re.compile(r"E ([0-9a-fA-F]{%d})\s*$" % (2 * EVENT_STRUCT.size))
+
+
+class Dump:
+    def __init__(self, ticks_per_sec):
+        self.ticks_per_sec = ticks_per_sec
+        self.strings = {}
+        self.threads = {}
+        self.events = []
+
+
+def parse(lines):
+    """
+    Yields the dumps in lines. Everything around them (e.g. other output of
+    the application or timestamps added by the terminal) is ignored.
+    """
+    dump = None
+    for line in lines:
+        match = HEADER_RE.search(line)
+        if match:
+            if int(match.group(1)) != DUMP_VERSION:
+                raise ValueError("Unsupported dump version {}"
+                                 .format(match.group(1)))
+            dump = Dump(int(match.group(2)))
+            continue
+        if dump is None:
+            continue
+        if END_RE.search(line):
+            yield dump
+            dump = None
+            continue
+        match = EVENT_RE.search(line)
+        if match:
+            dump.events.append(EVENT_STRUCT.unpack(
+                bytes.fromhex(match.group(1))
+            ))
+            continue
+        match = STRING_RE.search(line)
+        if match:
+            dump.strings[int(match.group(1), 16)] = match.group(2)
+            continue
+        match = THREAD_RE.search(line)
+        if match:
+            dump.threads[int(match.group(1))] = match.group(2)
+    if dump is not None:
+        print("Incomplete dump at end of input", file=sys.stderr)
+        yield dump
+
+
+def _metadata(pid, tid, name):
+    return {"ph": "M", "pid": pid, "tid": tid, "name": "thread_name",
+            "args": {"name": name}}
+
+
+def convert(dump, pid=0):
+    """
+    Returns the events of a dump in the JSON trace format. Timestamps are
+    converted to microseconds, overflows of the 32-bit timestamps are taken
+    into account.
+    """
+    trace = [
+        {"ph": "M", "pid": pid, "name": "process_name",
+         "args": {"name": "RIOT"}},
+        _metadata(pid, TID_IDLE, "idle"),
+        _metadata(pid, TID_ISR, "ISR"),
+    ]
+    for thread, name in sorted(dump.threads.items()):
+        trace.append(_metadata(pid, thread, name or "thread {}".format(thread)))
+
+    running = None
+    flows = set()
+    last_time = None
+    offset = 0
+    for (time, name, arg, type_, _, thread) in dump.events:
+        # events are ordered by time, a large backwards jump is an overflow
+        if last_time is not None and last_time - time > 1 << 31:
+            offset += 1 << 32
+        last_time = time
+        ts = (offset + time) * 1000000 / dump.ticks_per_sec
+        name = dump.strings.get(name, "0x{:08x}".format(name))
+        tid = TID_ISR if (type_ & FLAG_ISR) else thread
+        type_ &= ~FLAG_ISR
+        event = {"pid": pid, "tid": tid, "ts": ts, "name": name}
+
+        if type_ == EVENT_SWITCH:
+            # show the time each thread runs as a slice in that thread
+            if running is not None:
+                trace.append({"ph": "E", "pid": pid, "tid": running,
+                              "ts": ts, "name": "running"})
+            running = TID_IDLE if arg == KERNEL_PID_UNDEF else arg
+            trace.append({"ph": "B", "pid": pid, "tid": running, "ts": ts,
+                          "name": "running" if running else "idle"})
+            continue
+        if type_ == EVENT_BEGIN:
+            event.update({"ph": "B", "args": {"arg": arg}})
+        elif type_ == EVENT_END:
+            event.update({"ph": "E", "args": {"arg": arg}})
+        elif type_ == EVENT_COUNTER:
+            event.update({"ph": "C", "args": {"value": arg}})
+        elif type_ == EVENT_MSG_SEND:
+            event.update({"ph": "i", "s": "t", "args": {"to": arg}})
+        elif type_ == EVENT_FLOW:
+            # mark the hand-over and connect all hand-overs of the object
+            trace.append(dict(event, ph="i", s="t",
+                              args={"id": "0x{:08x}".format(arg)}))
+            event.update({"ph": "t" if arg in flows else "s",
+                          "cat": "flow", "id": arg, "bp": "e"})
+            flows.add(arg)
+        else:
+            event.update({"ph": "i", "s": "t", "args": {"arg": arg}})
+        trace.append(event)
+    if running is not None and last_time is not None:
+        trace.append({"ph": "E", "pid": pid, "tid": running,
+                      "ts": (offset + last_time) * 1000000 /
+                      dump.ticks_per_sec,
+                      "name": "running"})
+    return trace
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("dump", nargs="?", type=argparse.FileType("r"),
+                        default=sys.stdin,
+                        help="Output containing the dump(s), default: STDIN")
+    parser.add_argument("-o", "--output", type=argparse.FileType("w"),
+                        default=sys.stdout,
+                        help="JSON file to write to, default: STDOUT")
+    args = parser.parse_args()
+
+    trace = []
+    # every dump is shown as a separate process
+    for pid, dump in enumerate(parse(args.dump)):
+        trace.extend(convert(dump, pid))
+    if not trace:
+        print("No dump found", file=sys.stderr)
+        sys.exit(1)
+    json.dump({"traceEvents": trace, "displayTimeUnit": "ns"}, args.output)
+
+
+if __name__ == "__main__":
+    main()
@@ -96,7 +96,12 @@
  *    passing the buffer and reading the received data into this buffer
  *
  * This receive sequence can of course be simplified by skipping steps 2 and 3
- * when using fixed sized pre-allocated buffers or similar means. *
+ * when using fixed sized pre-allocated buffers or similar means: every driver
+ * must accept a @ref netdev_driver_t::recv "recv()" call with a buffer for the
+ * largest possible frame without the size being queried first. This way the
+ * frame is written directly to its final location with a single call to the
+ * driver, as e.g. the GNRC Ethernet interface does with a packet buffer snip
+ * preallocated for the maximum frame size.
  *
  * @note    The @ref netdev_driver_t::send "send()" and
  *          @ref netdev_driver_t::recv "recv()" functions **must** never be
@@ -370,6 +375,11 @@ typedef struct netdev_driver {
      * If @p buf == NULL and @p len > 0, drops the frame and returns the frame
      * size.
      *
+     * If called with @p buf != NULL without querying the frame size before,
+     * the received frame is read into @p buf like after such a query. Callers
+     * may rely on this to receive into a buffer of the maximum frame size
+     * with a single call.
+     *
      * If called with @p buf != NULL and @p len is smaller than the received
      * frame:
      *  - The received frame is dropped
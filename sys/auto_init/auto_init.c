@@ -49,6 +49,11 @@ void auto_init(void)
         extern void init_schedstatistics(void);
         init_schedstatistics();
     }
+    if (IS_USED(MODULE_TRACE_EVENT)) {
+        LOG_DEBUG("Auto init trace_event.\n");
+        extern void trace_event_init(void);
+        trace_event_init();
+    }
     if (IS_USED(MODULE_DUMMY_THREAD)) {
         extern void dummy_thread_create(void);
         dummy_thread_create();
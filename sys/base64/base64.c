@@ -22,68 +22,174 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "base64.h"
 #include "kernel_defines.h"
 
-#define BASE64_CAPITAL_UPPER_BOUND     (25)     /**< base64 'Z'           */
-#define BASE64_SMALL_UPPER_BOUND       (51)     /**< base64 'z'           */
-#define BASE64_NUMBER_UPPER_BOUND      (61)     /**< base64 '9'           */
-#define BASE64_PLUS                    (62)     /**< base64 '+'           */
-#define BASE64_MINUS                   (62)     /**< base64 '-'           */
-#define BASE64_SLASH                   (63)     /**< base64 '/'           */
-#define BASE64_UNDERLINE               (63)     /**< base64 '_'           */
 #define BASE64_EQUALS                  (0xFE)   /**< no base64 symbol '=' */
 #define BASE64_NOT_DEFINED             (0xFF)   /**< no base64 symbol     */
 
+#if defined(CPU_NATIVE) && (defined(__i386__) || defined(__x86_64__))
+/* the host may support SSSE3 even if the compiler was not told so, so its
+ * availability is checked at runtime */
+#include <tmmintrin.h>
+#define BASE64_SSSE3
+#endif
+
 /*
- * returns the corresponding ascii symbol value for the given base64 code
+ * the corresponding ascii symbols for the base64 codes
  */
-static char getsymbol(uint8_t code, bool urlsafe)
-{
-    if (!IS_ACTIVE(MODULE_BASE64URL)) {
-        urlsafe = false;
-    }
+static const char _symbols[64] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
-    if (urlsafe && code == BASE64_UNDERLINE) {
-        return '_';
-    }
-
-    if (urlsafe && code == BASE64_MINUS) {
-        return '-';
-    }
+#if IS_ACTIVE(MODULE_BASE64URL)
+static const char _symbols_url[64] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+#endif
 
-    if (!urlsafe && code == BASE64_SLASH) {
-        return '/';
-    }
+/*
+ * the corresponding base64 codes for the ascii symbols, both '+' and '-' as
+ * well as '/' and '_' are accepted
+ */
+static const uint8_t _codes[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0x3e, 0xff, 0x3f,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff,
+    0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+    0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0x3f,
+    0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+#ifdef BASE64_SSSE3
+static bool _ssse3_supported(void)
+{
+    static int supported = -1;
 
-    if (!urlsafe && code == BASE64_PLUS) {
-        return '+';
+    if (supported < 0) {
+        __builtin_cpu_init();
+        supported = __builtin_cpu_supports("ssse3");
     }
+    return supported;
+}
 
-    if (code <= BASE64_CAPITAL_UPPER_BOUND) {
-        return (code + 'A');
+/* encodes 12 bytes to 16 symbols per iteration, see
+ * http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html,
+ * reads 16 bytes from in */
+__attribute__((target("ssse3")))
+static size_t _encode_ssse3(uint8_t *out, const uint8_t *in, size_t len,
+                            bool urlsafe)
+{
+    /* offsets to add to the codes of each range to get the symbols */
+    const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52,
+                                          urlsafe ? '-' - 62 : '+' - 62,
+                                          urlsafe ? '_' - 63 : '/' - 63,
+                                          'A', 0, 0);
+    size_t done = 0;
+
+    for (; len - done >= 16; done += 12, in += 12, out += 16) {
+        __m128i data = _mm_loadu_si128((const __m128i *)in);
+        __m128i codes, idx;
+
+        /* every 32-bit lane gets the three bytes of one group */
+        data = _mm_shuffle_epi8(data, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4,
+                                                     7, 6, 8, 7, 10, 9, 11,
+                                                     10));
+        /* move each 6-bit code into its own byte */
+        codes = _mm_mulhi_epu16(_mm_and_si128(data, _mm_set1_epi32(0x0fc0fc00)),
+                                _mm_set1_epi32(0x04000040));
+        codes = _mm_or_si128(codes, _mm_mullo_epi16(
+                                 _mm_and_si128(data, _mm_set1_epi32(0x003f03f0)),
+                                 _mm_set1_epi32(0x01000010)));
+        /* 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12 */
+        idx = _mm_subs_epu8(codes, _mm_set1_epi8(51));
+        idx = _mm_or_si128(idx, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26),
+                                                             codes),
+                                              _mm_set1_epi8(13)));
+        codes = _mm_add_epi8(codes, _mm_shuffle_epi8(offsets, idx));
+        _mm_storeu_si128((__m128i *)out, codes);
     }
+    return done;
+}
 
-    if (code <= BASE64_SMALL_UPPER_BOUND) {
-        return (code + ('z' - BASE64_SMALL_UPPER_BOUND));
-    }
+/* returns the mask of bytes in [lo, hi], symbols above 127 are negative */
+__attribute__((target("ssse3")))
+static inline __m128i _in_range(__m128i symbols, char lo, char hi)
+{
+    return _mm_and_si128(_mm_cmpgt_epi8(symbols, _mm_set1_epi8(lo - 1)),
+                         _mm_cmpgt_epi8(_mm_set1_epi8(hi + 1), symbols));
+}
 
-    if (code <= BASE64_NUMBER_UPPER_BOUND) {
-        return (code + ('9' - BASE64_NUMBER_UPPER_BOUND));
+/* decodes 16 symbols to 12 bytes per iteration as long as all symbols are
+ * base64 codes, see http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html */
+__attribute__((target("ssse3")))
+static size_t _decode_ssse3(uint8_t *out, const uint8_t *in, size_t len)
+{
+    size_t done = 0;
+
+    for (; len - done >= 16; done += 16, in += 16, out += 12) {
+        __m128i symbols = _mm_loadu_si128((const __m128i *)in);
+        __m128i upper = _in_range(symbols, 'A', 'Z');
+        __m128i lower = _in_range(symbols, 'a', 'z');
+        __m128i digit = _in_range(symbols, '0', '9');
+        __m128i plus = _mm_or_si128(_mm_cmpeq_epi8(symbols, _mm_set1_epi8('+')),
+                                    _mm_cmpeq_epi8(symbols, _mm_set1_epi8('-')));
+        __m128i slash = _mm_or_si128(_mm_cmpeq_epi8(symbols, _mm_set1_epi8('/')),
+                                     _mm_cmpeq_epi8(symbols, _mm_set1_epi8('_')));
+        __m128i shift, valid, codes;
+        uint8_t buf[16];
+
+        valid = _mm_or_si128(_mm_or_si128(upper, lower),
+                             _mm_or_si128(digit, _mm_or_si128(plus, slash)));
+        if (_mm_movemask_epi8(valid) != 0xffff) {
+            /* leave padding and skipped symbols to the scalar code */
+            break;
+        }
+        shift = _mm_and_si128(upper, _mm_set1_epi8(-'A'));
+        shift = _mm_or_si128(shift, _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+        shift = _mm_or_si128(shift, _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+        codes = _mm_add_epi8(symbols, shift);
+        /* '+', '-', '/', and '_' are replaced by their code */
+        codes = _mm_or_si128(_mm_andnot_si128(_mm_or_si128(plus, slash), codes),
+                             _mm_or_si128(_mm_and_si128(plus, _mm_set1_epi8(62)),
+                                          _mm_and_si128(slash,
+                                                        _mm_set1_epi8(63))));
+        /* merge four 6-bit codes to 24 bits in each 32-bit lane */
+        codes = _mm_maddubs_epi16(codes, _mm_set1_epi32(0x01400140));
+        codes = _mm_madd_epi16(codes, _mm_set1_epi32(0x00011000));
+        codes = _mm_shuffle_epi8(codes, _mm_setr_epi8(2, 1, 0, 6, 5, 4,
+                                                      10, 9, 8, 14, 13, 12,
+                                                      -1, -1, -1, -1));
+        /* only 12 bytes are written to out */
+        _mm_storeu_si128((__m128i *)buf, codes);
+        memcpy(out, buf, 12);
     }
-
-    return (char)BASE64_NOT_DEFINED;
+    return done;
 }
+#endif /* BASE64_SSSE3 */
 
-static void encode_three_bytes(uint8_t *dest,
-                               uint8_t b1, uint8_t b2, uint8_t b3,
-                               bool urlsafe)
+static void encode_three_bytes(uint8_t *dest, const char *symbols,
+                               uint8_t b1, uint8_t b2, uint8_t b3)
 {
-    dest[0] = getsymbol(b1 >> 2, urlsafe);
-    dest[1] = getsymbol(((b1 & 0x03) << 4) | (b2 >> 4), urlsafe);
-    dest[2] = getsymbol(((b2 & 0x0f) << 2) | (b3 >> 6), urlsafe);
-    dest[3] = getsymbol(b3 & 0x3f, urlsafe);
+    uint32_t group = ((uint32_t)b1 << 16) | ((uint32_t)b2 << 8) | b3;
+
+    dest[0] = symbols[group >> 18];
+    dest[1] = symbols[(group >> 12) & 0x3f];
+    dest[2] = symbols[(group >> 6) & 0x3f];
+    dest[3] = symbols[group & 0x3f];
 }
 
 static int base64_encode_base(const void *data_in, size_t data_in_size,
@@ -115,8 +221,24 @@ static int base64_encode_base(const void *data_in, size_t data_in_size,
 
     *base64_out_size = required_size;
 
-    while (in < end - 2) {
-        encode_three_bytes(out, in[0], in[1], in[2], urlsafe);
+#if IS_ACTIVE(MODULE_BASE64URL)
+    const char *symbols = (urlsafe) ? _symbols_url : _symbols;
+#else
+    const char *symbols = _symbols;
+    (void)urlsafe;
+#endif
+
+#ifdef BASE64_SSSE3
+    if ((data_in_size >= 16) && _ssse3_supported()) {
+        size_t done = _encode_ssse3(out, in, data_in_size, symbols != _symbols);
+
+        in += done;
+        out += (done / 3) * 4;
+    }
+#endif
+
+    while (end - in > 2) {
+        encode_three_bytes(out, symbols, in[0], in[1], in[2]);
         out += 4;
         in += 3;
     }
@@ -128,7 +250,7 @@ static int base64_encode_base(const void *data_in, size_t data_in_size,
 
     if (in + 1 == end) {
         /* One byte still left to decode, set other two input bytes to zero */
-        encode_three_bytes(out, in[0], 0, 0, urlsafe);
+        encode_three_bytes(out, symbols, in[0], 0, 0);
         /* Replace last two bytes with "=" to signal corresponding input bytes
          * didn't exist */
         out[2] = out[3] = '=';
@@ -136,7 +258,7 @@ static int base64_encode_base(const void *data_in, size_t data_in_size,
     }
 
     /* Final case: 2 bytes remain for encoding, use zero as third input */
-    encode_three_bytes(out, in[0], in[1], 0, urlsafe);
+    encode_three_bytes(out, symbols, in[0], in[1], 0);
     /* Replace last output with "=" to signal corresponding input byte didn't exit */
     out[3] = '=';
 
@@ -157,53 +279,6 @@ int base64url_encode(const void *data_in, size_t data_in_size,
 }
 #endif
 
-/*
- *  returns the corresponding base64 code for the given ascii symbol
- */
-static uint8_t getcode(char symbol)
-{
-    if (symbol == '/') {
-        return BASE64_SLASH;
-    }
-
-    if (symbol == '_') {
-        return BASE64_UNDERLINE;
-    }
-
-    if (symbol == '+') {
-        return BASE64_PLUS;
-    }
-
-    if (symbol == '-') {
-        return BASE64_MINUS;
-    }
-
-    if (symbol == '=') {
-        /* indicates a padded base64 end */
-        return BASE64_EQUALS;
-    }
-
-    if (symbol < '0') {
-        /* indicates that the given symbol is not base64 and should be ignored */
-        return BASE64_NOT_DEFINED;
-    }
-
-    if (symbol <= '9' && symbol >= '0') {
-        return (symbol + (BASE64_NUMBER_UPPER_BOUND - '9'));
-    }
-
-    if (symbol <= 'Z' && symbol >= 'A') {
-        return (symbol - 'A');
-    }
-
-    if (symbol <= 'z' && symbol >= 'a') {
-        return (symbol + (BASE64_SMALL_UPPER_BOUND - 'z'));
-    }
-
-    /* indicates that the given symbol is not base64 and should be ignored */
-    return BASE64_NOT_DEFINED;
-}
-
 static void decode_four_codes(uint8_t *out, const uint8_t *src)
 {
     out[0] = (src[0] << 2) | (src[1] >> 4);
@@ -234,8 +309,33 @@ int base64_decode(const void *base64_in, size_t base64_in_size,
     const uint8_t *end = in + base64_in_size;
     uint8_t decode_buf[4];
 
+#ifdef BASE64_SSSE3
+    if ((base64_in_size >= 16) && _ssse3_supported()) {
+        size_t done = _decode_ssse3(out, in, base64_in_size);
+
+        in += done;
+        out += (done / 4) * 3;
+    }
+#endif
+
     while (1) {
         size_t decode_buf_fill = 0;
+
+        /* fast path: the next four symbols are all base64 codes */
+        while (end - in >= 4) {
+            decode_buf[0] = _codes[in[0]];
+            decode_buf[1] = _codes[in[1]];
+            decode_buf[2] = _codes[in[2]];
+            decode_buf[3] = _codes[in[3]];
+            if ((decode_buf[0] | decode_buf[1] | decode_buf[2] |
+                 decode_buf[3]) & 0xc0) {
+                break;
+            }
+            decode_four_codes(out, decode_buf);
+            out += 3;
+            in += 4;
+        }
+
         /* Try to load 4 codes into the decode buffer, skipping invalid symbols
          * (such as inserted newlines commonly used to improve readability) */
         do {
@@ -270,7 +370,7 @@ int base64_decode(const void *base64_in, size_t base64_in_size,
                 *data_out_size = (uintptr_t)out - (uintptr_t)data_out;
                 return BASE64_SUCCESS;
             }
-            switch (decode_buf[decode_buf_fill] = getcode(*in++)) {
+            switch (decode_buf[decode_buf_fill] = _codes[*in++]) {
                 case BASE64_NOT_DEFINED:
                 case BASE64_EQUALS:
                     continue;
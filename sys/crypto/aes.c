@@ -34,12 +34,21 @@
 
 #include <stdio.h>
 #include <stdarg.h>
+#include <stdbool.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include "crypto/aes.h"
 #include "crypto/ciphers.h"
 
+#if defined(CPU_NATIVE) && (defined(__i386__) || defined(__x86_64__)) && \
+    !defined(AES_ASM)
+/* the host may support AES-NI even if the compiler was not told so, so its
+ * availability is checked at runtime */
+#include <wmmintrin.h>
+#define AES_NI
+#endif
+
 /**
  * Interface to the aes cipher
  */
@@ -48,7 +57,10 @@ static const cipher_interface_t aes_interface = {
     AES_KEY_SIZE,
     aes_init,
     aes_encrypt,
-    aes_decrypt
+    aes_decrypt,
+    aes_encrypt_blocks,
+    aes_decrypt_blocks,
+    aes_encrypt_chain,
 };
 const cipher_id_t CIPHER_AES_128 = &aes_interface;
 
@@ -1025,23 +1037,12 @@ static int aes_set_decrypt_key(const unsigned char *userKey, const int bits,
 
 #ifndef AES_ASM
 /*
- * Encrypt a single block
+ * Encrypt a single block with an expanded key
  * in and out can overlap
  */
-int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
-                uint8_t *cipherBlock)
+static void _encrypt_block(const AES_KEY *key, const uint8_t *plainBlock,
+                           uint8_t *cipherBlock)
 {
-    /* setup AES_KEY */
-    int res;
-    AES_KEY aeskey;
-    const AES_KEY *key = &aeskey;
-
-    res = aes_set_encrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE * 8, &aeskey);
-    if (res < 0) {
-        return res;
-    }
-
     const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 #ifndef MODULE_CRYPTO_AES_UNROLL
@@ -1289,28 +1290,15 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
         (Te4((t2) & 0xff)       & 0x000000ff) ^
         rk[3];
     PUTU32(cipherBlock + 12, s3);
-    return 1;
 }
 
 /*
- * Decrypt a single block
+ * Decrypt a single block with an expanded key
  * in and out can overlap
  */
-int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
-                uint8_t *plainBlock)
+static void _decrypt_block(const AES_KEY *key, const uint8_t *cipherBlock,
+                           uint8_t *plainBlock)
 {
-    /* setup AES_KEY */
-    int res;
-    AES_KEY aeskey;
-    const AES_KEY *key = &aeskey;
-
-    res = aes_set_decrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE * 8, &aeskey);
-
-    if (res < 0) {
-        return res;
-    }
-
     const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 #ifndef MODULE_CRYPTO_AES_UNROLL
@@ -1550,6 +1538,281 @@ int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
         (Td4((t0) & 0xff)       & 0x000000ff) ^
         rk[3];
     PUTU32(plainBlock + 12, s3);
+}
+
+#ifdef AES_NI
+#define AES_NI_ROUNDS   (10)
+
+static bool _aes_ni_supported(void)
+{
+    static int supported = -1;
+
+    if (supported < 0) {
+        __builtin_cpu_init();
+        supported = __builtin_cpu_supports("aes");
+    }
+    return supported;
+}
+
+__attribute__((target("aes,sse2")))
+static inline __m128i _ni_expand_step(__m128i key, __m128i assist)
+{
+    assist = _mm_shuffle_epi32(assist, 0xff);
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    return _mm_xor_si128(key, assist);
+}
+
+/* the round constant needs to be an immediate */
+#define _NI_EXPAND(rk, i, rcon) \
+    rk[i] = _ni_expand_step(rk[i - 1], \
+                            _mm_aeskeygenassist_si128(rk[i - 1], rcon))
+
+__attribute__((target("aes,sse2")))
+static void _ni_set_encrypt_key(const uint8_t *userKey, __m128i *rk)
+{
+    rk[0] = _mm_loadu_si128((const __m128i *)userKey);
+    _NI_EXPAND(rk, 1, 0x01);
+    _NI_EXPAND(rk, 2, 0x02);
+    _NI_EXPAND(rk, 3, 0x04);
+    _NI_EXPAND(rk, 4, 0x08);
+    _NI_EXPAND(rk, 5, 0x10);
+    _NI_EXPAND(rk, 6, 0x20);
+    _NI_EXPAND(rk, 7, 0x40);
+    _NI_EXPAND(rk, 8, 0x80);
+    _NI_EXPAND(rk, 9, 0x1b);
+    _NI_EXPAND(rk, 10, 0x36);
+}
+
+__attribute__((target("aes,sse2")))
+static void _ni_set_decrypt_key(const uint8_t *userKey, __m128i *rk)
+{
+    __m128i ek[AES_NI_ROUNDS + 1];
+
+    _ni_set_encrypt_key(userKey, ek);
+    rk[0] = ek[AES_NI_ROUNDS];
+    for (unsigned i = 1; i < AES_NI_ROUNDS; i++) {
+        rk[i] = _mm_aesimc_si128(ek[AES_NI_ROUNDS - i]);
+    }
+    rk[AES_NI_ROUNDS] = ek[0];
+}
+
+__attribute__((target("aes,sse2")))
+static void _ni_encrypt(const uint8_t *userKey, const uint8_t *input,
+                        uint8_t *output, size_t blocks)
+{
+    __m128i rk[AES_NI_ROUNDS + 1];
+
+    _ni_set_encrypt_key(userKey, rk);
+    /* four blocks at once to hide the latency of the AES instructions */
+    for (; blocks >= 4; blocks -= 4, input += 64, output += 64) {
+        __m128i b0 = _mm_loadu_si128((const __m128i *)input);
+        __m128i b1 = _mm_loadu_si128((const __m128i *)(input + 16));
+        __m128i b2 = _mm_loadu_si128((const __m128i *)(input + 32));
+        __m128i b3 = _mm_loadu_si128((const __m128i *)(input + 48));
+
+        b0 = _mm_xor_si128(b0, rk[0]);
+        b1 = _mm_xor_si128(b1, rk[0]);
+        b2 = _mm_xor_si128(b2, rk[0]);
+        b3 = _mm_xor_si128(b3, rk[0]);
+        for (unsigned r = 1; r < AES_NI_ROUNDS; r++) {
+            b0 = _mm_aesenc_si128(b0, rk[r]);
+            b1 = _mm_aesenc_si128(b1, rk[r]);
+            b2 = _mm_aesenc_si128(b2, rk[r]);
+            b3 = _mm_aesenc_si128(b3, rk[r]);
+        }
+        _mm_storeu_si128((__m128i *)output,
+                         _mm_aesenclast_si128(b0, rk[AES_NI_ROUNDS]));
+        _mm_storeu_si128((__m128i *)(output + 16),
+                         _mm_aesenclast_si128(b1, rk[AES_NI_ROUNDS]));
+        _mm_storeu_si128((__m128i *)(output + 32),
+                         _mm_aesenclast_si128(b2, rk[AES_NI_ROUNDS]));
+        _mm_storeu_si128((__m128i *)(output + 48),
+                         _mm_aesenclast_si128(b3, rk[AES_NI_ROUNDS]));
+    }
+    for (; blocks > 0; blocks--, input += 16, output += 16) {
+        __m128i b = _mm_loadu_si128((const __m128i *)input);
+
+        b = _mm_xor_si128(b, rk[0]);
+        for (unsigned r = 1; r < AES_NI_ROUNDS; r++) {
+            b = _mm_aesenc_si128(b, rk[r]);
+        }
+        _mm_storeu_si128((__m128i *)output,
+                         _mm_aesenclast_si128(b, rk[AES_NI_ROUNDS]));
+    }
+}
+
+__attribute__((target("aes,sse2")))
+static void _ni_decrypt(const uint8_t *userKey, const uint8_t *input,
+                        uint8_t *output, size_t blocks)
+{
+    __m128i rk[AES_NI_ROUNDS + 1];
+
+    _ni_set_decrypt_key(userKey, rk);
+    for (; blocks >= 4; blocks -= 4, input += 64, output += 64) {
+        __m128i b0 = _mm_loadu_si128((const __m128i *)input);
+        __m128i b1 = _mm_loadu_si128((const __m128i *)(input + 16));
+        __m128i b2 = _mm_loadu_si128((const __m128i *)(input + 32));
+        __m128i b3 = _mm_loadu_si128((const __m128i *)(input + 48));
+
+        b0 = _mm_xor_si128(b0, rk[0]);
+        b1 = _mm_xor_si128(b1, rk[0]);
+        b2 = _mm_xor_si128(b2, rk[0]);
+        b3 = _mm_xor_si128(b3, rk[0]);
+        for (unsigned r = 1; r < AES_NI_ROUNDS; r++) {
+            b0 = _mm_aesdec_si128(b0, rk[r]);
+            b1 = _mm_aesdec_si128(b1, rk[r]);
+            b2 = _mm_aesdec_si128(b2, rk[r]);
+            b3 = _mm_aesdec_si128(b3, rk[r]);
+        }
+        _mm_storeu_si128((__m128i *)output,
+                         _mm_aesdeclast_si128(b0, rk[AES_NI_ROUNDS]));
+        _mm_storeu_si128((__m128i *)(output + 16),
+                         _mm_aesdeclast_si128(b1, rk[AES_NI_ROUNDS]));
+        _mm_storeu_si128((__m128i *)(output + 32),
+                         _mm_aesdeclast_si128(b2, rk[AES_NI_ROUNDS]));
+        _mm_storeu_si128((__m128i *)(output + 48),
+                         _mm_aesdeclast_si128(b3, rk[AES_NI_ROUNDS]));
+    }
+    for (; blocks > 0; blocks--, input += 16, output += 16) {
+        __m128i b = _mm_loadu_si128((const __m128i *)input);
+
+        b = _mm_xor_si128(b, rk[0]);
+        for (unsigned r = 1; r < AES_NI_ROUNDS; r++) {
+            b = _mm_aesdec_si128(b, rk[r]);
+        }
+        _mm_storeu_si128((__m128i *)output,
+                         _mm_aesdeclast_si128(b, rk[AES_NI_ROUNDS]));
+    }
+}
+
+__attribute__((target("aes,sse2")))
+static void _ni_encrypt_chain(const uint8_t *userKey, uint8_t *chain,
+                              const uint8_t *input, uint8_t *output,
+                              size_t blocks)
+{
+    __m128i rk[AES_NI_ROUNDS + 1];
+    __m128i b = _mm_loadu_si128((const __m128i *)chain);
+
+    _ni_set_encrypt_key(userKey, rk);
+    for (; blocks > 0; blocks--, input += 16) {
+        b = _mm_xor_si128(b, _mm_loadu_si128((const __m128i *)input));
+        b = _mm_xor_si128(b, rk[0]);
+        for (unsigned r = 1; r < AES_NI_ROUNDS; r++) {
+            b = _mm_aesenc_si128(b, rk[r]);
+        }
+        b = _mm_aesenclast_si128(b, rk[AES_NI_ROUNDS]);
+        if (output) {
+            _mm_storeu_si128((__m128i *)output, b);
+            output += 16;
+        }
+    }
+    _mm_storeu_si128((__m128i *)chain, b);
+}
+#endif /* AES_NI */
+
+/*
+ * Encrypt a single block
+ * in and out can overlap
+ */
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
+                uint8_t *cipherBlock)
+{
+    return aes_encrypt_blocks(context, plainBlock, cipherBlock, 1);
+}
+
+/*
+ * Decrypt a single block
+ * in and out can overlap
+ */
+int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
+                uint8_t *plainBlock)
+{
+    return aes_decrypt_blocks(context, cipherBlock, plainBlock, 1);
+}
+
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t blocks)
+{
+    int res;
+    AES_KEY aeskey;
+
+#ifdef AES_NI
+    if (_aes_ni_supported()) {
+        _ni_encrypt(context->context, input, output, blocks);
+        return 1;
+    }
+#endif
+    /* expand the key only once for all blocks */
+    res = aes_set_encrypt_key((unsigned char *)context->context,
+                              AES_KEY_SIZE * 8, &aeskey);
+    if (res < 0) {
+        return res;
+    }
+    for (; blocks > 0; blocks--) {
+        _encrypt_block(&aeskey, input, output);
+        input += AES_BLOCK_SIZE;
+        output += AES_BLOCK_SIZE;
+    }
+    return 1;
+}
+
+int aes_decrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t blocks)
+{
+    int res;
+    AES_KEY aeskey;
+
+#ifdef AES_NI
+    if (_aes_ni_supported()) {
+        _ni_decrypt(context->context, input, output, blocks);
+        return 1;
+    }
+#endif
+    /* expand the key only once for all blocks */
+    res = aes_set_decrypt_key((unsigned char *)context->context,
+                              AES_KEY_SIZE * 8, &aeskey);
+    if (res < 0) {
+        return res;
+    }
+    for (; blocks > 0; blocks--) {
+        _decrypt_block(&aeskey, input, output);
+        input += AES_BLOCK_SIZE;
+        output += AES_BLOCK_SIZE;
+    }
+    return 1;
+}
+
+int aes_encrypt_chain(const cipher_context_t *context, uint8_t *chain,
+                      const uint8_t *input, uint8_t *output, size_t blocks)
+{
+    int res;
+    AES_KEY aeskey;
+
+#ifdef AES_NI
+    if (_aes_ni_supported()) {
+        _ni_encrypt_chain(context->context, chain, input, output, blocks);
+        return 1;
+    }
+#endif
+    /* expand the key only once for all blocks */
+    res = aes_set_encrypt_key((unsigned char *)context->context,
+                              AES_KEY_SIZE * 8, &aeskey);
+    if (res < 0) {
+        return res;
+    }
+    for (; blocks > 0; blocks--) {
+        for (unsigned i = 0; i < AES_BLOCK_SIZE; i++) {
+            chain[i] ^= input[i];
+        }
+        _encrypt_block(&aeskey, chain, chain);
+        if (output) {
+            memcpy(output, chain, AES_BLOCK_SIZE);
+            output += AES_BLOCK_SIZE;
+        }
+        input += AES_BLOCK_SIZE;
+    }
     return 1;
 }
 
@@ -46,6 +46,80 @@ int cipher_decrypt(const cipher_t *cipher, const uint8_t *input,
 }
 
 
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t blocks)
+{
+    const cipher_interface_t *interface = cipher->interface;
+
+    if (interface->encrypt_blocks) {
+        return interface->encrypt_blocks(&cipher->context, input, output,
+                                         blocks);
+    }
+    for (size_t i = 0; i < blocks; i++) {
+        int res = interface->encrypt(&cipher->context, input, output);
+
+        if (res != 1) {
+            return res;
+        }
+        input += interface->block_size;
+        output += interface->block_size;
+    }
+    return 1;
+}
+
+
+int cipher_decrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t blocks)
+{
+    const cipher_interface_t *interface = cipher->interface;
+
+    if (interface->decrypt_blocks) {
+        return interface->decrypt_blocks(&cipher->context, input, output,
+                                         blocks);
+    }
+    for (size_t i = 0; i < blocks; i++) {
+        int res = interface->decrypt(&cipher->context, input, output);
+
+        if (res != 1) {
+            return res;
+        }
+        input += interface->block_size;
+        output += interface->block_size;
+    }
+    return 1;
+}
+
+
+int cipher_encrypt_chain(const cipher_t *cipher, uint8_t *chain,
+                         const uint8_t *input, uint8_t *output, size_t blocks)
+{
+    const cipher_interface_t *interface = cipher->interface;
+    uint8_t block_size = interface->block_size;
+
+    if (interface->encrypt_chain) {
+        return interface->encrypt_chain(&cipher->context, chain, input, output,
+                                        blocks);
+    }
+    for (size_t i = 0; i < blocks; i++) {
+        int res;
+
+        for (uint8_t j = 0; j < block_size; j++) {
+            chain[j] ^= input[j];
+        }
+        res = interface->encrypt(&cipher->context, chain, chain);
+        if (res != 1) {
+            return res;
+        }
+        if (output) {
+            memcpy(output, chain, block_size);
+            output += block_size;
+        }
+        input += block_size;
+    }
+    return 1;
+}
+
+
 int cipher_get_block_size(const cipher_t *cipher)
 {
     return cipher->interface->block_size;
@@ -37,36 +37,37 @@ static inline int min(int a, int b)
 static int ccm_compute_cbc_mac(cipher_t *cipher, const uint8_t iv[16],
                         const uint8_t *input, size_t length, uint8_t *mac)
 {
-    uint8_t block_size, mac_enc[16] = { 0 };
-    uint32_t offset;
+    uint8_t block_size, remainder;
+    size_t blocks;
 
     block_size = cipher_get_block_size(cipher);
     memmove(mac, iv, 16);
-    offset = 0;
 
     /* no input message */
     if(length == 0) {
         return 0;
     }
 
-    do {
-        uint8_t block_size_input = (length - offset > block_size) ?
-                                   block_size : length - offset;
+    /* CBC-Mode: XOR plaintext with ciphertext of (n-1)-th block */
+    blocks = length / block_size;
+    if (cipher_encrypt_chain(cipher, mac, input, NULL, blocks) != 1) {
+        return CIPHER_ERR_ENC_FAILED;
+    }
 
-        /* CBC-Mode: XOR plaintext with ciphertext of (n-1)-th block */
-        for (int i = 0; i < block_size_input; ++i) {
-            mac[i] ^= input[offset + i];
+    /* last block is padded with zeros */
+    remainder = length % block_size;
+    if (remainder > 0) {
+        input += blocks * block_size;
+        for (int i = 0; i < remainder; ++i) {
+            mac[i] ^= input[i];
         }
 
-        if (cipher_encrypt(cipher, mac, mac_enc) != 1) {
+        if (cipher_encrypt(cipher, mac, mac) != 1) {
             return CIPHER_ERR_ENC_FAILED;
         }
+    }
 
-        memcpy(mac, mac_enc, block_size);
-        offset += block_size_input;
-    } while (offset < length);
-
-    return offset;
+    return length;
 }
 
 
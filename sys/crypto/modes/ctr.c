@@ -18,32 +18,64 @@
  * @}
  */
 
+#include <string.h>
+
 #include "crypto/helper.h"
 #include "crypto/modes/ctr.h"
 
+/**
+ * @brief   Number of key stream blocks generated with one call to the cipher
+ */
+#define CTR_STREAM_BLOCKS   (4U)
+
+static void _xor(uint8_t *output, const uint8_t *input, const uint8_t *stream,
+                 size_t length)
+{
+    for (; length >= sizeof(uint32_t); length -= sizeof(uint32_t)) {
+        uint32_t in, key;
+
+        memcpy(&in, input, sizeof(in));
+        memcpy(&key, stream, sizeof(key));
+        in ^= key;
+        memcpy(output, &in, sizeof(in));
+        output += sizeof(uint32_t);
+        input += sizeof(uint32_t);
+        stream += sizeof(uint32_t);
+    }
+    for (size_t i = 0; i < length; i++) {
+        output[i] = input[i] ^ stream[i];
+    }
+}
+
 int cipher_encrypt_ctr(cipher_t *cipher, uint8_t nonce_counter[16],
                        uint8_t nonce_len, const uint8_t *input, size_t length,
                        uint8_t *output)
 {
     size_t offset = 0;
-    uint8_t stream_block[16] = { 0 }, block_size;
+    uint8_t stream[CTR_STREAM_BLOCKS * CIPHER_MAX_BLOCK_SIZE], block_size;
 
     block_size = cipher_get_block_size(cipher);
     do {
-        uint8_t block_size_input;
+        size_t stream_len = 0, remaining = length - offset;
+        unsigned blocks = 0;
 
-        if (cipher_encrypt(cipher, nonce_counter, stream_block) != 1) {
+        /* collect the counter blocks for the next part of the key stream */
+        do {
+            memcpy(&stream[stream_len], nonce_counter, block_size);
+            crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
+            stream_len += block_size;
+            blocks++;
+        } while ((blocks < CTR_STREAM_BLOCKS) && (stream_len < remaining));
+
+        if (cipher_encrypt_blocks(cipher, stream, stream, blocks) != 1) {
             return CIPHER_ERR_ENC_FAILED;
         }
 
-        block_size_input = (length - offset > block_size) ?
-                           block_size : length - offset;
-        for (uint8_t i = 0; i < block_size_input; ++i) {
-            output[offset + i] = stream_block[i] ^ input[offset + i];
+        if (stream_len > remaining) {
+            stream_len = remaining;
         }
-
-        offset += block_size_input;
-        crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
+        _xor(output + offset, input + offset, stream, stream_len);
+        offset += stream_len;
     } while (offset < length);
 
     return offset;
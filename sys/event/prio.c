@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @{
+ *
+ * @file
+ * @brief       Priority event queue implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "bitarithm.h"
+#include "event/prio.h"
+#include "irq.h"
+#include "thread_flags.h"
+
+static_assert(CONFIG_EVENT_PRIO_NUMOF <= 8 * sizeof(unsigned),
+              "CONFIG_EVENT_PRIO_NUMOF must fit into event_prio_queue_t::used");
+
+/* must be called with interrupts disabled */
+static void _remove(event_prio_queue_t *queue, event_prio_t *event)
+{
+    unsigned prio = event->prio;
+
+    if (event->next == event) {
+        /* last event in the lane */
+        queue->lanes[prio] = NULL;
+        queue->used &= ~(1U << prio);
+    }
+    else {
+        event->prev->next = event->next;
+        event->next->prev = event->prev;
+        if (queue->lanes[prio] == event) {
+            queue->lanes[prio] = event->next;
+        }
+    }
+    event->next = NULL;
+    event->prev = NULL;
+}
+
+void event_prio_post(event_prio_queue_t *queue, event_prio_t *event,
+                     unsigned prio)
+{
+    assert(queue && event && (prio < CONFIG_EVENT_PRIO_NUMOF));
+
+    unsigned state = irq_disable();
+    if (!event->next) {
+        event_prio_t *first = queue->lanes[prio];
+
+        event->prio = prio;
+        if (first) {
+            /* append, the last event is the one before the first */
+            event->prev = first->prev;
+            event->next = first;
+            first->prev->next = event;
+            first->prev = event;
+        }
+        else {
+            event->prev = event;
+            event->next = event;
+            queue->lanes[prio] = event;
+            queue->used |= 1U << prio;
+        }
+    }
+    thread_t *waiter = queue->waiter;
+    irq_restore(state);
+
+    if (waiter) {
+        thread_flags_set(waiter, THREAD_FLAG_EVENT);
+    }
+}
+
+void event_prio_cancel(event_prio_queue_t *queue, event_prio_t *event)
+{
+    assert(queue && event);
+
+    unsigned state = irq_disable();
+    if (event->next) {
+        assert(queue->used & (1U << event->prio));
+        _remove(queue, event);
+    }
+    irq_restore(state);
+}
+
+event_prio_t *event_prio_get(event_prio_queue_t *queue)
+{
+    assert(queue);
+    event_prio_t *result = NULL;
+
+    unsigned state = irq_disable();
+    if (queue->used) {
+        result = queue->lanes[bitarithm_lsb(queue->used)];
+        _remove(queue, result);
+    }
+    irq_restore(state);
+
+    return result;
+}
+
+event_prio_t *event_prio_wait(event_prio_queue_t *queue)
+{
+    event_prio_t *result;
+
+    while ((result = event_prio_get(queue)) == NULL) {
+        thread_flags_wait_any(THREAD_FLAG_EVENT);
+    }
+    return result;
+}
+
+size_t event_prio_drain(event_prio_queue_t *queue, size_t max)
+{
+    size_t numof = 0;
+    event_prio_t *event;
+
+    while ((numof < max) && (event = event_prio_get(queue))) {
+        event->super.handler(&event->super);
+        numof++;
+    }
+    return numof;
+}
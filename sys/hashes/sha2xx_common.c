@@ -46,11 +46,20 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <assert.h>
 
 #include "hashes/sha2xx_common.h"
 
+#if defined(CPU_NATIVE) && (defined(__i386__) || defined(__x86_64__)) && \
+    !defined(MODULE_HASHES_SHA2XX_PERIPH)
+/* the host may support the SHA extensions even if the compiler was not told
+ * so, so their availability is checked at runtime */
+#include <immintrin.h>
+#define SHA2XX_NI
+#endif
+
 
 #ifdef __BIG_ENDIAN__
 /* Copy a vector of big-endian uint32_t into a vector of bytes */
@@ -97,6 +106,65 @@ static void be32enc_vect(void *dst_, const void *src_, size_t len)
 
 #endif /* __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__ */
 
+#ifndef MODULE_HASHES_SHA2XX_PERIPH
+#ifdef MODULE_HASHES_SHA2XX_UNROLL
+/* one round with the roles of the working variables passed in, so they don't
+ * need to be shifted */
+#define ROUND(a, b, c, d, e, f, g, h, i) \
+    do { \
+        uint32_t t0 = h + S1(e) + Ch(e, f, g) + W[i] + K[i]; \
+        d += t0; \
+        h = t0 + S0(a) + Maj(a, b, c); \
+    } while (0)
+
+/*
+ * SHA256 block compression function.  The 256-bit state is transformed via
+ * the 512-bit input block to produce a new state.
+ */
+static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
+{
+    uint32_t W[64];
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    /* 1. Prepare message schedule W. */
+    for (int i = 0; i < 16; i++) {
+        uint32_t word;
+
+        memcpy(&word, &block[i * 4], sizeof(word));
+#ifdef __BIG_ENDIAN__
+        W[i] = word;
+#else
+        W[i] = __builtin_bswap32(word);
+#endif
+    }
+    for (int i = 16; i < 64; i++) {
+        W[i] = s1(W[i - 2]) + W[i - 7] + s0(W[i - 15]) + W[i - 16];
+    }
+
+    /* 2. Mix, after 8 rounds the working variables are back in place. */
+    for (int i = 0; i < 64; i += 8) {
+        ROUND(a, b, c, d, e, f, g, h, i);
+        ROUND(h, a, b, c, d, e, f, g, i + 1);
+        ROUND(g, h, a, b, c, d, e, f, i + 2);
+        ROUND(f, g, h, a, b, c, d, e, i + 3);
+        ROUND(e, f, g, h, a, b, c, d, i + 4);
+        ROUND(d, e, f, g, h, a, b, c, i + 5);
+        ROUND(c, d, e, f, g, h, a, b, i + 6);
+        ROUND(b, c, d, e, f, g, h, a, i + 7);
+    }
+
+    /* 3. Mix local working variables into global state */
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+#else /* MODULE_HASHES_SHA2XX_UNROLL */
 /*
  * SHA256 block compression function.  The 256-bit state is transformed via
  * the 512-bit input block to produce a new state.
@@ -134,6 +202,93 @@ static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
         state[i] += S[i];
     }
 }
+#endif /* MODULE_HASHES_SHA2XX_UNROLL */
+
+#ifdef SHA2XX_NI
+static bool _sha_ni_supported(void)
+{
+    static int supported = -1;
+
+    if (supported < 0) {
+        __builtin_cpu_init();
+        supported = __builtin_cpu_supports("sha") &&
+                    __builtin_cpu_supports("sse4.1");
+    }
+    return supported;
+}
+
+/* SHA-256 with the x86 SHA extensions, four rounds per step */
+__attribute__((target("sha,sse4.1")))
+static void _transform_ni(uint32_t *state, const unsigned char *data,
+                          size_t blocks)
+{
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                         0x0405060700010203ULL);
+    __m128i state0, state1, tmp;
+
+    /* the instructions expect the state as ABEF and CDGH */
+    tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[0]), 0xb1);
+    state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[4]),
+                               0x1b);
+    state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xf0);
+
+    for (; blocks > 0; blocks--, data += 64) {
+        const __m128i abef = state0, cdgh = state1;
+        __m128i msg[4];
+
+        for (unsigned i = 0; i < 16; i++) {
+            __m128i wk;
+
+            if (i < 4) {
+                msg[i] = _mm_shuffle_epi8(
+                    _mm_loadu_si128((const __m128i *)&data[i * 16]), bswap);
+            }
+            wk = _mm_add_epi32(msg[i % 4],
+                               _mm_loadu_si128((const __m128i *)&K[i * 4]));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, wk);
+            if ((i >= 3) && (i < 15)) {
+                /* finish the next four words of the message schedule */
+                tmp = _mm_alignr_epi8(msg[i % 4], msg[(i + 3) % 4], 4);
+                msg[(i + 1) % 4] = _mm_add_epi32(msg[(i + 1) % 4], tmp);
+                msg[(i + 1) % 4] = _mm_sha256msg2_epu32(msg[(i + 1) % 4],
+                                                        msg[i % 4]);
+            }
+            state0 = _mm_sha256rnds2_epu32(state0, state1,
+                                           _mm_shuffle_epi32(wk, 0x0e));
+            if ((i >= 1) && (i < 13)) {
+                msg[(i + 3) % 4] = _mm_sha256msg1_epu32(msg[(i + 3) % 4],
+                                                        msg[i % 4]);
+            }
+        }
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+    }
+
+    /* back to ABCD and EFGH */
+    tmp = _mm_shuffle_epi32(state0, 0x1b);
+    state1 = _mm_shuffle_epi32(state1, 0xb1);
+    _mm_storeu_si128((__m128i *)&state[0], _mm_blend_epi16(tmp, state1, 0xf0));
+    _mm_storeu_si128((__m128i *)&state[4], _mm_alignr_epi8(state1, tmp, 8));
+}
+#endif /* SHA2XX_NI */
+
+void sha2xx_transform_blocks(uint32_t *state, const void *data, size_t blocks)
+{
+    const unsigned char *block = data;
+
+#ifdef SHA2XX_NI
+    if (_sha_ni_supported()) {
+        _transform_ni(state, block, blocks);
+        return;
+    }
+#endif
+    for (; blocks > 0; blocks--) {
+        sha2xx_transform(state, block);
+        block += 64;
+    }
+}
+#endif /* !MODULE_HASHES_SHA2XX_PERIPH */
 
 static unsigned char PAD[64] = {
     0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -191,15 +346,15 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
     const unsigned char *src = data;
 
     memcpy(&ctx->buf[r], src, 64 - r);
-    sha2xx_transform(ctx->state, ctx->buf);
+    sha2xx_transform_blocks(ctx->state, ctx->buf, 1);
     src += 64 - r;
     len -= 64 - r;
 
-    /* Perform complete blocks */
-    while (len >= 64) {
-        sha2xx_transform(ctx->state, src);
-        src += 64;
-        len -= 64;
+    /* Perform complete blocks at once */
+    if (len >= 64) {
+        sha2xx_transform_blocks(ctx->state, src, len / 64);
+        src += len & ~(size_t)0x3f;
+        len &= 0x3f;
     }
 
     /* Copy left over data into buffer */
@@ -126,6 +126,65 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
 int aes_decrypt(const cipher_context_t *context, const uint8_t *cipher_block,
                 uint8_t *plain_block);
 
+/**
+ * @brief   encrypts multiple consecutive blocks independently, expanding the
+ *          key only once
+ *
+ * @see     cipher_encrypt_blocks()
+ *
+ * @param       context   the cipher_context_t-struct to use for this
+ *                        encryption
+ * @param       input     the plaintext of size @p blocks * AES_BLOCK_SIZE
+ * @param       output    memory for the ciphertext of size
+ *                        @p blocks * AES_BLOCK_SIZE, may be equal to @p input
+ * @param       blocks    number of blocks
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t blocks);
+
+/**
+ * @brief   decrypts multiple consecutive blocks independently, expanding the
+ *          key only once
+ *
+ * @see     cipher_decrypt_blocks()
+ *
+ * @param       context   the cipher_context_t-struct to use for this
+ *                        decryption
+ * @param       input     the ciphertext of size @p blocks * AES_BLOCK_SIZE
+ * @param       output    memory for the plaintext of size
+ *                        @p blocks * AES_BLOCK_SIZE, may be equal to @p input
+ * @param       blocks    number of blocks
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded
+ */
+int aes_decrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t blocks);
+
+/**
+ * @brief   encrypts multiple consecutive blocks in CBC mode, expanding the
+ *          key only once
+ *
+ * @see     cipher_encrypt_chain()
+ *
+ * @param       context   the cipher_context_t-struct to use for this
+ *                        encryption
+ * @param       chain     the initialization vector or last ciphertext block,
+ *                        updated to the last ciphertext block
+ * @param       input     the plaintext of size @p blocks * AES_BLOCK_SIZE
+ * @param       output    memory for the ciphertext of size
+ *                        @p blocks * AES_BLOCK_SIZE or NULL
+ * @param       blocks    number of blocks
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded
+ */
+int aes_encrypt_chain(const cipher_context_t *context, uint8_t *chain,
+                      const uint8_t *input, uint8_t *output, size_t blocks);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,7 @@
 #ifndef CRYPTO_CIPHERS_H
 #define CRYPTO_CIPHERS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -89,6 +90,27 @@ typedef struct cipher_interface_st {
     /** the decrypt function */
     int (*decrypt)(const cipher_context_t *ctx, const uint8_t *cipher_block,
                    uint8_t *plain_block);
+
+    /**
+     * @brief   encrypts consecutive blocks independently (optional, may be
+     *          NULL), see @ref cipher_encrypt_blocks()
+     */
+    int (*encrypt_blocks)(const cipher_context_t *ctx, const uint8_t *input,
+                          uint8_t *output, size_t blocks);
+
+    /**
+     * @brief   decrypts consecutive blocks independently (optional, may be
+     *          NULL), see @ref cipher_decrypt_blocks()
+     */
+    int (*decrypt_blocks)(const cipher_context_t *ctx, const uint8_t *input,
+                          uint8_t *output, size_t blocks);
+
+    /**
+     * @brief   encrypts consecutive blocks in CBC mode (optional, may be
+     *          NULL), see @ref cipher_encrypt_chain()
+     */
+    int (*encrypt_chain)(const cipher_context_t *ctx, uint8_t *chain,
+                         const uint8_t *input, uint8_t *output, size_t blocks);
 } cipher_interface_t;
 
 
@@ -162,6 +184,69 @@ int cipher_decrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output);
 
 
+/**
+ * @brief Encrypt multiple consecutive blocks independently of each other
+ *
+ * Same as calling @ref cipher_encrypt() for each block, but ciphers may
+ * implement it more efficiently, e.g. by preparing the key only once.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to input data of size @p blocks * BLOCK_SIZE
+ * @param output     pointer to allocated memory for encrypted data of size
+ *                   @p blocks * BLOCK_SIZE. May be equal to @p input, but
+ *                   must not overlap it otherwise.
+ * @param blocks     number of blocks
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t blocks);
+
+
+/**
+ * @brief Decrypt multiple consecutive blocks independently of each other
+ *
+ * Same as calling @ref cipher_decrypt() for each block, but ciphers may
+ * implement it more efficiently, e.g. by preparing the key only once.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to input data of size @p blocks * BLOCK_SIZE
+ * @param output     pointer to allocated memory for decrypted data of size
+ *                   @p blocks * BLOCK_SIZE. May be equal to @p input, but
+ *                   must not overlap it otherwise.
+ * @param blocks     number of blocks
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_decrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t blocks);
+
+
+/**
+ * @brief Encrypt multiple consecutive blocks in CBC mode
+ *
+ * Every block of @p input is XORed with @p chain before it is encrypted, the
+ * result is the next value of @p chain. This gives CBC encryption and, with
+ * @p output set to NULL, a CBC-MAC.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param chain      BLOCK_SIZE bytes with the initialization vector or the
+ *                   last encrypted block, updated to the last block encrypted
+ * @param input      pointer to input data of size @p blocks * BLOCK_SIZE
+ * @param output     pointer to allocated memory for encrypted data of size
+ *                   @p blocks * BLOCK_SIZE or NULL if only @p chain is of
+ *                   interest
+ * @param blocks     number of blocks
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_encrypt_chain(const cipher_t *cipher, uint8_t *chain,
+                         const uint8_t *input, uint8_t *output, size_t blocks);
+
+
 /**
  * @brief Get block size of cipher
  * *
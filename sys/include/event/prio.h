@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @brief       Event queues with priorities and constant time cancellation
+ *
+ * A priority event queue (@ref event_prio_queue_t) has
+ * @ref CONFIG_EVENT_PRIO_NUMOF lanes, each of them a FIFO of events. An event
+ * is posted to a lane, events in a lane with a lower number are always
+ * handled first (like with thread priorities, 0 is the highest priority).
+ * Picking the next event takes constant time, independent of the number of
+ * lanes, in contrast to @ref event_wait_multi which checks one queue after
+ * the other.
+ *
+ * The events (@ref event_prio_t) are doubly linked, so
+ * @ref event_prio_cancel takes constant time as well. This makes them a good
+ * fit for events that are cancelled frequently, e.g. timeouts.
+ *
+ * @ref event_prio_drain handles a burst of events after a single wakeup of
+ * the thread, @ref event_prio_loop is built on it.
+ *
+ * The handler of an event is called with a pointer to its
+ * event_prio_t::super, so extending @ref event_prio_t works like extending
+ * @ref event_t. Events of type @ref event_t (e.g. @ref event_callback_t) can
+ * not be posted to priority queues.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static void handler(event_t *event)
+ * {
+ *     event_prio_t *ev = container_of(event, event_prio_t, super);
+ *     ...
+ * }
+ *
+ * static event_prio_t rx_event = EVENT_PRIO_INIT(handler);
+ * static event_prio_t housekeeping = EVENT_PRIO_INIT(handler);
+ * static event_prio_queue_t queue;
+ *
+ * int main(void)
+ * {
+ *     event_prio_queue_init(&queue);
+ *     event_prio_loop(&queue);
+ * }
+ *
+ * [...] event_prio_post(&queue, &rx_event, 0);
+ * [...] event_prio_post(&queue, &housekeeping, 3);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Priority event queue API
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef EVENT_PRIO_H
+#define EVENT_PRIO_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of priorities (lanes) of a priority event queue
+ *
+ * @note    Must not be larger than the number of bits in an `unsigned int`.
+ */
+#ifndef CONFIG_EVENT_PRIO_NUMOF
+#define CONFIG_EVENT_PRIO_NUMOF     (4U)
+#endif
+
+/**
+ * @brief   Priority event structure forward declaration
+ */
+typedef struct event_prio event_prio_t;
+
+/**
+ * @brief   Event that can be posted to a priority event queue
+ */
+struct event_prio {
+    event_t super;              /**< the event, handed to the handler       */
+    event_prio_t *next;         /**< next event in the lane, NULL if the
+                                 *   event is not queued                    */
+    event_prio_t *prev;         /**< previous event in the lane             */
+    uint8_t prio;               /**< lane the event is queued in            */
+};
+
+/**
+ * @brief   Priority event queue structure
+ */
+typedef struct {
+    event_prio_t *lanes[CONFIG_EVENT_PRIO_NUMOF]; /**< oldest event of each
+                                                   *   lane, the lanes are
+                                                   *   circular lists      */
+    unsigned used;              /**< bit n is set if lane n is not empty    */
+    thread_t *waiter;           /**< thread owning the queue                */
+} event_prio_queue_t;
+
+/**
+ * @brief   event_prio_t static initializer
+ *
+ * @param[in]   _handler    event handler to set
+ */
+#define EVENT_PRIO_INIT(_handler)   { .super.handler = _handler }
+
+/**
+ * @brief   event_prio_queue_t static initializer
+ */
+#define EVENT_PRIO_QUEUE_INIT       { .waiter = thread_get_active() }
+
+/**
+ * @brief   static initializer for detached priority event queues
+ */
+#define EVENT_PRIO_QUEUE_INIT_DETACHED  { .waiter = NULL }
+
+/**
+ * @brief   Initialize a priority event queue
+ *
+ * This will set the calling thread as owner of @p queue.
+ *
+ * @param[out]  queue   queue to initialize
+ */
+static inline void event_prio_queue_init(event_prio_queue_t *queue)
+{
+    assert(queue);
+    memset(queue, 0, sizeof(*queue));
+    queue->waiter = thread_get_active();
+}
+
+/**
+ * @brief   Initialize a priority event queue not binding it to a thread
+ *
+ * @param[out]  queue   queue to initialize
+ */
+static inline void event_prio_queue_init_detached(event_prio_queue_t *queue)
+{
+    assert(queue);
+    memset(queue, 0, sizeof(*queue));
+}
+
+/**
+ * @brief   Bind a priority event queue to the calling thread
+ *
+ * @pre     (queue->waiter == NULL)
+ *
+ * @param[out]  queue   queue to bind to the calling thread
+ */
+static inline void event_prio_queue_claim(event_prio_queue_t *queue)
+{
+    assert(queue && (queue->waiter == NULL));
+    queue->waiter = thread_get_active();
+}
+
+/**
+ * @brief   Queue an event
+ *
+ * The event is appended to lane @p prio of @p queue. If the event is already
+ * queued, it is not touched and keeps its position and lane, like with
+ * @ref event_post.
+ *
+ * Can be called from ISRs.
+ *
+ * @param[in]   queue   queue to post the event to
+ * @param[in]   event   event to post
+ * @param[in]   prio    lane to post the event to, lower is more urgent,
+ *                      less than @ref CONFIG_EVENT_PRIO_NUMOF
+ */
+void event_prio_post(event_prio_queue_t *queue, event_prio_t *event,
+                     unsigned prio);
+
+/**
+ * @brief   Cancel a queued event
+ *
+ * Runs in constant time. Cancelling an event that is not queued has no
+ * effect.
+ *
+ * @pre     @p event is not queued in another queue than @p queue
+ *
+ * @param[in]   queue   queue to remove the event from
+ * @param[in]   event   event to remove
+ */
+void event_prio_cancel(event_prio_queue_t *queue, event_prio_t *event);
+
+/**
+ * @brief   Get the most urgent event from a priority queue, non-blocking
+ *
+ * @param[in]   queue   queue to get the event from
+ *
+ * @returns     the oldest event of the most urgent non-empty lane
+ * @returns     NULL if no event is queued
+ */
+event_prio_t *event_prio_get(event_prio_queue_t *queue);
+
+/**
+ * @brief   Get the most urgent event from a priority queue, blocking
+ *
+ * @warning There can only be a single waiter on a queue!
+ *
+ * @param[in]   queue   queue to get the event from
+ *
+ * @returns     the oldest event of the most urgent non-empty lane
+ */
+event_prio_t *event_prio_wait(event_prio_queue_t *queue);
+
+/**
+ * @brief   Handle up to @p max queued events, non-blocking
+ *
+ * The events are taken out of the queue one by one, so an urgent event posted
+ * while handling the burst is handled next.
+ *
+ * @param[in]   queue   queue to handle the events of
+ * @param[in]   max     maximum number of events to handle
+ *
+ * @returns     number of events handled, 0 if the queue was empty
+ */
+size_t event_prio_drain(event_prio_queue_t *queue, size_t max);
+
+/**
+ * @brief   Event loop of a priority event queue
+ *
+ * Waits for events and handles them forever. After a wakeup, all queued
+ * events are handled before waiting for the thread flag again.
+ *
+ * @param[in]   queue   queue to handle the events of
+ */
+static inline void event_prio_loop(event_prio_queue_t *queue)
+{
+    while (1) {
+        if (!event_prio_drain(queue, SIZE_MAX)) {
+            thread_flags_wait_any(THREAD_FLAG_EVENT);
+        }
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* EVENT_PRIO_H */
+/** @} */
@@ -129,6 +129,21 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len);
  */
 void sha2xx_final(sha2xx_context_t *ctx, void *digest, size_t dig_len);
 
+/**
+ * @brief Apply the SHA-2XX block compression function to consecutive blocks
+ *
+ * Called by sha2xx_update() with all complete blocks at once. A software
+ * implementation is used by default, the unrolled variant with module
+ * `hashes_sha2xx_unroll`. On `native`, the x86 SHA extensions are used if the
+ * host CPU supports them. With module `hashes_sha2xx_periph` this function
+ * is not provided, so e.g. the CPU can implement it with a hash peripheral.
+ *
+ * @param state   the eight 32-bit words of the hash state to update
+ * @param data    @p blocks * 64 bytes of input
+ * @param blocks  number of 64-byte blocks in @p data
+ */
+void sha2xx_transform_blocks(uint32_t *state, const void *data, size_t blocks);
+
 #ifdef __cplusplus
 }
 #endif
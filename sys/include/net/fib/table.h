@@ -19,8 +19,10 @@
 #ifndef NET_FIB_TABLE_H
 #define NET_FIB_TABLE_H
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include "bitfield.h"
 #include "kernel_types.h"
 #include "universal_address.h"
 #include "mutex.h"
@@ -35,10 +37,30 @@ extern "C" {
  */
 #define FIB_MAX_REGISTERED_RP (5)
 
+/**
+ * @brief number of distinct prefix lengths a FIB table can hold
+ *        (0 to UNIVERSAL_ADDRESS_SIZE * 8 bits)
+ */
+#define FIB_PREFIX_LEN_NUMOF ((UNIVERSAL_ADDRESS_SIZE << 3) + 1)
+
+/**
+ * @brief Node of the expiry heap of a FIB table, embedded in every FIB entry
+ *        and source route
+ *
+ * The heap array is distributed over the entries of the table: the node of
+ * the entry at array position `i` holds the `i`-th element of the heap.
+ */
+typedef struct fib_expiry {
+    /** Entry at the same array position as this one in the expiry heap */
+    struct fib_expiry *heap;
+    /** Position of this entry in the expiry heap plus 1, 0 if not in it */
+    size_t heap_pos;
+} fib_expiry_t;
+
 /**
  * @brief Container descriptor for a FIB entry
  */
-typedef struct {
+typedef struct fib_entry {
     /** interface ID */
     kernel_pid_t iface_id;
     /** Lifetime of this entry (an absolute time-point is stored by the FIB) */
@@ -51,6 +73,13 @@ typedef struct {
     uint32_t next_hop_flags;
     /** Pointer to the shared generic address */
     universal_address_container_t *next_hop;
+    /** Next entry in the same bucket of the prefix hash index */
+    struct fib_entry *hash_next;
+    /** First entry of the prefix hash index bucket with the same array
+     *  position as this entry */
+    struct fib_entry *bucket;
+    /** Expiry heap node of this entry */
+    fib_expiry_t expiry;
 } fib_entry_t;
 
 /**
@@ -66,7 +95,7 @@ typedef struct fib_sr_entry {
 /**
 * @brief Container descriptor for a FIB source route
 */
-typedef struct {
+typedef struct fib_sr {
     /** interface ID */
     kernel_pid_t sr_iface_id;
     /** Lifetime of this entry (an absolute time-point is stored by the FIB) */
@@ -77,6 +106,13 @@ typedef struct {
     fib_sr_entry_t *sr_path;
     /** Pointer to the destination of the source route */
     fib_sr_entry_t *sr_dest;
+    /** Next source route in the same bucket of the destination hash index */
+    struct fib_sr *hash_next;
+    /** First source route of the destination hash index bucket with the same
+     *  array position as this source route */
+    struct fib_sr *bucket;
+    /** Expiry heap node of this source route */
+    fib_expiry_t expiry;
 } fib_sr_t;
 
 /**
@@ -133,6 +169,18 @@ typedef struct {
     *   e.g. when the unreachable destination is covered by the prefix
     */
     universal_address_container_t* prefix_rp[FIB_MAX_REGISTERED_RP];
+    /** number of entries with a finite lifetime, i.e. in the expiry heap
+    *   ordered by their absolute lifetime
+    */
+    size_t expiry_numof;
+    /** prefix lengths (in bits) used by single hop entries, may contain
+    *   lengths no longer in use
+    */
+    BITFIELD(prefix_lens, FIB_PREFIX_LEN_NUMOF);
+    /** number of single hop entries removed since fib_table_t::prefix_lens
+    *   was last recalculated
+    */
+    size_t prefix_lens_stale;
 } fib_table_t;
 
 #ifdef __cplusplus
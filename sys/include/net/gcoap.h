@@ -58,6 +58,16 @@
  * lists all of the registered paths. See the _Resource list creation_ section
  * below for more.
  *
+ * By default gcoap finds the resource for a request by comparing its path to
+ * all registered resources one after another. For servers with many resources
+ * add the `gcoap_resource_trie` module to index the resources of all listeners
+ * in a radix trie instead. The Uri-Path options of a request are then matched
+ * directly from the PDU, so lookup time depends on the length of the path
+ * rather than the number of resources, and paths are no longer limited to
+ * @ref CONFIG_NANOCOAP_URI_MAX. Up to @ref CONFIG_GCOAP_RESOURCE_TRIE_NUMOF
+ * resources are indexed; with more resources gcoap falls back to the linear
+ * search. The resources of a registered listener must not change.
+ *
  * ### Creating a response ###
  *
  * An application resource includes a callback function, a coap_handler_t. After
@@ -348,6 +358,20 @@
  * times out. We track the response with an entry in the
  * `_coap_state.open_reqs` array.
  *
+ * ### Matching responses and observers ###
+ *
+ * By default gcoap compares a response to every open request and looks up
+ * observers and observe registrations by scanning their arrays. If
+ * @ref CONFIG_GCOAP_REQ_WAITING_MAX or @ref CONFIG_GCOAP_OBS_REGISTRATIONS_MAX
+ * are raised considerably, add the `gcoap_memo_hash` module. It indexes open
+ * requests by token and remote endpoint, observers by endpoint and observe
+ * registrations by token and by resource in hash tables of
+ * 2^@ref CONFIG_GCOAP_MEMO_HASH_BUCKETS_EXP buckets each. It also keeps the
+ * observe registrations of every observer and the free observers and
+ * registrations in lists. Matching a response, registering and deregistering
+ * observers and gcoap_obs_send() then no longer depend on the number of
+ * entries.
+ *
  * ## Implementation Status ##
  * gcoap includes server and client capability. Available features include:
  *
@@ -578,6 +602,26 @@ extern "C" {
 #define CONFIG_GCOAP_RESEND_BUFS_MAX      (1)
 #endif
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Maximum number of resources of all listeners, including
+ *          `/.well-known/core`, indexed by the `gcoap_resource_trie` module
+ *
+ * Each resource costs one entry and up to two trie nodes of static memory.
+ */
+#ifndef CONFIG_GCOAP_RESOURCE_TRIE_NUMOF
+#define CONFIG_GCOAP_RESOURCE_TRIE_NUMOF  (64)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of buckets, as exponent of two, of each hash table of the
+ *          `gcoap_memo_hash` module
+ */
+#ifndef CONFIG_GCOAP_MEMO_HASH_BUCKETS_EXP
+#define CONFIG_GCOAP_MEMO_HASH_BUCKETS_EXP  (4)
+#endif
+
 /**
  * @name Bitwise positional flags for encoding resource links
  * @anchor COAP_LINK_FLAG_
@@ -81,6 +81,10 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_DNS                      1
 #endif
 
+#ifdef MODULE_GNRC_IPV6_NIB_OFFL_TRIE
+#define CONFIG_GNRC_IPV6_NIB_OFFL_TRIE                1
+#endif
+
 /**
  * @name    Compile flags
  * @brief   Compile flags to (de-)activate certain features for NIB
@@ -193,6 +197,18 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_DNS                      0
 #endif
 
+/**
+ * @brief   Index off-link entries in a path-compressed binary trie
+ *
+ * Makes the longest-prefix match in the forwarding table independent of
+ * @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF at the cost of
+ * `2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF` trie nodes of static memory.
+ * Recommended for routers with large forwarding tables.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+#define CONFIG_GNRC_IPV6_NIB_OFFL_TRIE                0
+#endif
+
 /**
  * @brief   Multihop prefix and 6LoWPAN context distribution
  *
@@ -54,6 +54,29 @@
  * USEMODULE += gnrc_netapi_callbacks
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * @}
+ *
+ * @defgroup    net_gnrc_netapi_batch   Batched receive extension
+ * @ingroup     net_gnrc_netapi
+ * @brief       Pass up multiple received packets with a single message
+ * @{
+ * @details The submodule `gnrc_netapi_batch` allows a layer to collect
+ *          received packets for the same subscribers and to pass them on with
+ *          a single @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message, so a burst of
+ *          packets costs one IPC operation per layer instead of one per
+ *          packet. It also keeps bursts from overflowing the message queue of
+ *          the next layer.
+ *
+ *          Only subscribers registered with @ref GNRC_NETREG_TYPE_BATCH
+ *          receive batches. All other subscribers still get one
+ *          @ref GNRC_NETAPI_MSG_TYPE_RCV message per packet.
+ *
+ * To use, add the module `gnrc_netapi_batch` to the `USEMODULE` macro in your
+ * application's Makefile:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_netapi_batch
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * @}
  */
 
 #ifndef NET_GNRC_NETAPI_H
@@ -93,6 +116,29 @@ extern "C" {
  */
 #define GNRC_NETAPI_MSG_TYPE_ACK        (0x0205)
 
+/**
+ * @brief   @ref core_msg type for passing multiple @ref net_gnrc_pkt up the
+ *          network stack at once
+ *
+ * @details msg_t::content::ptr is a packet snip whose data is an array of
+ *          packets, see @ref gnrc_netapi_batch_numof() and
+ *          @ref gnrc_netapi_batch_get(). The receiver takes over the
+ *          packets in the array and needs to release the batch snip itself
+ *          with @ref gnrc_pktbuf_release() when done.
+ *
+ * @note    Only sent to subscribers registered with
+ *          @ref GNRC_NETREG_TYPE_BATCH.
+ */
+#define GNRC_NETAPI_MSG_TYPE_RCV_BATCH  (0x0207)
+
+/**
+ * @brief   Maximum number of packets passed with one
+ *          @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message
+ */
+#ifndef CONFIG_GNRC_NETAPI_BATCH_SIZE
+#define CONFIG_GNRC_NETAPI_BATCH_SIZE   (8U)
+#endif
+
 /**
  * @brief   Data structure to be send for setting (@ref GNRC_NETAPI_MSG_TYPE_SET)
  *          and getting (@ref GNRC_NETAPI_MSG_TYPE_GET) options
@@ -104,6 +150,18 @@ typedef struct {
     uint16_t data_len;          /**< size of the data / the buffer */
 } gnrc_netapi_opt_t;
 
+/**
+ * @brief   Collection of received packets for the same subscribers
+ *
+ * @see     @ref net_gnrc_netapi_batch
+ */
+typedef struct {
+    gnrc_pktsnip_t *pkts[CONFIG_GNRC_NETAPI_BATCH_SIZE];   /**< packets */
+    uint32_t demux_ctx;         /**< demultiplexing context of the packets */
+    gnrc_nettype_t type;        /**< type of the packets */
+    uint8_t numof;              /**< number of packets in gnrc_netapi_batch_t::pkts */
+} gnrc_netapi_batch_t;
+
 /**
  * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_SND or
  *          @ref GNRC_NETAPI_MSG_TYPE_RCV messages
@@ -215,6 +273,87 @@ static inline int gnrc_netapi_dispatch_receive(gnrc_nettype_t type, uint32_t dem
     return gnrc_netapi_dispatch(type, demux_ctx, GNRC_NETAPI_MSG_TYPE_RCV, pkt);
 }
 
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Initializes a batch of received packets
+ *
+ * @param[out] batch    The batch to initialize
+ */
+static inline void gnrc_netapi_batch_init(gnrc_netapi_batch_t *batch)
+{
+    batch->numof = 0;
+}
+
+/**
+ * @brief   Adds a received packet to @p batch for all subscribers to
+ *          (@p type, @p demux_ctx)
+ *
+ * If @p batch already holds packets for other subscribers or is full it is
+ * flushed using @ref gnrc_netapi_batch_flush() first. Otherwise the packets are
+ * passed on with the next call to @ref gnrc_netapi_batch_flush().
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * @param[in,out] batch The batch to add @p pkt to
+ * @param[in] type      Type of the targeted network module
+ * @param[in] demux_ctx Demultiplexing context for @p type
+ * @param[in] pkt       The packet to pass on
+ *
+ * @return  Number of subscribers to (@p type, @p demux_ctx) like
+ *          @ref gnrc_netapi_dispatch_receive(). If 0, @p pkt was not added and
+ *          is still owned by the caller.
+ */
+int gnrc_netapi_batch_dispatch_receive(gnrc_netapi_batch_t *batch,
+                                       gnrc_nettype_t type, uint32_t demux_ctx,
+                                       gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Passes all packets in @p batch on to their subscribers
+ *
+ * Subscribers registered with @ref GNRC_NETREG_TYPE_BATCH get a single
+ * @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message, all others one
+ * @ref GNRC_NETAPI_MSG_TYPE_RCV message per packet.
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * @param[in,out] batch The batch to flush. Empty afterwards.
+ */
+void gnrc_netapi_batch_flush(gnrc_netapi_batch_t *batch);
+
+/**
+ * @brief   Gets the number of packets in a received
+ *          @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * @param[in] batch msg_t::content::ptr of the message
+ *
+ * @return  Number of packets in @p batch
+ */
+static inline unsigned gnrc_netapi_batch_numof(const gnrc_pktsnip_t *batch)
+{
+    return batch->size / sizeof(gnrc_pktsnip_t *);
+}
+
+/**
+ * @brief   Gets a packet from a received @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH
+ *          message
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * @param[in] batch msg_t::content::ptr of the message
+ * @param[in] idx   Index of the packet. Must be lesser than
+ *                  @ref gnrc_netapi_batch_numof()
+ *
+ * @return  The packet at @p idx
+ */
+static inline gnrc_pktsnip_t *gnrc_netapi_batch_get(const gnrc_pktsnip_t *batch,
+                                                    unsigned idx)
+{
+    return ((gnrc_pktsnip_t **)batch->data)[idx];
+}
+#endif
+
 /**
  * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_GET messages and
  *          parsing the returned @ref GNRC_NETAPI_MSG_TYPE_ACK message
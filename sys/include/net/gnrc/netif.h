@@ -182,6 +182,14 @@ typedef struct {
      * @note    Only available with @ref net_gnrc_netif_pktq.
      */
     gnrc_netif_pktq_t send_queue;
+#endif
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   Received packets not yet passed up the stack
+     *
+     * @note    Only available with @ref net_gnrc_netapi_batch.
+     */
+    gnrc_netapi_batch_t rx_batch;
 #endif
     uint8_t cur_hl;                         /**< Current hop-limit for out-going packets */
     uint8_t device_type;                    /**< Device type */
@@ -35,8 +35,40 @@
 extern "C" {
 #endif
 
+/**
+ * @defgroup net_gnrc_netreg_conf GNRC NETREG compile configurations
+ * @ingroup net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of hash buckets per @ref gnrc_nettype_t in the registry
+ *          (as exponent of 2^n).
+ *
+ *          Entries are hashed by their gnrc_netreg_entry_t::demux_ctx, so
+ *          lookups only need to walk the entries of one bucket. Entries with
+ *          @ref GNRC_NETREG_DEMUX_CTX_ALL are kept in a bucket of their own.
+ *          Every bucket costs one pointer per @ref gnrc_nettype_t.
+ *
+ *          The default of 16 buckets keeps the ports and protocol numbers a
+ *          node typically registers in distinct buckets, so a lookup is
+ *          constant-time, for about 0.5 KiB more RAM than 4 buckets on 32-bit
+ *          platforms. Nodes that only register a handful of entries can
+ *          lower it to save RAM.
+ */
+#ifndef CONFIG_GNRC_NETREG_BUCKETS_EXP
+#define CONFIG_GNRC_NETREG_BUCKETS_EXP  4
+#endif
+/** @} */
+
+/**
+ * @brief   Number of hash buckets per @ref gnrc_nettype_t in the registry
+ */
+#ifndef GNRC_NETREG_BUCKETS
+#define GNRC_NETREG_BUCKETS  (1 << CONFIG_GNRC_NETREG_BUCKETS_EXP)
+#endif
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
-    defined(DOXYGEN)
+    defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
 /**
  *  @brief  The type of the netreg entry.
  *
@@ -51,6 +83,17 @@ typedef enum {
      *          `gnrc_netapi_callbacks` modules.
      */
     GNRC_NETREG_TYPE_DEFAULT = 0,
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   Use [default IPC](@ref core_msg) for
+     *          [netapi](@ref net_gnrc_netapi) operations, but accept
+     *          @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH messages in addition to
+     *          @ref GNRC_NETAPI_MSG_TYPE_RCV
+     *
+     * @note    Only available with `gnrc_netapi_batch` module.
+     */
+    GNRC_NETREG_TYPE_BATCH,
+#endif
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
     /**
      * @brief   Use [centralized IPC](@ref core_mbox) for
@@ -93,7 +136,8 @@ typedef enum {
  *
  * @return  An initialized netreg entry
  */
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_BATCH)
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_DEFAULT, \
                                                       { pid } }
@@ -101,6 +145,28 @@ typedef enum {
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid } }
 #endif
 
+/**
+ * @brief   Initializes a netreg entry statically with PID of a thread that
+ *          also handles @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH messages
+ *
+ * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ *                      for the netreg entry
+ * @param[in] pid       The PID of the registering thread
+ *
+ * @note    Equivalent to @ref GNRC_NETREG_ENTRY_INIT_PID without
+ *          @ref net_gnrc_netapi_batch.
+ *
+ * @return  An initialized netreg entry
+ */
+#if defined(MODULE_GNRC_NETAPI_BATCH)
+#define GNRC_NETREG_ENTRY_INIT_BATCH(demux_ctx, pid) { NULL, demux_ctx, \
+                                                       GNRC_NETREG_TYPE_BATCH, \
+                                                       { pid } }
+#else
+#define GNRC_NETREG_ENTRY_INIT_BATCH(demux_ctx, pid) \
+    GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)
+#endif
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
 /**
  * @brief   Initializes a netreg entry statically with mbox
@@ -181,12 +247,12 @@ typedef struct gnrc_netreg_entry {
      */
     uint32_t demux_ctx;
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
-    defined(DOXYGEN)
+    defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
     /**
      * @brief   Type of the registry entry
      *
-     * @note    Only available with @ref net_gnrc_netapi_mbox or
-     *          @ref net_gnrc_netapi_callbacks.
+     * @note    Only available with @ref net_gnrc_netapi_mbox,
+     *          @ref net_gnrc_netapi_callbacks, or @ref net_gnrc_netapi_batch.
      */
     gnrc_netreg_type_t type;
 #endif
@@ -237,12 +303,35 @@ static inline void gnrc_netreg_entry_init_pid(gnrc_netreg_entry_t *entry,
 {
     entry->next = NULL;
     entry->demux_ctx = demux_ctx;
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_BATCH)
     entry->type = GNRC_NETREG_TYPE_DEFAULT;
 #endif
     entry->target.pid = pid;
 }
 
+/**
+ * @brief   Initializes a netreg entry dynamically with PID of a thread that
+ *          also handles @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH messages
+ *
+ * @param[out] entry    A netreg entry
+ * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ *                      for the netreg entry
+ * @param[in] pid       The PID of the registering thread
+ *
+ * @note    Equivalent to @ref gnrc_netreg_entry_init_pid() without
+ *          @ref net_gnrc_netapi_batch.
+ */
+static inline void gnrc_netreg_entry_init_batch(gnrc_netreg_entry_t *entry,
+                                                uint32_t demux_ctx,
+                                                kernel_pid_t pid)
+{
+    gnrc_netreg_entry_init_pid(entry, demux_ctx, pid);
+#if defined(MODULE_GNRC_NETAPI_BATCH)
+    entry->type = GNRC_NETREG_TYPE_BATCH;
+#endif
+}
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
 /**
  * @brief   Initializes a netreg entry dynamically with mbox
@@ -304,6 +393,8 @@ static inline void gnrc_netreg_entry_init_cb(gnrc_netreg_entry_t *entry,
  *
  * @warning Call gnrc_netreg_unregister() *before* you leave the context you
  *          allocated @p entry in. Otherwise it might get overwritten.
+ * @warning Do not change gnrc_netreg_entry_t::demux_ctx of @p entry while it
+ *          is registered, the registry is indexed by it.
  *
  * @pre The calling thread must provide a [message queue](@ref msg_init_queue)
  *      when using @ref GNRC_NETREG_TYPE_DEFAULT for gnrc_netreg_entry_t::type
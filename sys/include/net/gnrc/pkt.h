@@ -120,6 +120,21 @@ typedef struct gnrc_pktsnip {
     kernel_pid_t err_sub;           /**< subscriber to errors related to this
                                      *   packet snip */
 #endif
+#if defined(MODULE_GNRC_PKTSNIP_CSUM) || defined(DOXYGEN)
+    /**
+     * @brief   Unnormalized Internet Checksum of gnrc_pktsnip_t::data as
+     *          returned by inet_csum() with an initial value of 0, or 0 if not
+     *          known.
+     *
+     * A checksum of 0 (data consisting of zeros only) is stored as the
+     * equivalent 0xffff. Set by gnrc_pktbuf_add_csum() and reset by the
+     * packet buffer when it changes the data of the snip. Anyone else writing
+     * to gnrc_pktsnip_t::data must reset it to 0.
+     *
+     * @note    Only available with module `gnrc_pktsnip_csum`
+     */
+    uint16_t csum;
+#endif
 } gnrc_pktsnip_t;
 
 /**
@@ -62,8 +62,78 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @brief   Number of packet snip descriptors in the snip slab of
+ *          `gnrc_pktbuf_slab`
+ *
+ * @details For `gnrc_pktbuf_slab`, @ref CONFIG_GNRC_PKTBUF_SIZE is the size
+ *          of the fallback arena used for payloads that do not fit any size
+ *          class and when a slab is exhausted.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF      (32)
+#endif
+
+/**
+ * @brief   Slot size of the small payload class of `gnrc_pktbuf_slab`
+ *
+ * @details Fits protocol headers such as IPv6, UDP, and most netif headers.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE      (48)
+#endif
+
+/**
+ * @brief   Number of slots in the small payload class of `gnrc_pktbuf_slab`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF     (16)
+#endif
+
+/**
+ * @brief   Slot size of the medium payload class of `gnrc_pktbuf_slab`
+ *
+ * @details Fits a full IEEE 802.15.4 frame / 6LoWPAN fragment.
+ *
+ * @pre     Must be greater than @ref CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE     (128)
+#endif
+
+/**
+ * @brief   Number of slots in the medium payload class of `gnrc_pktbuf_slab`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF    (16)
+#endif
 /** @} */
 
+/**
+ * @brief   Granularity at which gnrc_pktbuf_mark() splits the data of a packet
+ *          in place
+ *
+ * Marking a multiple of this number of bytes does not copy the data of the
+ * packet. Otherwise the packet buffer implementation may need to move the data
+ * to keep its chunks aligned.
+ */
+#define GNRC_PKTBUF_MARK_ALIGN          (2 * sizeof(void *))
+
+/**
+ * @brief   Number of bytes to put in front of a header of @p hdr_len bytes, so
+ *          that the header can be marked in place
+ *
+ * A network interface can receive a frame to this offset in a packet snip and
+ * then mark the headroom and the link-layer header together, so its payload
+ * is not copied.
+ *
+ * @param[in] hdr_len   Length of a header.
+ */
+#define GNRC_PKTBUF_MARK_HEADROOM(hdr_len) \
+    ((GNRC_PKTBUF_MARK_ALIGN - ((hdr_len) % GNRC_PKTBUF_MARK_ALIGN)) % \
+     GNRC_PKTBUF_MARK_ALIGN)
+
 /**
  * @brief   Initializes packet buffer module.
  */
@@ -93,6 +163,34 @@ void gnrc_pktbuf_init(void);
 gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
                                 gnrc_nettype_t type);
 
+#if defined(MODULE_GNRC_PKTSNIP_CSUM) || defined(DOXYGEN)
+/**
+ * @brief   Adds a new gnrc_pktsnip_t to the packet buffer and calculates the
+ *          Internet Checksum of @p data while copying it
+ *
+ * Same as gnrc_pktbuf_add(), but also sets gnrc_pktsnip_t::csum, so the
+ * transport layer does not need to read the data again to calculate its
+ * checksum.
+ *
+ * @note    Only available with module `gnrc_pktsnip_csum`
+ *
+ * @pre size < CONFIG_GNRC_PKTBUF_SIZE
+ *
+ * @param[in] next      Next gnrc_pktsnip_t in the packet. Leave NULL if you
+ *                      want to create a new packet.
+ * @param[in] data      Data of the new gnrc_pktsnip_t. Must not be NULL if
+ *                      @p size is greater than 0.
+ * @param[in] size      Length of @p data. No checksum is calculated if
+ *                      it exceeds UINT16_MAX.
+ * @param[in] type      Protocol type of the gnrc_pktsnip_t.
+ *
+ * @return  Pointer to the packet part that represents the new gnrc_pktsnip_t.
+ * @return  NULL, if no space is left in the packet buffer.
+ */
+gnrc_pktsnip_t *gnrc_pktbuf_add_csum(gnrc_pktsnip_t *next, const void *data,
+                                     size_t size, gnrc_nettype_t type);
+#endif
+
 /**
  * @brief   Marks the first @p size bytes in a received packet with a new
  *          packet snip that is appended to the packet.
@@ -301,9 +399,65 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt);
  *
  * @note    Only available with DEVELHELP defined.
  *
- * @details Statistics include maximum number of reserved bytes.
+ * @details Statistics include maximum number of reserved bytes. For
+ *          `gnrc_pktbuf_slab` they include the number of used slots, its
+ *          maximum and the fallbacks of every size class.
  */
 void gnrc_pktbuf_stats(void);
+
+/**
+ * @brief   Returns the high-water mark of the packet buffer
+ *
+ * @note    Only available with DEVELHELP defined.
+ *
+ * @return  Position of the last byte of the packet buffer that was used so
+ *          far, as printed by @ref gnrc_pktbuf_stats(). For
+ *          `gnrc_pktbuf_slab` this refers to its fallback arena, see
+ *          @ref gnrc_pktbuf_slab_class_stats() for its size classes,
+ *          `gnrc_pktbuf_malloc` has no buffer of fixed size and always
+ *          returns 0.
+ */
+size_t gnrc_pktbuf_max_used(void);
+
+/**
+ * @brief   Resets the high-water mark of the packet buffer
+ *
+ * The high-water mark is determined anew from the next allocation on, e.g.
+ * to measure the usage of the packet buffer during a certain period of time.
+ * Also resets the value printed by @ref gnrc_pktbuf_stats(). For
+ * `gnrc_pktbuf_slab` this also resets the high-water marks and fallback
+ * counts of its size classes.
+ *
+ * @note    Only available with DEVELHELP defined.
+ */
+void gnrc_pktbuf_max_used_reset(void);
+
+#if defined(MODULE_GNRC_PKTBUF_SLAB) || defined(DOXYGEN)
+/**
+ * @brief   Usage of a size class of `gnrc_pktbuf_slab`
+ */
+typedef struct {
+    uint16_t size;          /**< size of a slot in bytes */
+    uint16_t numof;         /**< number of slots */
+    uint16_t used;          /**< number of slots in use */
+    uint16_t max_used;      /**< maximum number of slots in use */
+    uint16_t fallbacks;     /**< allocations that had to use the next class */
+} gnrc_pktbuf_slab_class_t;
+
+/**
+ * @brief   Gets the usage of a size class of `gnrc_pktbuf_slab`
+ *
+ * @note    Only available with DEVELHELP defined and `gnrc_pktbuf_slab`.
+ *
+ * @param[in] idx       Index of the size class, starting with 0 for the
+ *                      packet snip descriptors
+ * @param[out] stats    Usage of the size class
+ *
+ * @return  0 on success
+ * @return  -ENOENT, if there is no size class with index @p idx
+ */
+int gnrc_pktbuf_slab_class_stats(unsigned idx, gnrc_pktbuf_slab_class_t *stats);
+#endif
 #endif
 
 /* for testing */
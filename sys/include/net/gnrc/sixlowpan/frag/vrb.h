@@ -122,13 +122,7 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(
  *
  * @param[in] vrb   A VRB entry
  */
-static inline void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrb)
-{
-    if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB)) {
-        gnrc_sixlowpan_frag_rb_base_rm(&vrb->super);
-    }
-    vrb->super.src_len = 0;
-}
+void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrb);
 
 /**
  * @brief   Determines if a VRB entry is empty
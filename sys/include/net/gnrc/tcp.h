@@ -24,6 +24,7 @@
 
 #include <stdint.h>
 #include "net/gnrc/pkt.h"
+#include "net/gnrc/tcp/cc.h"
 #include "net/gnrc/tcp/tcb.h"
 
 #ifdef MODULE_GNRC_IPV6
@@ -121,7 +122,7 @@ void gnrc_tcp_tcb_init(gnrc_tcp_tcb_t *tcb);
  * @return   -EINVAL if @p address_family is not the same the address_family use by the TCB.
  *                    or @p target_addr is invalid.
  * @return   -EISCONN if TCB is already in use.
- * @return   -ENOMEM if the receive buffer for the TCB could not be allocated.
+ * @return   -ENOMEM if the receive buffer pool is exhausted.
  * @return   -EADDRINUSE if @p local_port is already used by another connection.
  * @return   -ETIMEDOUT if the connection could not be opened.
  * @return   -ECONNREFUSED if the connection was reset by the peer.
@@ -149,7 +150,7 @@ int gnrc_tcp_open_active(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote,
  * @return   -EINVAL if @p address_family is not the same the address_family used in TCB.
  *                    or the address in @p local is invalid.
  * @return   -EISCONN if TCB is already in use.
- * @return   -ENOMEM if the receive buffer for the TCB could not be allocated.
+ * @return   -ENOMEM if the receive buffer pool is exhausted.
  *            Hint: Increase "CONFIG_GNRC_TCP_RCV_BUFFERS".
  */
 int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *local);
@@ -162,6 +163,9 @@ int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *local);
  * @pre @p data must not be NULL.
  *
  * @note Blocks until up to @p len bytes were transmitted or an error occurred.
+ *       Transmitted data is kept for retransmission until it is acknowledged,
+ *       up to @ref CONFIG_GNRC_TCP_SND_QUEUE_SIZE segments. The function does
+ *       not wait for the acknowledgment as long as there is space left.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
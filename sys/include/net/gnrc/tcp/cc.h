@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       GNRC TCP congestion control
+ *
+ * Loss detection and recovery (fast retransmit and NewReno fast recovery as
+ * of RFC 6582, slow start restart after a retransmission timeout) are handled
+ * by GNRC TCP itself. How the congestion window grows with new
+ * acknowledgments and how far it is reduced after a loss is up to the
+ * congestion control algorithm of a connection, see @ref gnrc_tcp_cc_t.
+ *
+ * The algorithm of a connection can be changed by setting
+ * gnrc_tcp_tcb_t::cc between @ref gnrc_tcp_tcb_init and opening the
+ * connection.
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef NET_GNRC_TCP_CC_H
+#define NET_GNRC_TCP_CC_H
+
+#include <stdint.h>
+
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Operations of a congestion control algorithm
+ *
+ * All operations are called from the GNRC TCP thread with the FSM of the
+ * connection locked.
+ */
+typedef struct gnrc_tcp_cc {
+    /**
+     * @brief Initializes the algorithm for a newly established connection
+     *
+     * gnrc_tcp_tcb_t::cwnd and gnrc_tcp_tcb_t::ssthresh are already set to
+     * their initial values (RFC 5681, section 3.1) when this is called.
+     *
+     * @param[in,out] tcb   TCB of the connection.
+     */
+    void (*init)(gnrc_tcp_tcb_t *tcb);
+    /**
+     * @brief Opens the congestion window for newly acknowledged data
+     *
+     * Not called during loss recovery.
+     *
+     * @param[in,out] tcb     TCB of the connection.
+     * @param[in]     acked   Number of newly acknowledged bytes.
+     */
+    void (*acked)(gnrc_tcp_tcb_t *tcb, uint32_t acked);
+    /**
+     * @brief Calculates the slow start threshold after a loss was detected
+     *
+     * @param[in] tcb   TCB of the connection. gnrc_tcp_tcb_t::cwnd still holds
+     *                  the congestion window from before the loss.
+     *
+     * @returns   The new slow start threshold in bytes.
+     */
+    uint32_t (*ssthresh)(const gnrc_tcp_tcb_t *tcb);
+} gnrc_tcp_cc_t;
+
+/**
+ * @brief NewReno congestion control (RFC 5681, RFC 6582)
+ */
+extern const gnrc_tcp_cc_t gnrc_tcp_cc_newreno;
+
+/**
+ * @brief Congestion control algorithm of new connections
+ */
+#ifndef GNRC_TCP_CC_DEFAULT
+#define GNRC_TCP_CC_DEFAULT (&gnrc_tcp_cc_newreno)
+#endif
+
+/**
+ * @brief Returns the segment size the congestion window of a connection is
+ *        calculated with
+ *
+ * @param[in] tcb   TCB of the connection.
+ *
+ * @returns   The sender maximum segment size (SMSS) of @p tcb.
+ */
+static inline uint32_t gnrc_tcp_cc_smss(const gnrc_tcp_tcb_t *tcb)
+{
+    if ((tcb->mss == 0) || (tcb->mss > CONFIG_GNRC_TCP_MSS)) {
+        return CONFIG_GNRC_TCP_MSS;
+    }
+    return tcb->mss;
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* NET_GNRC_TCP_CC_H */
+/** @} */
@@ -92,22 +92,56 @@ extern "C" {
 #endif
 
 /**
- * @brief Number of preallocated receive buffers.
+ * @brief Number of receive buffers in the receive buffer pool.
  *
- * This value determines how many parallel TCP connections can be active at the
- * same time.
+ * The pool holds this many receive buffers of @ref GNRC_TCP_RCV_BUF_SIZE
+ * bytes, block headers included. Every open connection reserves about one MSS
+ * in the pool, so connections can not starve each other, and borrows
+ * unreserved blocks up to @ref GNRC_TCP_RCV_BUF_SIZE. At least this many
+ * connections can be opened at the same time. Blocks are taken from the pool
+ * as data arrives and are returned as soon as the data was read.
  */
 #ifndef CONFIG_GNRC_TCP_RCV_BUFFERS
 #define CONFIG_GNRC_TCP_RCV_BUFFERS (1U)
 #endif
 
 /**
- * @brief Default receive buffer size
+ * @brief Maximum receive buffer size of a connection
  */
 #ifndef GNRC_TCP_RCV_BUF_SIZE
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Size of the blocks receive buffers are allocated in
+ */
+#ifndef CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE
+#define CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE (128U)
+#endif
+
+/**
+ * @brief Enable the window scale option (RFC 7323)
+ *
+ * Required for receive windows larger than 65535 bytes, see
+ * @ref GNRC_TCP_RCV_BUF_SIZE. The window scale option is only used if the peer
+ * supports it as well.
+ */
+#ifdef DOXYGEN
+#define CONFIG_GNRC_TCP_WND_SCALE
+#endif
+
+/**
+ * @brief Enable the timestamps option (RFC 7323)
+ *
+ * Timestamps allow round trip time measurements with every acknowledgment and
+ * protect against wrapped sequence numbers (PAWS) on fast connections. They
+ * add 12 bytes to every segment. The timestamps option is only used if the
+ * peer supports it as well.
+ */
+#ifdef DOXYGEN
+#define CONFIG_GNRC_TCP_TIMESTAMPS
+#endif
+
 /**
  * @brief Lower bound for RTO = 1 sec (see RFC 6298)
  *
@@ -168,6 +202,22 @@ extern "C" {
 #define CONFIG_GNRC_TCP_PROBE_UPPER_BOUND (60U * US_PER_SEC)
 #endif
 
+/**
+ * @brief Maximum number of sent, unacknowledged data segments per connection
+ *
+ * Up to this many segments are in flight at the same time, as far as the send
+ * and congestion windows allow it. Every segment stays in the packet buffer
+ * until it is acknowledged, so the packet buffer must be large enough to hold
+ * them.
+ *
+ * @note Fast retransmit needs three duplicate ACKs, i.e. three segments
+ *       received after a lost one. With less than 4 segments in flight, every
+ *       loss is only recovered by the retransmission timeout.
+ */
+#ifndef CONFIG_GNRC_TCP_SND_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_SND_QUEUE_SIZE (4U)
+#endif
+
 /**
  * @brief Message queue size for TCP API internal messaging
  * @note The number of elements in a message queue must be a power of two.
@@ -20,9 +20,9 @@
 #ifndef NET_GNRC_TCP_TCB_H
 #define NET_GNRC_TCP_TCB_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "kernel_types.h"
-#include "ringbuffer.h"
 #include "xtimer.h"
 #include "mutex.h"
 #include "msg.h"
@@ -38,6 +38,31 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Size of the send queue of a TCB
+ *
+ * Data segments use up to @ref CONFIG_GNRC_TCP_SND_QUEUE_SIZE entries, one more
+ * entry is reserved for the FIN.
+ */
+#define GNRC_TCP_SND_QUEUE_LEN (CONFIG_GNRC_TCP_SND_QUEUE_SIZE + 1)
+
+/**
+ * @brief Receive buffer of a connection.
+ *
+ * A list of blocks, allocated from the receive buffer pool. Each open
+ * connection holds a reservation of about one MSS in the pool and borrows
+ * unreserved blocks beyond that.
+ */
+typedef struct {
+    struct gnrc_tcp_rcvbuf_block *head; /**< Oldest block, data is read from here */
+    struct gnrc_tcp_rcvbuf_block *tail; /**< Newest block, data is added here */
+    uint16_t head_pos;                  /**< Read position in gnrc_tcp_rcvbuf_t::head */
+    uint16_t tail_pos;                  /**< Write position in gnrc_tcp_rcvbuf_t::tail */
+    uint32_t len;                       /**< Number of buffered bytes */
+    uint16_t blocks;                    /**< Number of blocks in the list */
+    bool reserved;                      /**< Holds a reservation in the pool */
+} gnrc_tcp_rcvbuf_t;
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -54,27 +79,42 @@ typedef struct _transmission_control_block {
     uint8_t status;        /**< A connections status flags */
     uint32_t snd_una;      /**< Send unacknowledged */
     uint32_t snd_nxt;      /**< Send next */
-    uint16_t snd_wnd;      /**< Send window */
+    uint32_t snd_wnd;      /**< Send window */
     uint32_t snd_wl1;      /**< SeqNo. from last window update */
     uint32_t snd_wl2;      /**< AckNo. from last window update */
     uint32_t rcv_nxt;      /**< Receive next */
-    uint16_t rcv_wnd;      /**< Receive window */
+    uint32_t rcv_wnd;      /**< Receive window */
     uint32_t iss;          /**< Initial sequence sumber */
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
+    uint8_t snd_wnd_scale; /**< Window scale shift of the peer */
+    uint8_t rcv_wnd_scale; /**< Own window scale shift */
+    uint32_t ts_recent;    /**< Timestamp of the peer to echo */
     uint32_t rtt_start;    /**< Timer value for rtt estimation */
+    uint32_t rtt_seq;      /**< Acknowledgment number ending rtt estimation */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
-    uint8_t retries;       /**< Number of retransmissions */
+    uint8_t retries;       /**< Number of retransmissions on timeout */
+    uint8_t fast_retries;  /**< Number of retransmissions without timeout, i.e.
+                                fast retransmit and loss recovery */
+    uint8_t dup_acks;      /**< Number of duplicate ACKs received */
+    uint8_t snd_queue_len; /**< Number of segments in tcb::snd_queue */
+    uint32_t cwnd;         /**< Congestion window */
+    uint32_t ssthresh;     /**< Slow start threshold */
+    uint32_t recover;      /**< Send next when loss recovery started */
+    uint32_t retransmits;  /**< Number of retransmitted segments */
+    const struct gnrc_tcp_cc *cc; /**< Congestion control algorithm,
+                                       see net/gnrc/tcp/cc.h */
     xtimer_t timer_retransmit; /**< Retransmission timer */
     xtimer_t timer_misc;       /**< General purpose timer */
     msg_t msg_retransmit;      /**< Retransmission timer message */
     msg_t msg_misc;            /**< General purpose timer message */
-    gnrc_pktsnip_t *pkt_retransmit;   /**< Pointer to packet in "retransmit queue" */
+    gnrc_pktsnip_t *snd_queue[GNRC_TCP_SND_QUEUE_LEN]; /**< Sent, unacknowledged segments
+                                                            ("retransmit queue"), oldest
+                                                            first */
     mbox_t *mbox;            /**< TCB mbox for synchronization */
-    uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
-    ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
+    gnrc_tcp_rcvbuf_t rcv_buf; /**< Receive buffer */
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
     struct _transmission_control_block *next;   /**< Pointer next TCB */
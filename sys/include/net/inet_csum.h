@@ -73,6 +73,56 @@ static inline uint16_t inet_csum(uint16_t sum, const uint8_t *buf, uint16_t len)
     return inet_csum_slice(sum, buf, len, 0);
 }
 
+/**
+ * @brief   Copies @p src to @p dst and calculates the unnormalized Internet
+ *          Checksum of the data on the way, where the data provides a
+ *          standalone domain for the checksum.
+ *
+ * @details Saves a second pass over the data when it is copied anyway, e.g.
+ *          into a packet buffer. The result is the same as that of inet_csum()
+ *          over @p src. @p dst and @p src must not overlap.
+ *
+ * @param[in] sum       An initial value for the checksum.
+ * @param[out] dst      The destination buffer. Must be at least @p len bytes
+ *                      long.
+ * @param[in] src       The source buffer.
+ * @param[in] len       Length of @p src in byte.
+ *
+ * @return  The unnormalized Internet Checksum of @p src.
+ */
+uint16_t inet_csum_copy(uint16_t sum, uint8_t *dst, const uint8_t *src,
+                        uint16_t len);
+
+/**
+ * @brief   Adds the unnormalized Internet Checksum of a slice of the checksum
+ *          domain, calculated as a standalone domain, to a checksum.
+ *
+ * @details The result is equivalent in 1's complement arithmetic to calling
+ *          inet_csum_slice() over the data of the slice with @p sum and
+ *          @p accum_len.
+ *
+ * @param[in] sum       The checksum to add to.
+ * @param[in] csum      The checksum of the slice as returned by inet_csum()
+ *                      with an initial value of 0.
+ * @param[in] accum_len Accumulated length of checksum domain that has already
+ *                      been checksummed.
+ *
+ * @return  The unnormalized Internet Checksum of both.
+ */
+static inline uint16_t inet_csum_add(uint16_t sum, uint16_t csum,
+                                     size_t accum_len)
+{
+    uint32_t res = sum;
+
+    if (accum_len & 1) {
+        /* the slice starts at an odd position so its words are shifted by one
+         * byte (RFC 1071, section 2 (B)) */
+        csum = (uint16_t)((csum << 8) | (csum >> 8));
+    }
+    res += csum;
+    return (uint16_t)((res & 0xffff) + (res >> 16));
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -747,6 +747,16 @@ typedef enum {
      */
     NETOPT_RSSI,
 
+    /**
+     * @brief   (@ref netstats_rx_batch_t*) get statistics on the frames the
+     *          device receives per event
+     *
+     * Expects a pointer to a @ref netstats_rx_batch_t struct that will be
+     * pointed to the statistics of the device. Only provided by devices that
+     * receive all pending frames in a single run of their ISR.
+     */
+    NETOPT_RX_BATCH_STATS,
+
     /**
      * @brief   maximum number of options defined here.
      *
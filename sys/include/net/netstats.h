@@ -34,6 +34,7 @@ extern "C" {
 #define NETSTATS_LAYER2     (0x01)
 #define NETSTATS_IPV6       (0x02)
 #define NETSTATS_RPL        (0x03)
+#define NETSTATS_RX_BATCH   (0x04)
 #define NETSTATS_ALL        (0xFF)
 /** @} */
 
@@ -53,6 +54,20 @@ typedef struct {
     uint32_t rx_bytes;          /**< received bytes */
 } netstats_t;
 
+/**
+ * @brief       Statistics on the frames a device receives per event
+ *
+ * Provided by devices that receive all frames pending in a single run of
+ * their ISR via @ref NETOPT_RX_BATCH_STATS.
+ */
+typedef struct {
+    uint32_t events;            /**< handled receive events */
+    uint32_t frames;            /**< frames received during these events */
+    uint32_t frames_max;        /**< most frames received during one event */
+    uint32_t limit_reached;     /**< events that ended because the device's
+                                     limit of frames per event was reached */
+} netstats_rx_batch_t;
+
 #ifdef __cplusplus
 }
 #endif
@@ -43,6 +43,8 @@ extern "C" {
 #define TCP_OPTION_KIND_EOL (0x00)  /**< "End of List"-Option */
 #define TCP_OPTION_KIND_NOP (0x01)  /**< "No Operation"-Option */
 #define TCP_OPTION_KIND_MSS (0x02)  /**< "Maximum Segment Size"-Option */
+#define TCP_OPTION_KIND_WS  (0x03)  /**< "Window Scale"-Option (RFC 7323) */
+#define TCP_OPTION_KIND_TS  (0x08)  /**< "Timestamps"-Option (RFC 7323) */
 /** @} */
 
 /**
@@ -51,6 +53,8 @@ extern "C" {
  */
 #define TCP_OPTION_LENGTH_MIN (2U)    /**< Minimum amount of bytes needed for an option with a length field */
 #define TCP_OPTION_LENGTH_MSS (0x04)  /**< MSS Option Size always 4 */
+#define TCP_OPTION_LENGTH_WS  (0x03)  /**< Window Scale Option Size always 3 */
+#define TCP_OPTION_LENGTH_TS  (0x0A)  /**< Timestamps Option Size always 10 */
 /** @} */
 
 /**
@@ -16,6 +16,25 @@
  *
  * @note        If auto_init is disabled `init_schedstatistics()` needs to be
  *              called as well as xtimer_init().
+ *
+ * With the `schedstatistics_latency` module, the following is recorded for
+ * each thread in addition:
+ *
+ * - the wakeup latency, i.e. the time from the thread becoming runnable after
+ *   being blocked until it actually runs, as a log2 histogram
+ *   (schedstat_t::wakeup_hist)
+ * - the time spent in each blocked state (schedstat_t::blocked_ticks)
+ * - how often the thread was preempted by a thread with a higher priority
+ *   (schedstat_t::preemptions)
+ *
+ * Wakeup latencies are measured with the DWT cycle counter on Cortex-M cores
+ * that have one, with the monotonic clock of the host (in nanoseconds) on
+ * `native` and with xtimer on all other platforms.
+ * @ref schedstat_wakeup_latency_percentile converts the histogram to
+ * microseconds, `ps` prints the median and the 99th percentile.
+ *
+ * This costs about 180 bytes of RAM per possible thread (see
+ * @ref MAXTHREADS).
  * @{
  *
  * @file
@@ -31,11 +50,20 @@
 
 #include <stdint.h>
 #include "kernel_types.h"
+#include "sched.h"
 
 #ifdef __cplusplus
  extern "C" {
 #endif
 
+/**
+ * @brief   Number of buckets of the wakeup latency histogram
+ *
+ * Bucket `i` counts latencies of less than `2^i` and at least `2^(i-1)` cycle
+ * counter ticks, the last bucket also counts all longer latencies.
+ */
+#define SCHEDSTAT_HIST_BUCKETS  (32U)
+
 /**
  *  Scheduler statistics
  */
@@ -44,6 +72,19 @@ typedef struct {
                                   scheduled to run */
     unsigned int schedules;  /**< How often the thread was scheduled to run */
     uint64_t runtime_ticks;  /**< The total runtime of this thread in ticks */
+#if defined(MODULE_SCHEDSTATISTICS_LATENCY) || defined(DOXYGEN)
+    uint64_t blocked_ticks[STATUS_ON_RUNQUEUE]; /**< Total time spent in each
+                                  blocked @ref thread_status_t in ticks */
+    uint32_t blocked_since;  /**< Time stamp of the last time this thread
+                                  changed to a blocked state */
+    uint32_t runnable_since; /**< Cycle counter at the last wakeup */
+    uint32_t preemptions;    /**< How often the thread was descheduled while
+                                  still runnable in favor of a thread with
+                                  a higher priority */
+    uint16_t wakeup_hist[SCHEDSTAT_HIST_BUCKETS]; /**< Wakeup latencies,
+                                  saturating, see @ref SCHEDSTAT_HIST_BUCKETS */
+    uint8_t woken;           /**< Thread is waiting to run after a wakeup */
+#endif
 } schedstat_t;
 
 /**
@@ -57,6 +98,41 @@ extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
  */
 void init_schedstatistics(void);
 
+#if defined(MODULE_SCHEDSTATISTICS_LATENCY) || defined(DOXYGEN)
+/**
+ * @brief   Records a change of the status of a thread
+ *
+ * Called by @ref sched_set_status with interrupts disabled.
+ *
+ * @param[in] pid       the thread
+ * @param[in] old       current status of the thread
+ * @param[in] status    new status of the thread
+ */
+void sched_statistics_status_cb(kernel_pid_t pid, thread_status_t old,
+                                thread_status_t status);
+
+/**
+ * @brief   Returns the number of cycle counter ticks per second the wakeup
+ *          latencies are measured in
+ */
+uint32_t schedstat_cycles_per_sec(void);
+
+/**
+ * @brief   Calculates a percentile of the wakeup latencies of a thread
+ *
+ * As the latencies are kept in a log2 histogram, the result is the upper
+ * bound of the bucket the percentile falls into.
+ *
+ * @param[in] stat          statistics of the thread
+ * @param[in] percentile    percentile to calculate, 1 to 100
+ *
+ * @return  the percentile in microseconds
+ * @return  UINT32_MAX if no wakeup was recorded yet
+ */
+uint32_t schedstat_wakeup_latency_percentile(const schedstat_t *stat,
+                                             unsigned percentile);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
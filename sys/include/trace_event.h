@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_trace_event Event tracing
+ * @ingroup     sys
+ * @brief       Low-overhead tracing of typed events
+ *
+ * This module records typed events into a ring buffer, e.g. to analyze
+ * scheduling and packet latency on a live system. Each event consists of a
+ * timestamp, its type, a static string naming it, the thread that recorded it
+ * and an argument.
+ *
+ * Events can be recorded from threads and ISRs alike. Interrupts are only
+ * disabled while a slot in the ring buffer is reserved and the timestamp is
+ * taken, so the events in the buffer are always ordered by time. As RIOT only
+ * runs on a single CPU, there is one ring buffer for the whole system; the
+ * thread of each event is recorded along with it. If the buffer is full, the
+ * oldest events are overwritten.
+ *
+ * Timestamps are taken from the DWT cycle counter on Cortex-M cores that have
+ * one, on all other platforms the current time in microseconds is used.
+ *
+ * Besides the events recorded by the application, the following events are
+ * recorded by RIOT itself:
+ *
+ * - every context switch of the scheduler (@ref TRACE_EVENT_SWITCH)
+ * - every message sent via @ref msg_send and its variants
+ *   (@ref TRACE_EVENT_MSG_SEND)
+ * - the time a thread is blocked in @ref mutex_lock (@ref TRACE_EVENT_BEGIN
+ *   and @ref TRACE_EVENT_END, named "mutex_lock")
+ * - every packet passed between threads via @ref net_gnrc_netapi
+ *   (@ref TRACE_EVENT_FLOW with the packet as argument)
+ *
+ * @ref trace_event_dump prints the recorded events in a binary format, encoded
+ * as hex, with the names and thread names they refer to. The script
+ * `dist/tools/trace_event/trace_event_to_json.py` converts that output to the
+ * JSON trace format of Chrome's `about:tracing` and https://ui.perfetto.dev.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * #include "trace_event.h"
+ * ...
+ * trace_event_begin("encode", len);
+ * ...
+ * trace_event_end("encode", 0);
+ *
+ * trace_event_dump();
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event tracing API
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef TRACE_EVENT_H
+#define TRACE_EVENT_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of events kept in the ring buffer
+ *
+ * @note    Must be a power of two.
+ */
+#ifndef CONFIG_TRACE_EVENT_BUFSIZE
+#define CONFIG_TRACE_EVENT_BUFSIZE  (256U)
+#endif
+
+/**
+ * @brief   Version of the format printed by @ref trace_event_dump
+ */
+#define TRACE_EVENT_DUMP_VERSION    (1U)
+
+/**
+ * @brief   Types of events
+ */
+typedef enum {
+    TRACE_EVENT_BEGIN = 0,      /**< start of a duration in the thread */
+    TRACE_EVENT_END,            /**< end of a duration in the thread */
+    TRACE_EVENT_INSTANT,        /**< something happened */
+    TRACE_EVENT_COUNTER,        /**< argument is the new value of a counter */
+    TRACE_EVENT_FLOW,           /**< argument identifies an object (e.g. a
+                                 *   packet) handed over between threads */
+    TRACE_EVENT_SWITCH,         /**< argument is the PID of the thread that is
+                                 *   run next, KERNEL_PID_UNDEF when going idle */
+    TRACE_EVENT_MSG_SEND,       /**< argument is the PID of the receiver */
+} trace_event_type_t;
+
+/**
+ * @brief   Flag in the type of a recorded event, set if the event was recorded
+ *          in interrupt context
+ *
+ * Never set for @ref TRACE_EVENT_SWITCH, as the scheduler runs in an ISR on
+ * some platforms.
+ */
+#define TRACE_EVENT_FLAG_ISR        (0x80U)
+
+/**
+ * @brief   A recorded event
+ */
+typedef struct {
+    uint32_t time;              /**< timestamp */
+    const char *name;           /**< static string naming the event */
+    uint32_t arg;               /**< argument, meaning depends on the type */
+    uint8_t type;               /**< @ref trace_event_type_t, possibly with
+                                 *   @ref TRACE_EVENT_FLAG_ISR */
+    uint8_t reserved;           /**< keeps the size of the struct */
+    int16_t pid;                /**< thread active when recording the event */
+} trace_event_t;
+
+/**
+ * @brief   Initializes event tracing
+ *
+ * Called by auto_init after the timers are initialized. Starts the cycle
+ * counter, if it is used. No events are recorded before.
+ */
+void trace_event_init(void);
+
+/**
+ * @brief   Records an event
+ *
+ * Can be called from threads and ISRs.
+ *
+ * @param[in] type  type of the event
+ * @param[in] name  name of the event, must be a string that stays valid (e.g.
+ *                  a string literal)
+ * @param[in] arg   argument of the event
+ */
+void trace_event(trace_event_type_t type, const char *name, uint32_t arg);
+
+/**
+ * @brief   Records the start of a duration
+ *
+ * @param[in] name  name of the duration, see @ref trace_event
+ * @param[in] arg   user defined argument
+ */
+static inline void trace_event_begin(const char *name, uint32_t arg)
+{
+    trace_event(TRACE_EVENT_BEGIN, name, arg);
+}
+
+/**
+ * @brief   Records the end of a duration
+ *
+ * @param[in] name  name of the duration, see @ref trace_event
+ * @param[in] arg   user defined argument
+ */
+static inline void trace_event_end(const char *name, uint32_t arg)
+{
+    trace_event(TRACE_EVENT_END, name, arg);
+}
+
+/**
+ * @brief   Records that something happened
+ *
+ * @param[in] name  name of the event, see @ref trace_event
+ * @param[in] arg   user defined argument
+ */
+static inline void trace_event_instant(const char *name, uint32_t arg)
+{
+    trace_event(TRACE_EVENT_INSTANT, name, arg);
+}
+
+/**
+ * @brief   Records the new value of a counter
+ *
+ * @param[in] name  name of the counter, see @ref trace_event
+ * @param[in] value new value of the counter
+ */
+static inline void trace_event_counter(const char *name, uint32_t value)
+{
+    trace_event(TRACE_EVENT_COUNTER, name, value);
+}
+
+/**
+ * @brief   Returns the number of timestamp ticks per second
+ */
+uint32_t trace_event_ticks_per_sec(void);
+
+/**
+ * @brief   Copies the recorded events out of the ring buffer
+ *
+ * @param[out] events   buffer for the events, oldest first
+ * @param[in]  max      number of events that fit into @p events
+ *
+ * @return  number of events copied to @p events
+ */
+unsigned trace_event_get(trace_event_t *events, unsigned max);
+
+/**
+ * @brief   Prints the recorded events
+ *
+ * Prints a header line `TRACE_EVENT <version> <ticks per second> <number of
+ * events>`, a line `S <address> <name>` for each distinct event name and a
+ * line `T <pid> <thread name>` for each thread, followed by a line `E <hex>`
+ * for each event, oldest first. `<hex>` is the event in the following format,
+ * all fields little endian:
+ *
+ * | Offset | Size | Field                                                    |
+ * |:------ |:---- |:-------------------------------------------------------- |
+ * | 0      | 4    | timestamp                                                |
+ * | 4      | 4    | address of the name, as in the `S` lines                 |
+ * | 8      | 4    | argument                                                 |
+ * | 12     | 1    | type, see @ref trace_event_type_t and @ref TRACE_EVENT_FLAG_ISR |
+ * | 13     | 1    | reserved                                                 |
+ * | 14     | 2    | PID of the thread                                        |
+ *
+ * The dump ends with a line `TRACE_EVENT END`. Events recorded while dumping
+ * are not part of the dump.
+ */
+void trace_event_dump(void);
+
+/**
+ * @brief   Drops all recorded events
+ */
+void trace_event_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_EVENT_H */
+/** @} */
@@ -154,6 +154,53 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c);
  */
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n);
 
+/**
+ * @brief       Get the bytes in the ringbuffer that are stored in one piece
+ *
+ * This allows to process (e.g. send via DMA) the bytes in place instead of
+ * copying them out of the ringbuffer. Once done, the bytes have to be removed
+ * with @ref tsrb_get_commit. As the bytes may wrap around the end of the
+ * buffer, there may be more bytes to get afterwards.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    start of the bytes
+ * @return      nr of bytes available at @p data, 0 if the ringbuffer is empty
+ */
+size_t tsrb_get_region(tsrb_t *rb, uint8_t **data);
+
+/**
+ * @brief       Remove bytes obtained via @ref tsrb_get_region from the
+ *              ringbuffer
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes to remove, must not exceed the size of the
+ *                  region returned by @ref tsrb_get_region
+ */
+void tsrb_get_commit(tsrb_t *rb, size_t n);
+
+/**
+ * @brief       Get the free space in the ringbuffer that is in one piece
+ *
+ * This allows to put bytes (e.g. received via DMA) into the ringbuffer
+ * without an intermediate buffer. Once written, the bytes have to be added
+ * with @ref tsrb_add_commit. As the free space may wrap around the end of the
+ * buffer, there may be more space to fill afterwards.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    start of the free space
+ * @return      nr of bytes that can be written to @p data, 0 if the
+ *              ringbuffer is full
+ */
+size_t tsrb_add_region(tsrb_t *rb, uint8_t **data);
+
+/**
+ * @brief       Add bytes written to the region obtained via
+ *              @ref tsrb_add_region to the ringbuffer
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes to add, must not exceed the size of the
+ *                  region returned by @ref tsrb_add_region
+ */
+void tsrb_add_commit(tsrb_t *rb, size_t n);
+
 #ifdef __cplusplus
 }
 #endif
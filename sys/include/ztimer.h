@@ -122,6 +122,11 @@
  * (now() - B) + T[1]). Thus even though the list is keeping relative offsets,
  * the time keeping is done by keeping track of the absolute times.
  *
+ * Inserting into the list takes time linear in the number of timers set on the
+ * clock. For clocks with many timers, the `ztimer_wheel` module allows to keep
+ * the timers in a hierarchical timing wheel instead, making ztimer_set() and
+ * ztimer_remove() constant time, see @ref sys_ztimer_wheel.
+ *
  *
  * ## Clock extension
  *
@@ -238,12 +243,24 @@ typedef struct ztimer_base ztimer_base_t;
  */
 typedef struct ztimer_clock ztimer_clock_t;
 
+/**
+ * @brief ztimer_wheel_t forward declaration
+ */
+typedef struct ztimer_wheel ztimer_wheel_t;
+
 /**
  * @brief   Minimum information for each timer
  */
 struct ztimer_base {
     ztimer_base_t *next;        /**< next timer in list */
-    uint32_t offset;            /**< offset from last timer in list */
+    uint32_t offset;            /**< offset from last timer in list, or
+                                     target time on a clock with a timer
+                                     wheel */
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_base_t *prev;        /**< previous timer in the wheel slot, NULL if
+                                     not set on a timer wheel */
+    uint8_t slot;               /**< timer wheel slot of the timer */
+#endif
 };
 
 #if MODULE_ZTIMER_NOW64
@@ -307,6 +324,10 @@ struct ztimer_clock {
 #if MODULE_PM_LAYERED || DOXYGEN
     uint8_t required_pm_mode;       /**< min. pm mode required for the clock to run */
 #endif
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_wheel_t *wheel;          /**< timer wheel, or NULL if the timers are
+                                         kept in a list                     */
+#endif
 };
 
 /**
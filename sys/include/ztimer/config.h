@@ -117,6 +117,26 @@ extern "C" {
 #define CONFIG_ZTIMER_MSEC_REQUIRED_PM_MODE ZTIMER_CLOCK_NO_REQUIRED_PM_MODE
 #endif
 
+/**
+ * @brief   Keep the timers of ZTIMER_USEC in a timer wheel
+ *
+ * Only has an effect with the `ztimer_wheel` module, see
+ * @ref sys_ztimer_wheel.
+ */
+#ifndef CONFIG_ZTIMER_USEC_WHEEL
+#define CONFIG_ZTIMER_USEC_WHEEL            (1)
+#endif
+
+/**
+ * @brief   Keep the timers of ZTIMER_MSEC in a timer wheel
+ *
+ * Only has an effect with the `ztimer_wheel` module, see
+ * @ref sys_ztimer_wheel.
+ */
+#ifndef CONFIG_ZTIMER_MSEC_WHEEL
+#define CONFIG_ZTIMER_MSEC_WHEEL            (1)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @defgroup  sys_ztimer_wheel timer wheel
+ * @ingroup   sys_ztimer
+ * @brief     Hierarchical timing wheel for clocks with many timers
+ *
+ * By default a ztimer clock keeps its timers in a sorted list, so
+ * ztimer_set() takes time linear in the number of timers set on the clock.
+ * A clock with a timer wheel attached via ztimer_wheel_init() instead sorts
+ * its timers into @ref ZTIMER_WHEEL_LEVELS levels of
+ * @ref ZTIMER_WHEEL_SLOTS slots each. A timer that is due in `d` ticks goes to
+ * the level `l` with `SLOTS^l <= d < SLOTS^(l + 1)`, into the slot selected by
+ * the digit `l` of its target time. Once the clock reaches the start of a
+ * slot's interval, its timers are moved down to the lower levels. Every timer
+ * thus only moves a bounded number of times, and ztimer_set() and
+ * ztimer_remove() take constant time.
+ *
+ * The API and the semantics of the clock (32-bit relative timeouts,
+ * extension, ztimer_now()) stay the same. Timers with the same target time
+ * are not guaranteed to fire in the order they were set. The lower clock may
+ * trigger for slot moves additionally to the timer targets.
+ *
+ * With the `ztimer_wheel` module, the clocks initialized by ztimer's
+ * auto_init get a timer wheel if @ref CONFIG_ZTIMER_USEC_WHEEL or
+ * @ref CONFIG_ZTIMER_MSEC_WHEEL are set.
+ *
+ * @{
+ * @file
+ * @brief   ztimer_wheel interface definitions
+ *
+ * @author  agent <agent@local>
+ */
+#ifndef ZTIMER_WHEEL_H
+#define ZTIMER_WHEEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of slots per level of a timer wheel, as exponent of 2
+ *
+ * Must be 1, 2 or 4.
+ */
+#ifndef CONFIG_ZTIMER_WHEEL_SLOTS_EXP
+#define CONFIG_ZTIMER_WHEEL_SLOTS_EXP   (4)
+#endif
+
+#if (CONFIG_ZTIMER_WHEEL_SLOTS_EXP != 1) && \
+    (CONFIG_ZTIMER_WHEEL_SLOTS_EXP != 2) && \
+    (CONFIG_ZTIMER_WHEEL_SLOTS_EXP != 4)
+#error "CONFIG_ZTIMER_WHEEL_SLOTS_EXP must be 1, 2 or 4"
+#endif
+
+/**
+ * @brief   Number of slots per level of a timer wheel
+ */
+#define ZTIMER_WHEEL_SLOTS      (1U << CONFIG_ZTIMER_WHEEL_SLOTS_EXP)
+
+/**
+ * @brief   Number of levels of a timer wheel, covering 32-bit timeouts
+ */
+#define ZTIMER_WHEEL_LEVELS     (32U / CONFIG_ZTIMER_WHEEL_SLOTS_EXP)
+
+/**
+ * @brief   ztimer_base_t::slot of timers that are due
+ */
+#define ZTIMER_WHEEL_EXPIRED    (UINT8_MAX)
+
+/**
+ * @brief   Timer wheel
+ */
+struct ztimer_wheel {
+    /**
+     * @brief   Timers per slot, by target time, in the order they were added
+     */
+    ztimer_base_t *slots[ZTIMER_WHEEL_LEVELS][ZTIMER_WHEEL_SLOTS];
+    uint16_t used[ZTIMER_WHEEL_LEVELS]; /**< bitfield of non-empty slots */
+    ztimer_base_t *expired;             /**< timers that are due */
+    unsigned numof;                     /**< number of timers on the wheel */
+};
+
+/**
+ * @brief   Keep the timers of a clock in a timer wheel
+ *
+ * @pre No timer is set on @p clock.
+ *
+ * @param[in] clock     clock to attach the wheel to
+ * @param[in] wheel     timer wheel, must stay valid as long as @p clock is
+ *                      used
+ */
+void ztimer_wheel_init(ztimer_clock_t *clock, ztimer_wheel_t *wheel);
+
+/**
+ * @name    Timer wheel operations of ztimer's core
+ * @internal
+ *
+ * The time of the wheel is ztimer_clock_t::list::offset of the clock. All
+ * functions must be called with interrupts disabled.
+ * @{
+ */
+/**
+ * @brief   Adds a timer to the wheel of @p clock
+ *
+ * @param[in] clock     clock with a wheel, updated to the current time
+ * @param[in] entry     timer with ztimer_base_t::offset relative to the
+ *                      current time
+ */
+void ztimer_wheel_add(ztimer_clock_t *clock, ztimer_base_t *entry);
+
+/**
+ * @brief   Removes a timer from the wheel of @p clock
+ *
+ * @param[in] clock     clock with a wheel
+ * @param[in] entry     timer set on @p clock
+ */
+void ztimer_wheel_del(ztimer_clock_t *clock, ztimer_base_t *entry);
+
+/**
+ * @brief   Advances the time of the wheel of @p clock, moving timers that
+ *          become due to the expired timers
+ *
+ * @param[in] clock     clock with a wheel
+ * @param[in] now       new time, not before the current time of the wheel
+ */
+void ztimer_wheel_advance(ztimer_clock_t *clock, uint32_t now);
+
+/**
+ * @brief   Gets the ticks until the wheel of @p clock needs to be advanced
+ *
+ * @param[in] clock     clock with a wheel
+ * @param[out] offset   ticks from the time of the wheel, 0 if timers are due
+ *
+ * @return  true, if timers are set on @p clock
+ * @return  false, if no timer is set on @p clock
+ */
+bool ztimer_wheel_next(const ztimer_clock_t *clock, uint32_t *offset);
+
+/**
+ * @brief   Removes the first due timer from the wheel of @p clock
+ *
+ * @param[in] clock     clock with a wheel
+ *
+ * @return  a due timer
+ * @return  NULL, if no timer is due
+ */
+ztimer_base_t *ztimer_wheel_pop(ztimer_clock_t *clock);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZTIMER_WHEEL_H */
+/** @} */
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gcoap
+ * @{
+ *
+ * @file
+ * @brief       Radix trie index over the resources of all gcoap listeners
+ * @internal
+ *
+ * @author      agent <agent@local>
+ */
+#ifndef PRIV_GCOAP_RESOURCE_TRIE_H
+#define PRIV_GCOAP_RESOURCE_TRIE_H
+
+#include <stdbool.h>
+
+#include "net/gcoap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name    Return values of resource lookups
+ * @{
+ */
+#define GCOAP_RESOURCE_FOUND        (0)
+#define GCOAP_RESOURCE_WRONG_METHOD (-1)
+#define GCOAP_RESOURCE_NO_PATH      (-2)
+/** @} */
+
+/**
+ * @brief   Adds all resources of a listener to the trie
+ *
+ * Listeners must be added in the order they are registered, so resources of
+ * earlier listeners take precedence on equal paths like with the linear
+ * search.
+ *
+ * @param[in] listener  A listener. Its resources must not change while it is
+ *                      registered.
+ *
+ * @return  true, if all resources of @p listener were added.
+ * @return  false, if the trie ran out of space. None of the resources of
+ *          @p listener were added then, so the trie must not be used for
+ *          lookups anymore.
+ */
+bool _gcoap_resource_trie_add(gcoap_listener_t *listener);
+
+/**
+ * @brief   Finds the resource for the Uri-Path of a request
+ *
+ * The Uri-Path options are matched directly from @p pdu, segment by segment.
+ * Of all resources matching the path (exactly or, with
+ * @ref COAP_MATCH_SUBTREE, by prefix) the one registered first that allows the
+ * request method is returned.
+ *
+ * @param[in] pdu           A request
+ * @param[out] resource_ptr The found resource
+ * @param[out] listener_ptr The listener of the found resource
+ *
+ * @return  @ref GCOAP_RESOURCE_FOUND, if a resource was found.
+ * @return  @ref GCOAP_RESOURCE_WRONG_METHOD, if resources matched the path but
+ *          none allows the request method.
+ * @return  @ref GCOAP_RESOURCE_NO_PATH, if no resource matched the path.
+ */
+int _gcoap_resource_trie_find(coap_pkt_t *pdu,
+                              const coap_resource_t **resource_ptr,
+                              gcoap_listener_t **listener_ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIV_GCOAP_RESOURCE_TRIE_H */
+/** @} */
@@ -33,17 +33,19 @@
 #include "random.h"
 #include "thread.h"
 
+#include "_gcoap_resource_trie.h"
+
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
-/* Return values used by the _find_resource function. */
-#define GCOAP_RESOURCE_FOUND 0
-#define GCOAP_RESOURCE_WRONG_METHOD -1
-#define GCOAP_RESOURCE_NO_PATH -2
-
 /* End of the range to pick a random timeout */
 #define TIMEOUT_RANGE_END (CONFIG_COAP_ACK_TIMEOUT * CONFIG_COAP_RANDOM_FACTOR_1000 / 1000)
 
+#if IS_USED(MODULE_GCOAP_MEMO_HASH)
+#define MEMO_HASH_BUCKETS (1U << CONFIG_GCOAP_MEMO_HASH_BUCKETS_EXP)
+#define MEMO_HASH_NONE    (UINT16_MAX)
+#endif
+
 /* Internal functions */
 static void *_event_loop(void *arg);
 static void _on_sock_evt(sock_udp_t *sock, sock_async_flags_t type, void *arg);
@@ -60,6 +62,13 @@ static int _find_obs_memo(gcoap_observe_memo_t **memo, sock_udp_ep_t *remote,
                                                        coap_pkt_t *pdu);
 static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
                                    const coap_resource_t *resource);
+static void _req_memo_link(gcoap_request_memo_t *memo);
+static void _req_memo_unlink(gcoap_request_memo_t *memo);
+static void _observer_link(sock_udp_ep_t *observer);
+static void _observer_unlink(sock_udp_ep_t *observer);
+static void _obs_memo_link(gcoap_observe_memo_t *memo);
+static void _obs_memo_unlink(gcoap_observe_memo_t *memo);
+static void _obs_memo_release(gcoap_observe_memo_t *memo);
 
 /* Internal variables */
 const coap_resource_t _default_resources[] = {
@@ -73,6 +82,29 @@ static gcoap_listener_t _default_listener = {
     NULL
 };
 
+#if IS_USED(MODULE_GCOAP_MEMO_HASH)
+/* Hash indices into the arrays of gcoap_state_t. Each bucket holds the index
+ * of the first entry in the bucket, *_next the index of the following one.
+ * Free observers and observe memos are kept in lists of their own, linked by
+ * the *_next of the index they are not part of while free. */
+typedef struct {
+    uint16_t req[MEMO_HASH_BUCKETS];    /* open requests by token and remote */
+    uint16_t req_next[CONFIG_GCOAP_REQ_WAITING_MAX];
+    uint16_t observer[MEMO_HASH_BUCKETS];   /* observers by endpoint */
+    uint16_t observer_next[CONFIG_GCOAP_OBS_CLIENTS_MAX];
+    uint16_t observer_free;                 /* free observers */
+    uint16_t obs_token[MEMO_HASH_BUCKETS];  /* observe memos by observer and
+                                               token */
+    uint16_t obs_token_next[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
+    uint16_t obs_memo_free;                 /* free observe memos */
+    uint16_t obs_observer[CONFIG_GCOAP_OBS_CLIENTS_MAX];
+                                            /* observe memos by observer */
+    uint16_t obs_observer_next[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
+    uint16_t obs_resource[MEMO_HASH_BUCKETS];   /* observe memos by resource */
+    uint16_t obs_resource_next[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
+} gcoap_memo_hash_t;
+#endif
+
 /* Container for the state of gcoap itself */
 typedef struct {
     mutex_t lock;                       /* Shares state attributes safely */
@@ -91,6 +123,11 @@ typedef struct {
                                         /* Buffers for PDU for request resends;
                                            if first byte of an entry is zero,
                                            the entry is available */
+#if IS_USED(MODULE_GCOAP_MEMO_HASH)
+    gcoap_memo_hash_t hash;             /* Indices of the arrays above; open
+                                           requests and observe memos by
+                                           resource are protected by lock */
+#endif
 } gcoap_state_t;
 
 static gcoap_state_t _coap_state = {
@@ -103,6 +140,12 @@ static event_queue_t _queue;
 static uint8_t _listen_buf[CONFIG_GCOAP_PDU_BUF_SIZE];
 static sock_udp_t _sock;
 
+#if IS_USED(MODULE_GCOAP_RESOURCE_TRIE)
+/* Last listener added to the resource trie; only touched by _pid thread */
+static gcoap_listener_t *_trie_last;
+static bool _trie_full;
+#endif
+
 /* Event loop for gcoap _pid thread. */
 static void *_event_loop(void *arg)
 {
@@ -210,6 +253,7 @@ empty_as_response:
                         memo->resp_handler(memo, &pdu, &remote);
                     }
 
+                    _req_memo_unlink(memo);
                     if (memo->send_limit >= 0) {        /* if confirmable */
                         *memo->msg.data.pdu_buf = 0;    /* clear resend PDU buffer */
                     }
@@ -321,6 +365,7 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                     if (obs_slot >= 0) {
                         observer = &_coap_state.observers[obs_slot];
                         memcpy(observer, remote, sizeof(sock_udp_ep_t));
+                        _observer_link(observer);
                     } else {
                         DEBUG("gcoap: can't register observer\n");
                     }
@@ -337,12 +382,15 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         }
         /* finish registration */
         if (memo != NULL) {
+            /* re-index the memo with its new resource and token */
+            _obs_memo_unlink(memo);
             /* resource may be assigned here if it is not already registered */
             memo->resource = resource;
             memo->token_len = coap_get_token_len(pdu);
             if (memo->token_len) {
                 memcpy(&memo->token[0], pdu->token, memo->token_len);
             }
+            _obs_memo_link(memo);
             DEBUG("gcoap: Registered observer for: %s\n", memo->resource->path);
         }
 
@@ -351,12 +399,13 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         /* clear memo, and clear observer if no other memos */
         if (memo != NULL) {
             DEBUG("gcoap: Deregistering observer for: %s\n", memo->resource->path);
-            memo->observer = NULL;
+            _obs_memo_release(memo);
             memo           = NULL;
             _find_obs_memo(&memo, remote, NULL);
             if (memo == NULL) {
                 _find_observer(&observer, remote);
                 if (observer != NULL) {
+                    _observer_unlink(observer);
                     observer->family = AF_UNSPEC;
                 }
             }
@@ -377,6 +426,30 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     return pdu_len;
 }
 
+#if IS_USED(MODULE_GCOAP_RESOURCE_TRIE)
+/*
+ * Adds listeners registered since the last call to the resource trie.
+ *
+ * return true if all listeners are in the trie, false if it is full
+ */
+static bool _update_resource_trie(void)
+{
+    gcoap_listener_t *listener = (_trie_last) ? _trie_last->next
+                                              : _coap_state.listeners;
+
+    while (listener && !_trie_full) {
+        if (!_gcoap_resource_trie_add(listener)) {
+            DEBUG("gcoap: resource trie full, using linear search\n");
+            _trie_full = true;
+            break;
+        }
+        _trie_last = listener;
+        listener = listener->next;
+    }
+    return !_trie_full;
+}
+#endif
+
 /*
  * Searches listener registrations for the resource matching the path in a PDU.
  *
@@ -390,6 +463,12 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 static int _find_resource(coap_pkt_t *pdu, const coap_resource_t **resource_ptr,
                                             gcoap_listener_t **listener_ptr)
 {
+#if IS_USED(MODULE_GCOAP_RESOURCE_TRIE)
+    if (_update_resource_trie()) {
+        return _gcoap_resource_trie_find(pdu, resource_ptr, listener_ptr);
+    }
+#endif
+
     int ret = GCOAP_RESOURCE_NO_PATH;
     coap_method_flags_t method_flag = coap_method2flag(coap_get_code_detail(pdu));
 
@@ -433,6 +512,222 @@ static int _find_resource(coap_pkt_t *pdu, const coap_resource_t **resource_ptr,
     return ret;
 }
 
+#if IS_USED(MODULE_GCOAP_MEMO_HASH)
+/* FNV-1a, continued from hash */
+static uint32_t _hash_buf(uint32_t hash, const void *buf, size_t len)
+{
+    const uint8_t *bytes = buf;
+
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ bytes[i]) * 16777619U;
+    }
+    return hash;
+}
+
+/* hashes what sock_udp_ep_equal() compares */
+static uint32_t _hash_ep(const sock_udp_ep_t *ep)
+{
+    uint32_t hash = _hash_buf(2166136261U, &ep->port, sizeof(ep->port));
+
+    switch (ep->family) {
+#ifdef SOCK_HAS_IPV6
+        case AF_INET6:
+            return _hash_buf(hash, ep->addr.ipv6, sizeof(ep->addr.ipv6));
+#endif
+        case AF_INET:
+            return _hash_buf(hash, ep->addr.ipv4, sizeof(ep->addr.ipv4));
+        default:
+            return hash;
+    }
+}
+
+static inline unsigned _bucket(uint32_t hash)
+{
+    return hash & (MEMO_HASH_BUCKETS - 1);
+}
+
+static unsigned _req_memo_bucket(const uint8_t *token, unsigned token_len,
+                                 const sock_udp_ep_t *remote)
+{
+    return _bucket(_hash_buf(_hash_ep(remote), token, token_len));
+}
+
+static unsigned _observer_bucket(const sock_udp_ep_t *remote)
+{
+    return _bucket(_hash_ep(remote));
+}
+
+static unsigned _obs_memo_token_bucket(const sock_udp_ep_t *observer,
+                                       const uint8_t *token, unsigned token_len)
+{
+    return _bucket(_hash_buf(_hash_buf(2166136261U, &observer, sizeof(observer)),
+                             token, token_len));
+}
+
+static unsigned _obs_memo_resource_bucket(const coap_resource_t *resource)
+{
+    return _bucket(_hash_buf(2166136261U, &resource, sizeof(resource)));
+}
+
+static void _hash_link(uint16_t *bucket, uint16_t *next, unsigned idx)
+{
+    next[idx] = *bucket;
+    *bucket = idx;
+}
+
+static void _hash_unlink(uint16_t *bucket, uint16_t *next, unsigned idx)
+{
+    for (uint16_t *ptr = bucket; *ptr != MEMO_HASH_NONE; ptr = &next[*ptr]) {
+        if (*ptr == idx) {
+            *ptr = next[idx];
+            next[idx] = MEMO_HASH_NONE;
+            return;
+        }
+    }
+}
+
+static unsigned _req_memo_hash_bucket(gcoap_request_memo_t *memo)
+{
+    coap_hdr_t *hdr = (memo->send_limit == GCOAP_SEND_LIMIT_NON)
+                    ? (coap_hdr_t *)&memo->msg.hdr_buf[0]
+                    : (coap_hdr_t *)memo->msg.data.pdu_buf;
+
+    return _req_memo_bucket(coap_hdr_data_ptr(hdr), hdr->ver_t_tkl & 0xf,
+                            &memo->remote_ep);
+}
+#endif
+
+/*
+ * Indexes an open request by its token and remote endpoint.
+ *
+ * Must be called with _coap_state.lock held, after the request was copied to
+ * the memo.
+ */
+static void _req_memo_link(gcoap_request_memo_t *memo)
+{
+#if IS_USED(MODULE_GCOAP_MEMO_HASH)
+    _hash_link(&_coap_state.hash.req[_req_memo_hash_bucket(memo)],
+               _coap_state.hash.req_next, memo - _coap_state.open_reqs);
+#else
+    (void)memo;
+#endif
+}
+
+/*
+ * Removes an open request from the index. Must be called before its memo is
+ * released and its resend buffer is cleared.
+ */
+static void _req_memo_unlink(gcoap_request_memo_t *memo)
+{
+#if IS_USED(MODULE_GCOAP_MEMO_HASH)
+    mutex_lock(&_coap_state.lock);
+    _hash_unlink(&_coap_state.hash.req[_req_memo_hash_bucket(memo)],
+                 _coap_state.hash.req_next, memo - _coap_state.open_reqs);
+    mutex_unlock(&_coap_state.lock);
+#else
+    (void)memo;
+#endif
+}
+
+/*
+ * Indexes an observer by its endpoint. Must be called when a free observer is
+ * taken, i.e. the empty slot returned by _find_observer().
+ */
+static void _observer_link(sock_udp_ep_t *observer)
+{
+#if IS_USED(MODULE_GCOAP_MEMO_HASH)
+    unsigned idx = observer - _coap_state.observers;
+
+    assert(_coap_state.hash.observer_free == idx);
+    _coap_state.hash.observer_free = _coap_state.hash.observer_next[idx];
+    _hash_link(&_coap_state.hash.observer[_observer_bucket(observer)],
+               _coap_state.hash.observer_next, idx);
+#else
+    (void)observer;
+#endif
+}
+
+/*
+ * Removes an observer from the index and adds it to the free observers before
+ * it is released.
+ */
+static void _observer_unlink(sock_udp_ep_t *observer)
+{
+#if IS_USED(MODULE_GCOAP_MEMO_HASH)
+    unsigned idx = observer - _coap_state.observers;
+
+    _hash_unlink(&_coap_state.hash.observer[_observer_bucket(observer)],
+                 _coap_state.hash.observer_next, idx);
+    _hash_link(&_coap_state.hash.observer_free, _coap_state.hash.observer_next,
+               idx);
+#else
+    (void)observer;
+#endif
+}
+
+/*
+ * Indexes an observe memo by observer and token, by observer, and by resource.
+ * Takes the memo from the free memos if it is the empty slot returned by
+ * _find_obs_memo().
+ */
+static void _obs_memo_link(gcoap_observe_memo_t *memo)
+{
+#if IS_USED(MODULE_GCOAP_MEMO_HASH)
+    unsigned idx = memo - _coap_state.observe_memos;
+
+    if (_coap_state.hash.obs_memo_free == idx) {
+        _coap_state.hash.obs_memo_free = _coap_state.hash.obs_token_next[idx];
+    }
+    _hash_link(&_coap_state.hash.obs_observer[memo->observer - _coap_state.observers],
+               _coap_state.hash.obs_observer_next, idx);
+    _hash_link(&_coap_state.hash.obs_token[_obs_memo_token_bucket(memo->observer,
+                                                                  memo->token,
+                                                                  memo->token_len)],
+               _coap_state.hash.obs_token_next, idx);
+    mutex_lock(&_coap_state.lock);
+    _hash_link(&_coap_state.hash.obs_resource[_obs_memo_resource_bucket(memo->resource)],
+               _coap_state.hash.obs_resource_next, idx);
+    mutex_unlock(&_coap_state.lock);
+#else
+    (void)memo;
+#endif
+}
+
+/*
+ * Removes an observe memo from the indices before its observer, resource or
+ * token change. Does nothing if the memo is not indexed.
+ */
+static void _obs_memo_unlink(gcoap_observe_memo_t *memo)
+{
+#if IS_USED(MODULE_GCOAP_MEMO_HASH)
+    unsigned idx = memo - _coap_state.observe_memos;
+
+    _hash_unlink(&_coap_state.hash.obs_token[_obs_memo_token_bucket(memo->observer,
+                                                                    memo->token,
+                                                                    memo->token_len)],
+                 _coap_state.hash.obs_token_next, idx);
+    _hash_unlink(&_coap_state.hash.obs_observer[memo->observer - _coap_state.observers],
+                 _coap_state.hash.obs_observer_next, idx);
+    mutex_lock(&_coap_state.lock);
+    _hash_unlink(&_coap_state.hash.obs_resource[_obs_memo_resource_bucket(memo->resource)],
+                 _coap_state.hash.obs_resource_next, idx);
+    mutex_unlock(&_coap_state.lock);
+#else
+    (void)memo;
+#endif
+}
+
+/* Removes an observe memo from the indices and releases it. */
+static void _obs_memo_release(gcoap_observe_memo_t *memo)
+{
+    _obs_memo_unlink(memo);
+    memo->observer = NULL;
+#if IS_USED(MODULE_GCOAP_MEMO_HASH)
+    _hash_link(&_coap_state.hash.obs_memo_free, _coap_state.hash.obs_token_next,
+               memo - _coap_state.observe_memos);
+#endif
+}
+
 /*
  * Finds the memo for an outstanding request within the _coap_state.open_reqs
  * array. Matches on remote endpoint and token.
@@ -441,37 +736,59 @@ static int _find_resource(coap_pkt_t *pdu, const coap_resource_t **resource_ptr,
  * src_pdu[in] -- PDU for token to match
  * remote[in] -- Remote endpoint to match
  */
-static void _find_req_memo(gcoap_request_memo_t **memo_ptr, coap_pkt_t *src_pdu,
-                           const sock_udp_ep_t *remote)
+static bool _req_memo_match(gcoap_request_memo_t *memo, coap_pkt_t *src_pdu,
+                            const sock_udp_ep_t *remote)
 {
-    *memo_ptr = NULL;
     /* no need to initialize struct; we only care about buffer contents below */
     coap_pkt_t memo_pdu_data;
     coap_pkt_t *memo_pdu = &memo_pdu_data;
     unsigned cmplen      = coap_get_token_len(src_pdu);
 
+    if (memo->send_limit == GCOAP_SEND_LIMIT_NON) {
+        memo_pdu->hdr = (coap_hdr_t *) &memo->msg.hdr_buf[0];
+    }
+    else {
+        memo_pdu->hdr = (coap_hdr_t *) memo->msg.data.pdu_buf;
+    }
+
+    if (coap_get_token_len(memo_pdu) == cmplen) {
+        memo_pdu->token = coap_hdr_data_ptr(memo_pdu->hdr);
+        return (memcmp(src_pdu->token, memo_pdu->token, cmplen) == 0)
+               && sock_udp_ep_equal(&memo->remote_ep, remote);
+    }
+    return false;
+}
+
+static void _find_req_memo(gcoap_request_memo_t **memo_ptr, coap_pkt_t *src_pdu,
+                           const sock_udp_ep_t *remote)
+{
+    *memo_ptr = NULL;
+
+#if IS_USED(MODULE_GCOAP_MEMO_HASH)
+    mutex_lock(&_coap_state.lock);
+    for (uint16_t i = _coap_state.hash.req[_req_memo_bucket(src_pdu->token,
+                                                 coap_get_token_len(src_pdu),
+                                                 remote)];
+         i != MEMO_HASH_NONE; i = _coap_state.hash.req_next[i]) {
+        if (_req_memo_match(&_coap_state.open_reqs[i], src_pdu, remote)) {
+            *memo_ptr = &_coap_state.open_reqs[i];
+            break;
+        }
+    }
+    mutex_unlock(&_coap_state.lock);
+#else
     for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
         if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
             continue;
         }
 
         gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
-        if (memo->send_limit == GCOAP_SEND_LIMIT_NON) {
-            memo_pdu->hdr = (coap_hdr_t *) &memo->msg.hdr_buf[0];
-        }
-        else {
-            memo_pdu->hdr = (coap_hdr_t *) memo->msg.data.pdu_buf;
-        }
-
-        if (coap_get_token_len(memo_pdu) == cmplen) {
-            memo_pdu->token = coap_hdr_data_ptr(memo_pdu->hdr);
-            if ((memcmp(src_pdu->token, memo_pdu->token, cmplen) == 0)
-                    && sock_udp_ep_equal(&memo->remote_ep, remote)) {
-                *memo_ptr = memo;
-                break;
-            }
+        if (_req_memo_match(memo, src_pdu, remote)) {
+            *memo_ptr = memo;
+            break;
         }
     }
+#endif
 }
 
 /* Calls handler callback on receipt of a timeout message. */
@@ -491,6 +808,7 @@ static void _expire_request(gcoap_request_memo_t *memo)
             }
             memo->resp_handler(memo, &req, NULL);
         }
+        _req_memo_unlink(memo);
         if (memo->send_limit != GCOAP_SEND_LIMIT_NON) {
             *memo->msg.data.pdu_buf = 0;    /* clear resend buffer */
         }
@@ -533,6 +851,20 @@ static int _find_observer(sock_udp_ep_t **observer, sock_udp_ep_t *remote)
 {
     int empty_slot = -1;
     *observer      = NULL;
+
+#if IS_USED(MODULE_GCOAP_MEMO_HASH)
+    for (uint16_t i = _coap_state.hash.observer[_observer_bucket(remote)];
+         i != MEMO_HASH_NONE; i = _coap_state.hash.observer_next[i]) {
+        if (sock_udp_ep_equal(&_coap_state.observers[i], remote)) {
+            *observer = &_coap_state.observers[i];
+            return empty_slot;
+        }
+    }
+    /* every observer is indexed, so the miss is final */
+    if (_coap_state.hash.observer_free != MEMO_HASH_NONE) {
+        empty_slot = _coap_state.hash.observer_free;
+    }
+#else
     for (unsigned i = 0; i < CONFIG_GCOAP_OBS_CLIENTS_MAX; i++) {
 
         if (_coap_state.observers[i].family == AF_UNSPEC) {
@@ -543,9 +875,21 @@ static int _find_observer(sock_udp_ep_t **observer, sock_udp_ep_t *remote)
             break;
         }
     }
+#endif
     return empty_slot;
 }
 
+/* Tests if an observe memo is for the observer and the token of a PDU. */
+static bool _obs_memo_match(const gcoap_observe_memo_t *memo,
+                            const sock_udp_ep_t *observer, coap_pkt_t *pdu)
+{
+    unsigned cmplen = memo->token_len;
+
+    return (memo->observer == observer)
+           && (cmplen == coap_get_token_len(pdu))
+           && cmplen && (memcmp(&memo->token[0], &pdu->token[0], cmplen) == 0);
+}
+
 /*
  * Find registered observe memo for a remote address and token.
  *
@@ -565,6 +909,36 @@ static int _find_obs_memo(gcoap_observe_memo_t **memo, sock_udp_ep_t *remote,
     sock_udp_ep_t *remote_observer = NULL;
     _find_observer(&remote_observer, remote);
 
+#if IS_USED(MODULE_GCOAP_MEMO_HASH)
+    /* every memo in use is indexed, so a miss is final */
+    if (_coap_state.hash.obs_memo_free != MEMO_HASH_NONE) {
+        empty_slot = _coap_state.hash.obs_memo_free;
+    }
+    if (remote_observer == NULL) {
+        return empty_slot;
+    }
+    if (pdu == NULL) {
+        uint16_t i = _coap_state.hash.obs_observer[remote_observer -
+                                                   _coap_state.observers];
+
+        if (i != MEMO_HASH_NONE) {
+            *memo = &_coap_state.observe_memos[i];
+        }
+        return empty_slot;
+    }
+
+    unsigned bucket = _obs_memo_token_bucket(remote_observer, pdu->token,
+                                             coap_get_token_len(pdu));
+
+    for (uint16_t i = _coap_state.hash.obs_token[bucket];
+         i != MEMO_HASH_NONE; i = _coap_state.hash.obs_token_next[i]) {
+        if (_obs_memo_match(&_coap_state.observe_memos[i], remote_observer,
+                            pdu)) {
+            *memo = &_coap_state.observe_memos[i];
+            break;
+        }
+    }
+#else
     for (unsigned i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
         if (_coap_state.observe_memos[i].observer == NULL) {
             empty_slot = i;
@@ -577,17 +951,14 @@ static int _find_obs_memo(gcoap_observe_memo_t **memo, sock_udp_ep_t *remote,
                 break;
             }
 
-            if (_coap_state.observe_memos[i].token_len == coap_get_token_len(pdu)) {
-                unsigned cmplen = _coap_state.observe_memos[i].token_len;
-                if (cmplen &&
-                        memcmp(&_coap_state.observe_memos[i].token[0], &pdu->token[0],
-                                                                       cmplen) == 0) {
-                    *memo = &_coap_state.observe_memos[i];
-                    break;
-                }
+            if (_obs_memo_match(&_coap_state.observe_memos[i], remote_observer,
+                                pdu)) {
+                *memo = &_coap_state.observe_memos[i];
+                break;
             }
         }
     }
+#endif
     return empty_slot;
 }
 
@@ -601,13 +972,22 @@ static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
                                    const coap_resource_t *resource)
 {
     *memo = NULL;
+#if IS_USED(MODULE_GCOAP_MEMO_HASH)
+    mutex_lock(&_coap_state.lock);
+    for (uint16_t i = _coap_state.hash.obs_resource[_obs_memo_resource_bucket(resource)];
+         i != MEMO_HASH_NONE; i = _coap_state.hash.obs_resource_next[i]) {
+#else
     for (int i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
+#endif
         if (_coap_state.observe_memos[i].observer != NULL
                 && _coap_state.observe_memos[i].resource == resource) {
             *memo = &_coap_state.observe_memos[i];
             break;
         }
     }
+#if IS_USED(MODULE_GCOAP_MEMO_HASH)
+    mutex_unlock(&_coap_state.lock);
+#endif
 }
 
 /*
@@ -628,6 +1008,19 @@ kernel_pid_t gcoap_init(void)
     memset(&_coap_state.observers[0], 0, sizeof(_coap_state.observers));
     memset(&_coap_state.observe_memos[0], 0, sizeof(_coap_state.observe_memos));
     memset(&_coap_state.resend_bufs[0], 0, sizeof(_coap_state.resend_bufs));
+#if IS_USED(MODULE_GCOAP_MEMO_HASH)
+    /* all bytes 0xff is MEMO_HASH_NONE */
+    memset(&_coap_state.hash, 0xff, sizeof(_coap_state.hash));
+    /* push backwards, so free entries are taken in ascending order */
+    for (unsigned i = CONFIG_GCOAP_OBS_CLIENTS_MAX; i > 0; i--) {
+        _hash_link(&_coap_state.hash.observer_free,
+                   _coap_state.hash.observer_next, i - 1);
+    }
+    for (unsigned i = CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i > 0; i--) {
+        _hash_link(&_coap_state.hash.obs_memo_free,
+                   _coap_state.hash.obs_token_next, i - 1);
+    }
+#endif
     /* randomize initial value */
     atomic_init(&_coap_state.next_message_id, (unsigned)random_uint32());
 
@@ -755,6 +1148,9 @@ size_t gcoap_req_send(const uint8_t *buf, size_t len,
             DEBUG("gcoap: illegal msg type %u\n", msg_type);
             break;
         }
+        if (memo->state != GCOAP_MEMO_UNUSED) {
+            _req_memo_link(memo);
+        }
         mutex_unlock(&_coap_state.lock);
         if (memo->state == GCOAP_MEMO_UNUSED) {
             return 0;
@@ -777,6 +1173,7 @@ size_t gcoap_req_send(const uint8_t *buf, size_t len,
     ssize_t res = sock_udp_send(&_sock, buf, len, remote);
     if (res <= 0) {
         if (memo != NULL) {
+            _req_memo_unlink(memo);
             if (msg_type == COAP_TYPE_CON) {
                 *memo->msg.data.pdu_buf = 0;    /* clear resend buffer */
             }
@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gcoap
+ * @{
+ *
+ * @file
+ * @brief       Radix trie index over the resources of all gcoap listeners
+ *
+ * The trie is character based over coap_resource_t::path, so subtree
+ * resources keep their prefix semantics (`/res` also matches `/resalt`). Edge
+ * labels point into the (constant) resource paths, so no path is copied.
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "net/gcoap.h"
+
+#include "_gcoap_resource_trie.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#if IS_USED(MODULE_GCOAP_RESOURCE_TRIE)
+
+/* every resource path adds at most one leaf and one split node */
+#define _NODES_NUMOF    (2 * CONFIG_GCOAP_RESOURCE_TRIE_NUMOF + 1)
+#define _NONE           (UINT16_MAX)
+#define _ROOT           (0U)
+
+typedef struct {
+    const char *label;  /**< edge label, not NUL-terminated */
+    uint16_t label_len; /**< length of _node_t::label */
+    uint16_t child;     /**< first child; children differ in label[0] */
+    uint16_t sibling;   /**< next sibling */
+    uint16_t entries;   /**< first resource with the path ending here */
+} _node_t;
+
+typedef struct {
+    const coap_resource_t *resource;
+    gcoap_listener_t *listener;
+    uint16_t next;      /**< next resource with the same path */
+} _entry_t;
+
+static _node_t _nodes[_NODES_NUMOF];
+static _entry_t _entries[CONFIG_GCOAP_RESOURCE_TRIE_NUMOF];
+static uint16_t _nodes_numof;
+static uint16_t _entries_numof;
+
+static uint16_t _node_alloc(const char *label, unsigned label_len)
+{
+    _node_t *node = &_nodes[_nodes_numof];
+
+    assert(_nodes_numof < _NODES_NUMOF);
+    node->label = label;
+    node->label_len = label_len;
+    node->child = _NONE;
+    node->sibling = _NONE;
+    node->entries = _NONE;
+    return _nodes_numof++;
+}
+
+static uint16_t _find_child(const _node_t *node, char c)
+{
+    uint16_t idx = node->child;
+
+    while ((idx != _NONE) && (_nodes[idx].label[0] != c)) {
+        idx = _nodes[idx].sibling;
+    }
+    return idx;
+}
+
+static void _entries_append(_node_t *node, uint16_t entry)
+{
+    uint16_t *ptr = &node->entries;
+
+    /* entries are added in registration order which is also the precedence */
+    while (*ptr != _NONE) {
+        ptr = &_entries[*ptr].next;
+    }
+    *ptr = entry;
+}
+
+/* returns the node for path, adding up to two nodes */
+static uint16_t _insert(const char *path)
+{
+    uint16_t idx = _ROOT;
+    size_t len = strlen(path);
+
+    assert(len < UINT16_MAX);
+    while (len > 0) {
+        uint16_t child = _find_child(&_nodes[idx], path[0]);
+        _node_t *node;
+        unsigned common = 1;
+
+        if (child == _NONE) {
+            child = _node_alloc(path, len);
+            _nodes[child].sibling = _nodes[idx].child;
+            _nodes[idx].child = child;
+            return child;
+        }
+        node = &_nodes[child];
+        while ((common < node->label_len) && (common < len) &&
+               (node->label[common] == path[common])) {
+            common++;
+        }
+        if (common < node->label_len) {
+            /* split node: the remainder of its label moves to a new child */
+            uint16_t split = _node_alloc(&node->label[common],
+                                         node->label_len - common);
+
+            _nodes[split].child = node->child;
+            _nodes[split].entries = node->entries;
+            node->label_len = common;
+            node->child = split;
+            node->entries = _NONE;
+        }
+        idx = child;
+        path += common;
+        len -= common;
+    }
+    return idx;
+}
+
+bool _gcoap_resource_trie_add(gcoap_listener_t *listener)
+{
+    if (_nodes_numof == 0) {
+        _node_alloc("", 0);
+    }
+    if ((_entries_numof + listener->resources_len) >
+        CONFIG_GCOAP_RESOURCE_TRIE_NUMOF) {
+        DEBUG("gcoap: resource trie full\n");
+        return false;
+    }
+    for (size_t i = 0; i < listener->resources_len; i++) {
+        _entry_t *entry = &_entries[_entries_numof];
+
+        entry->resource = &listener->resources[i];
+        entry->listener = listener;
+        entry->next = _NONE;
+        _entries_append(&_nodes[_insert(entry->resource->path)],
+                        _entries_numof++);
+    }
+    return true;
+}
+
+typedef struct {
+    coap_method_flags_t method_flag;
+    uint16_t best;      /* first matching resource allowing the method */
+    bool path_found;
+} _match_t;
+
+static void _match_entries(_match_t *match, const _node_t *node, bool exact)
+{
+    for (uint16_t idx = node->entries; idx != _NONE; idx = _entries[idx].next) {
+        const coap_resource_t *resource = _entries[idx].resource;
+
+        if (!exact && !(resource->methods & COAP_MATCH_SUBTREE)) {
+            continue;
+        }
+        match->path_found = true;
+        if ((resource->methods & match->method_flag) && (idx < match->best)) {
+            match->best = idx;
+        }
+    }
+}
+
+/* advances (*idx, *pos) in the trie by one character of the request path */
+static bool _step(uint16_t *idx, unsigned *pos, char c)
+{
+    const _node_t *node = &_nodes[*idx];
+
+    if (*pos < node->label_len) {
+        if (node->label[*pos] != c) {
+            return false;
+        }
+        (*pos)++;
+        return true;
+    }
+    *idx = _find_child(node, c);
+    *pos = 1;
+    return (*idx != _NONE);
+}
+
+int _gcoap_resource_trie_find(coap_pkt_t *pdu,
+                              const coap_resource_t **resource_ptr,
+                              gcoap_listener_t **listener_ptr)
+{
+    _match_t match = {
+        .method_flag = coap_method2flag(coap_get_code_detail(pdu)),
+        .best = _NONE,
+    };
+    coap_optpos_t opt;
+    uint8_t *value;
+    uint16_t idx = _ROOT;
+    unsigned pos = 0;
+    bool first = true, segments = false;
+    ssize_t len;
+
+    while ((len = coap_opt_get_next(pdu, &opt, &value, first)) >= 0) {
+        first = false;
+        if (opt.opt_num < COAP_OPT_URI_PATH) {
+            continue;
+        }
+        if (opt.opt_num > COAP_OPT_URI_PATH) {
+            break;
+        }
+        segments = true;
+        /* every segment is preceded by a '/' in coap_resource_t::path */
+        if (!_step(&idx, &pos, '/')) {
+            goto out;
+        }
+        for (ssize_t i = 0; i < len; i++) {
+            if (pos == _nodes[idx].label_len) {
+                /* a registered path ends here: subtree resources match */
+                _match_entries(&match, &_nodes[idx], false);
+            }
+            if (!_step(&idx, &pos, (char)value[i])) {
+                goto out;
+            }
+        }
+        if (pos == _nodes[idx].label_len) {
+            _match_entries(&match, &_nodes[idx], false);
+        }
+    }
+    if (!segments && !_step(&idx, &pos, '/')) {
+        /* no Uri-Path is the same as path "/" */
+        goto out;
+    }
+    if (pos == _nodes[idx].label_len) {
+        _match_entries(&match, &_nodes[idx], true);
+    }
+out:
+    if (match.best != _NONE) {
+        *resource_ptr = _entries[match.best].resource;
+        *listener_ptr = _entries[match.best].listener;
+        return GCOAP_RESOURCE_FOUND;
+    }
+    return (match.path_found) ? GCOAP_RESOURCE_WRONG_METHOD
+                              : GCOAP_RESOURCE_NO_PATH;
+}
+
+#else   /* MODULE_GCOAP_RESOURCE_TRIE */
+typedef int dont_be_pedantic;
+#endif  /* MODULE_GCOAP_RESOURCE_TRIE */
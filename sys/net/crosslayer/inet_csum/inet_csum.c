@@ -13,13 +13,138 @@
  */
 
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
+#include "byteorder.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+#if defined(CPU_NATIVE) && (defined(__i386__) || defined(__x86_64__))
+/* the host may support SSE2 even if the compiler was not told so (native is
+ * built with -m32), so its availability is checked at runtime */
+#include <emmintrin.h>
+#define INET_CSUM_SSE2
+#endif
+
+/* The 16-bit words are summed up in host byte order, which gives the
+ * byte-swapped sum on little-endian platforms (RFC 1071, section 2 (B)).
+ * Summing up 32-bit words instead is congruent modulo 0xffff, so all carries
+ * can be deferred to a single fold at the end. */
+
+static inline uint32_t _load32(const uint8_t *buf)
+{
+    uint32_t word;
+
+    /* compiles to a single load on platforms that allow unaligned access */
+    memcpy(&word, buf, sizeof(word));
+    return word;
+}
+
+static uint64_t _sum32(const uint8_t *buf, size_t len)
+{
+    uint64_t sum = 0;
+
+    for (; len >= 16; buf += 16, len -= 16) {
+        sum += (uint64_t)_load32(buf) + _load32(buf + 4) +
+               _load32(buf + 8) + _load32(buf + 12);
+    }
+    for (; len >= 4; buf += 4, len -= 4) {
+        sum += _load32(buf);
+    }
+    if (len >= 2) {
+        uint16_t word;
+
+        memcpy(&word, buf, sizeof(word));
+        sum += word;
+    }
+    return sum;
+}
+
+static uint64_t _copy_sum32(uint8_t *dst, const uint8_t *src, size_t len)
+{
+    uint64_t sum = 0;
+
+    for (; len >= 8; dst += 8, src += 8, len -= 8) {
+        uint32_t word0 = _load32(src), word1 = _load32(src + 4);
+
+        memcpy(dst, &word0, sizeof(word0));
+        memcpy(dst + 4, &word1, sizeof(word1));
+        sum += (uint64_t)word0 + word1;
+    }
+    for (; len >= 2; dst += 2, src += 2, len -= 2) {
+        uint16_t word;
+
+        memcpy(&word, src, sizeof(word));
+        memcpy(dst, &word, sizeof(word));
+        sum += word;
+    }
+    return sum;
+}
+
+/* folds a sum of words read in host byte order to a 16-bit sum in network
+ * byte order, the result is 0 only if sum is 0 */
+static uint16_t _fold(uint64_t sum)
+{
+    while (sum >> 16) {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    return ntohs((uint16_t)sum);
+}
+
+#ifdef INET_CSUM_SSE2
+static bool _sse2_supported(void)
+{
+    static int supported = -1;
+
+    if (supported < 0) {
+        /* we may be called from a constructor */
+        __builtin_cpu_init();
+        supported = __builtin_cpu_supports("sse2");
+    }
+    return supported;
+}
+
+__attribute__((target("sse2")))
+static uint64_t _sum_sse2(const uint8_t *buf, size_t len)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i sum = zero;
+    uint32_t lanes[4];
+
+    /* zero-extends the 16-bit words to 32-bit lanes, they can't overflow as
+     * len is at most UINT16_MAX */
+    for (; len >= 16; buf += 16, len -= 16) {
+        __m128i words = _mm_loadu_si128((const __m128i *)buf);
+
+        sum = _mm_add_epi32(sum, _mm_unpacklo_epi16(words, zero));
+        sum = _mm_add_epi32(sum, _mm_unpackhi_epi16(words, zero));
+    }
+    _mm_storeu_si128((__m128i *)lanes, sum);
+    return (uint64_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+#endif
+
+/* sums up the 16-bit words in the even length len at buf in network byte
+ * order, the result is 0 only if all words are 0 */
+static uint16_t _sum_words(const uint8_t *buf, size_t len)
+{
+    uint64_t sum = 0;
+
+#ifdef INET_CSUM_SSE2
+    if ((len >= 64) && _sse2_supported()) {
+        sum = _sum_sse2(buf, len);
+        buf += len & ~0xfU;
+        len &= 0xfU;
+    }
+#endif
+    sum += _sum32(buf, len);
+    return _fold(sum);
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -44,10 +169,8 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         accum_len++;
     }
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
-    }
+    csum += _sum_words(buf, len & ~1U);   /* add all 16-bit words */
+    buf += len & ~1U;
 
     if ((accum_len + len) & 1)          /* if accumulated length is odd */
         csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
@@ -62,4 +185,21 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
     return csum;
 }
 
+uint16_t inet_csum_copy(uint16_t sum, uint8_t *dst, const uint8_t *src,
+                        uint16_t len)
+{
+    uint32_t csum = sum;
+
+    csum += _fold(_copy_sum32(dst, src, len & ~1U));
+    if (len & 1) {
+        dst[len - 1] = src[len - 1];
+        csum += (uint16_t)(src[len - 1] << 8);
+    }
+    while (csum >> 16) {
+        uint16_t carry = csum >> 16;
+        csum = (csum & 0xffff) + carry;
+    }
+    return csum;
+}
+
 /** @} */
@@ -122,6 +122,7 @@ static const char *_netopt_strmap[] = {
     [NETOPT_NUM_GATEWAYS]          = "NETOPT_NUM_GATEWAYS",
     [NETOPT_LINK_CHECK]            = "NETOPT_LINK_CHECK",
     [NETOPT_RSSI]                  = "NETOPT_RSSI",
+    [NETOPT_RX_BATCH_STATS]        = "NETOPT_RX_BATCH_STATS",
     [NETOPT_NUMOF]                 = "NETOPT_NUMOF",
 };
 
@@ -25,6 +25,9 @@
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/netapi.h"
+#ifdef MODULE_TRACE_EVENT
+#include "trace_event.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -53,6 +56,11 @@ int _gnrc_netapi_get_set(kernel_pid_t pid, netopt_t opt, uint16_t context,
 int _gnrc_netapi_send_recv(kernel_pid_t pid, gnrc_pktsnip_t *pkt, uint16_t type)
 {
     msg_t msg;
+#ifdef MODULE_TRACE_EVENT
+    trace_event(TRACE_EVENT_FLOW, (type == GNRC_NETAPI_MSG_TYPE_SND)
+                                  ? "gnrc_netapi_send" : "gnrc_netapi_receive",
+                (uintptr_t)pkt);
+#endif
     /* set the outgoing message's fields */
     msg.type = type;
     msg.content.ptr = (void *)pkt;
@@ -81,6 +89,51 @@ static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt
 }
 #endif
 
+static void _dispatch_entry(const gnrc_netreg_entry_t *sendto, uint16_t cmd,
+                            gnrc_pktsnip_t *pkt)
+{
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_BATCH)
+    uint32_t status = 0;
+    switch (sendto->type) {
+        case GNRC_NETREG_TYPE_DEFAULT:
+#ifdef MODULE_GNRC_NETAPI_BATCH
+        case GNRC_NETREG_TYPE_BATCH:
+#endif
+            if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
+                /* unable to dispatch packet */
+                status = EIO;
+            }
+            break;
+#ifdef MODULE_GNRC_NETAPI_MBOX
+        case GNRC_NETREG_TYPE_MBOX:
+            if (_snd_rcv_mbox(sendto->target.mbox, cmd, pkt) < 1) {
+                /* unable to dispatch packet */
+                status = EIO;
+            }
+            break;
+#endif
+#ifdef MODULE_GNRC_NETAPI_CALLBACKS
+        case GNRC_NETREG_TYPE_CB:
+            sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
+            break;
+#endif
+        default:
+            /* unknown dispatch type */
+            status = ECANCELED;
+            break;
+    }
+    if (status != 0) {
+        gnrc_pktbuf_release_error(pkt, status);
+    }
+#else
+    if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
+        /* unable to dispatch packet */
+        gnrc_pktbuf_release_error(pkt, EIO);
+    }
+#endif
+}
+
 int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
                          uint16_t cmd, gnrc_pktsnip_t *pkt)
 {
@@ -92,46 +145,95 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
         gnrc_pktbuf_hold(pkt, numof - 1);
 
         while (sendto) {
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
-            uint32_t status = 0;
-            switch (sendto->type) {
-                case GNRC_NETREG_TYPE_DEFAULT:
-                    if (_gnrc_netapi_send_recv(sendto->target.pid, pkt,
-                                               cmd) < 1) {
-                        /* unable to dispatch packet */
-                        status = EIO;
-                    }
-                    break;
-#ifdef MODULE_GNRC_NETAPI_MBOX
-                case GNRC_NETREG_TYPE_MBOX:
-                    if (_snd_rcv_mbox(sendto->target.mbox, cmd, pkt) < 1) {
-                        /* unable to dispatch packet */
-                        status = EIO;
-                    }
-                    break;
-#endif
-#ifdef MODULE_GNRC_NETAPI_CALLBACKS
-                case GNRC_NETREG_TYPE_CB:
-                    sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
-                    break;
-#endif
-                default:
-                    /* unknown dispatch type */
-                    status = ECANCELED;
-                    break;
-            }
-            if (status != 0) {
-                gnrc_pktbuf_release_error(pkt, status);
-            }
-#else
-            if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
-                /* unable to dispatch packet */
-                gnrc_pktbuf_release_error(pkt, EIO);
-            }
-#endif
+            _dispatch_entry(sendto, cmd, pkt);
             sendto = gnrc_netreg_getnext(sendto);
         }
     }
 
     return numof;
 }
+
+#ifdef MODULE_GNRC_NETAPI_BATCH
+int gnrc_netapi_batch_dispatch_receive(gnrc_netapi_batch_t *batch,
+                                       gnrc_nettype_t type, uint32_t demux_ctx,
+                                       gnrc_pktsnip_t *pkt)
+{
+    int numof = gnrc_netreg_num(type, demux_ctx);
+
+    if (numof == 0) {
+        return 0;
+    }
+    if ((batch->numof > 0) &&
+        ((batch->type != type) || (batch->demux_ctx != demux_ctx))) {
+        /* keep order of packets for subscribers of both */
+        gnrc_netapi_batch_flush(batch);
+    }
+    batch->type = type;
+    batch->demux_ctx = demux_ctx;
+    batch->pkts[batch->numof++] = pkt;
+    if (batch->numof >= CONFIG_GNRC_NETAPI_BATCH_SIZE) {
+        gnrc_netapi_batch_flush(batch);
+    }
+    return numof;
+}
+
+void gnrc_netapi_batch_flush(gnrc_netapi_batch_t *batch)
+{
+    gnrc_pktsnip_t *carrier = NULL;
+    gnrc_netreg_entry_t *sendto;
+    unsigned numof = batch->numof;
+    int subs, batch_subs = 0;
+
+    if (numof == 0) {
+        return;
+    }
+    batch->numof = 0;
+    /* subscribers might have changed since the packets were added */
+    subs = gnrc_netreg_num(batch->type, batch->demux_ctx);
+    if (subs == 0) {
+        for (unsigned i = 0; i < numof; i++) {
+            gnrc_pktbuf_release(batch->pkts[i]);
+        }
+        return;
+    }
+    sendto = gnrc_netreg_lookup(batch->type, batch->demux_ctx);
+    for (gnrc_netreg_entry_t *e = sendto; e != NULL;
+         e = gnrc_netreg_getnext(e)) {
+        batch_subs += (e->type == GNRC_NETREG_TYPE_BATCH);
+    }
+    if ((numof > 1) && (batch_subs > 0)) {
+        carrier = gnrc_pktbuf_add(NULL, batch->pkts,
+                                  numof * sizeof(batch->pkts[0]),
+                                  GNRC_NETTYPE_UNDEF);
+        if (carrier != NULL) {
+            gnrc_pktbuf_hold(carrier, batch_subs - 1);
+        }
+        else {
+            DEBUG("gnrc_netapi: unable to allocate batch, passing packets "
+                  "one by one\n");
+        }
+    }
+    for (unsigned i = 0; i < numof; i++) {
+        gnrc_pktbuf_hold(batch->pkts[i], subs - 1);
+    }
+    while (sendto) {
+        if ((carrier != NULL) && (sendto->type == GNRC_NETREG_TYPE_BATCH)) {
+            if (_gnrc_netapi_send_recv(sendto->target.pid, carrier,
+                                       GNRC_NETAPI_MSG_TYPE_RCV_BATCH) < 1) {
+                /* unable to dispatch batch */
+                for (unsigned i = 0; i < numof; i++) {
+                    gnrc_pktbuf_release_error(batch->pkts[i], EIO);
+                }
+                gnrc_pktbuf_release(carrier);
+            }
+        }
+        else {
+            for (unsigned i = 0; i < numof; i++) {
+                _dispatch_entry(sendto, GNRC_NETAPI_MSG_TYPE_RCV,
+                                batch->pkts[i]);
+            }
+        }
+        sendto = gnrc_netreg_getnext(sendto);
+    }
+}
+#endif
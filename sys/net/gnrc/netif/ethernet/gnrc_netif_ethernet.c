@@ -15,9 +15,10 @@
  * @author  Kaspar Schleiser <kaspar@schleiser.de>
  */
 
+#include <errno.h>
 #include <string.h>
 
-#include "net/ethernet/hdr.h"
+#include "net/ethernet.h"
 #include "net/gnrc.h"
 #include "net/gnrc/netif/ethernet.h"
 #ifdef MODULE_GNRC_IPV6
@@ -31,6 +32,15 @@
 #include "od.h"
 #endif
 
+/* received frames start at this offset in their snip, so the Ethernet header
+ * can be split off the payload in place */
+#define ETHERNET_RX_HEADROOM    GNRC_PKTBUF_MARK_HEADROOM(sizeof(ethernet_hdr_t))
+
+/* largest frame received: a frame of maximum size with an IEEE 802.1Q tag.
+ * Larger (jumbo) frames do not fit, drivers drop them (netdev_tap truncates
+ * them) */
+#define ETHERNET_RX_FRAME_LEN   (ETHERNET_FRAME_LEN + 4U)
+
 static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
 static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif);
 #ifdef MODULE_GNRC_SIXLOENC
@@ -168,88 +178,92 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 {
     netdev_t *dev = netif->dev;
-    int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
-    gnrc_pktsnip_t *pkt = NULL;
-
-    if (bytes_expected > 0) {
-        pkt = gnrc_pktbuf_add(NULL, NULL,
-                              bytes_expected,
-                              GNRC_NETTYPE_UNDEF);
-
-        if (!pkt) {
-            DEBUG("gnrc_netif_ethernet: cannot allocate pktsnip.\n");
-
-            /* drop the packet */
-            dev->driver->recv(dev, NULL, bytes_expected, NULL);
-
-            goto out;
-        }
+    gnrc_pktsnip_t *pkt, *eth_hdr, *netif_hdr;
+    ethernet_hdr_t *hdr;
+    uint8_t *frame;
+    int nread;
+
+    /* receive directly into a snip for a frame of maximum size, so the
+     * device is only asked once per frame (see netdev_driver_t::recv) */
+    pkt = gnrc_pktbuf_add(NULL, NULL, ETHERNET_RX_HEADROOM + ETHERNET_RX_FRAME_LEN,
+                          GNRC_NETTYPE_UNDEF);
+    if (!pkt) {
+        DEBUG("gnrc_netif_ethernet: cannot allocate pktsnip.\n");
+
+        /* drop the packet */
+        dev->driver->recv(dev, NULL, ETHERNET_RX_FRAME_LEN, NULL);
+
+        return NULL;
+    }
 
-        int nread = dev->driver->recv(dev, pkt->data, bytes_expected, NULL);
-        if (nread <= 0) {
-            DEBUG("gnrc_netif_ethernet: read error.\n");
-            goto safe_out;
-        }
+    frame = (uint8_t *)pkt->data + ETHERNET_RX_HEADROOM;
+    nread = dev->driver->recv(dev, frame, ETHERNET_RX_FRAME_LEN, NULL);
+    if (nread == -ENOBUFS) {
+        DEBUG("gnrc_netif_ethernet: frame larger than %u bytes dropped.\n",
+              (unsigned)ETHERNET_RX_FRAME_LEN);
+        goto safe_out;
+    }
+    if (nread <= 0) {
+        DEBUG("gnrc_netif_ethernet: read error.\n");
+        goto safe_out;
+    }
 #ifdef MODULE_NETSTATS_L2
-        netif->stats.rx_count++;
-        netif->stats.rx_bytes += nread;
+    netif->stats.rx_count++;
+    netif->stats.rx_bytes += nread;
 #endif
 
-        if (nread < bytes_expected) {
-            /* we've got less than the expected packet size,
-             * so free the unused space.*/
+    if ((size_t)nread < ETHERNET_RX_FRAME_LEN) {
+        /* we've got less than the maximum frame size,
+         * so free the unused space.*/
 
-            DEBUG("gnrc_netif_ethernet: reallocating.\n");
-            gnrc_pktbuf_realloc_data(pkt, nread);
-        }
+        DEBUG("gnrc_netif_ethernet: reallocating.\n");
+        gnrc_pktbuf_realloc_data(pkt, ETHERNET_RX_HEADROOM + nread);
+    }
 
-        DEBUG("gnrc_netif_ethernet: received packet from %s of length %d\n",
-              gnrc_netif_addr_to_str(pkt->data, ETHERNET_ADDR_LEN, addr_str),
-              nread);
+    DEBUG("gnrc_netif_ethernet: received packet from %s of length %d\n",
+          gnrc_netif_addr_to_str(frame, ETHERNET_ADDR_LEN, addr_str),
+          nread);
 #if defined(MODULE_OD) && ENABLE_DEBUG
-        od_hex_dump(pkt->data, nread, OD_WIDTH_DEFAULT);
+    od_hex_dump(frame, nread, OD_WIDTH_DEFAULT);
 #endif
-        /* mark ethernet header */
-        gnrc_pktsnip_t *eth_hdr = gnrc_pktbuf_mark(pkt, sizeof(ethernet_hdr_t), GNRC_NETTYPE_UNDEF);
-        if (!eth_hdr) {
-            DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
-            goto safe_out;
-        }
+    /* mark headroom and ethernet header, this does not copy the payload */
+    eth_hdr = gnrc_pktbuf_mark(pkt, ETHERNET_RX_HEADROOM + sizeof(ethernet_hdr_t),
+                               GNRC_NETTYPE_UNDEF);
+    if (!eth_hdr) {
+        DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
+        goto safe_out;
+    }
 
-        ethernet_hdr_t *hdr = (ethernet_hdr_t *)eth_hdr->data;
+    hdr = (ethernet_hdr_t *)((uint8_t *)eth_hdr->data + ETHERNET_RX_HEADROOM);
 
 #ifdef MODULE_L2FILTER
-        if (!l2filter_pass(dev->filter, hdr->src, ETHERNET_ADDR_LEN)) {
-            DEBUG("gnrc_netif_ethernet: incoming packet filtered by l2filter\n");
-            goto safe_out;
-        }
+    if (!l2filter_pass(dev->filter, hdr->src, ETHERNET_ADDR_LEN)) {
+        DEBUG("gnrc_netif_ethernet: incoming packet filtered by l2filter\n");
+        goto safe_out;
+    }
 #endif
 
-        /* set payload type from ethertype */
-        pkt->type = gnrc_nettype_from_ethertype(byteorder_ntohs(hdr->type));
+    /* set payload type from ethertype */
+    pkt->type = gnrc_nettype_from_ethertype(byteorder_ntohs(hdr->type));
 
-        /* create netif header */
-        gnrc_pktsnip_t *netif_hdr;
-        netif_hdr = gnrc_pktbuf_add(NULL, NULL,
-                                    sizeof(gnrc_netif_hdr_t) + (2 * ETHERNET_ADDR_LEN),
-                                    GNRC_NETTYPE_NETIF);
+    /* create netif header */
+    netif_hdr = gnrc_pktbuf_add(NULL, NULL,
+                                sizeof(gnrc_netif_hdr_t) + (2 * ETHERNET_ADDR_LEN),
+                                GNRC_NETTYPE_NETIF);
 
-        if (netif_hdr == NULL) {
-            DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
-            pkt = eth_hdr;
-            goto safe_out;
-        }
+    if (netif_hdr == NULL) {
+        DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
+        goto safe_out;
+    }
 
-        gnrc_netif_hdr_init(netif_hdr->data, ETHERNET_ADDR_LEN, ETHERNET_ADDR_LEN);
-        gnrc_netif_hdr_set_src_addr(netif_hdr->data, hdr->src, ETHERNET_ADDR_LEN);
-        gnrc_netif_hdr_set_dst_addr(netif_hdr->data, hdr->dst, ETHERNET_ADDR_LEN);
-        gnrc_netif_hdr_set_netif(netif_hdr->data, netif);
+    gnrc_netif_hdr_init(netif_hdr->data, ETHERNET_ADDR_LEN, ETHERNET_ADDR_LEN);
+    gnrc_netif_hdr_set_src_addr(netif_hdr->data, hdr->src, ETHERNET_ADDR_LEN);
+    gnrc_netif_hdr_set_dst_addr(netif_hdr->data, hdr->dst, ETHERNET_ADDR_LEN);
+    gnrc_netif_hdr_set_netif(netif_hdr->data, netif);
 
-        gnrc_pktbuf_remove_snip(pkt, eth_hdr);
-        LL_APPEND(pkt, netif_hdr);
-    }
+    gnrc_pktbuf_remove_snip(pkt, eth_hdr);
+    LL_APPEND(pkt, netif_hdr);
 
-out:
     return pkt;
 
 safe_out:
@@ -1350,6 +1350,15 @@ static inline event_queue_t *_get_evq(gnrc_netif_t *netif)
  *
  * @return >0 if msg contains a new message
  */
+static void _flush_rx_batch(gnrc_netif_t *netif)
+{
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    gnrc_netapi_batch_flush(&netif->rx_batch);
+#else
+    (void)netif;
+#endif
+}
+
 static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
 {
     if (IS_USED(MODULE_GNRC_NETIF_EVENTS)) {
@@ -1374,6 +1383,8 @@ static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
             if (msg_waiting > 0) {
                 return;
             }
+            /* pass packets received so far up before blocking */
+            _flush_rx_batch(netif);
             DEBUG("gnrc_netif: waiting for events\n");
             /* Block the thread until something interesting happens */
             thread_flags_wait_any(THREAD_FLAG_MSG_WAITING | THREAD_FLAG_EVENT);
@@ -1381,6 +1392,10 @@ static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
     }
     else {
         /* Only messages used for event handling */
+        if (msg_avail() <= 0) {
+            /* pass packets received so far up before blocking */
+            _flush_rx_batch(netif);
+        }
         DEBUG("gnrc_netif: waiting for incoming messages\n");
         msg_receive(msg);
     }
@@ -1487,6 +1502,9 @@ static void *_gnrc_netif_thread(void *args)
     /* set up the event queue */
     event_queue_init(&netif->evq);
 #endif /* MODULE_GNRC_NETIF_EVENTS */
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    gnrc_netapi_batch_init(&netif->rx_batch);
+#endif
 
     /* setup the link-layer's message queue */
     msg_init_queue(msg_queue, GNRC_NETIF_MSG_QUEUE_SIZE);
@@ -1598,11 +1616,17 @@ static void *_gnrc_netif_thread(void *args)
     return NULL;
 }
 
-static void _pass_on_packet(gnrc_pktsnip_t *pkt)
+static void _pass_on_packet(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
     /* throw away packet if no one is interested */
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    if (!gnrc_netapi_batch_dispatch_receive(&netif->rx_batch, pkt->type,
+                                            GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+#else
+    (void)netif;
     if (!gnrc_netapi_dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL,
                                       pkt)) {
+#endif
         DEBUG("gnrc_netif: unable to forward packet of type %i\n", pkt->type);
         gnrc_pktbuf_release(pkt);
         return;
@@ -1637,7 +1661,7 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                  * Further packets will be sent on later TX_COMPLETE */
                 _send_queued_pkt(netif);
                 if (pkt) {
-                    _pass_on_packet(pkt);
+                    _pass_on_packet(netif, pkt);
                 }
                 break;
 #if IS_USED(MODULE_NETSTATS_L2) || IS_USED(MODULE_GNRC_NETIF_PKTQ)
@@ -30,20 +30,38 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
-/* The registry as lookup table by gnrc_nettype_t */
-static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
+/* bucket of the entries with GNRC_NETREG_DEMUX_CTX_ALL */
+#define _BUCKET_ALL         (GNRC_NETREG_BUCKETS)
+
+/* The registry as lookup table by gnrc_nettype_t and hashed demux context */
+static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF][GNRC_NETREG_BUCKETS + 1];
+
+static inline unsigned _bucket(uint32_t demux_ctx)
+{
+    if (demux_ctx == GNRC_NETREG_DEMUX_CTX_ALL) {
+        return _BUCKET_ALL;
+    }
+    /* demux contexts usually are ports or protocol numbers, so fold the
+     * upper bits into the lower ones */
+    return (demux_ctx ^ (demux_ctx >> 8) ^ (demux_ctx >> 16)) &
+           (GNRC_NETREG_BUCKETS - 1);
+}
 
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, sizeof(netreg));
 }
 
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 {
 #if DEVELHELP
 # if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
-    bool has_msg_q = (entry->type != GNRC_NETREG_TYPE_DEFAULT) ||
+    bool pid_target = (entry->type == GNRC_NETREG_TYPE_DEFAULT);
+#  ifdef MODULE_GNRC_NETAPI_BATCH
+    pid_target |= (entry->type == GNRC_NETREG_TYPE_BATCH);
+#  endif
+    bool has_msg_q = !pid_target ||
                      thread_has_msg_queue(thread_get(entry->target.pid));
 # else
     bool has_msg_q = thread_has_msg_queue(thread_get(entry->target.pid));
@@ -61,7 +79,7 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return -EINVAL;
     }
 
-    LL_PREPEND(netreg[type], entry);
+    LL_PREPEND(netreg[type][_bucket(entry->demux_ctx)], entry);
 
     return 0;
 }
@@ -72,7 +90,7 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return;
     }
 
-    LL_DELETE(netreg[type], entry);
+    LL_DELETE(netreg[type][_bucket(entry->demux_ctx)], entry);
 }
 
 /**
@@ -94,7 +112,8 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
+        gnrc_netreg_entry_t *head = (from) ? from->next :
+                                    netreg[type][_bucket(demux_ctx)];
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
     }
 
@@ -109,10 +128,15 @@ gnrc_netreg_entry_t *gnrc_netreg_lookup(gnrc_nettype_t type, uint32_t demux_ctx)
 int gnrc_netreg_num(gnrc_nettype_t type, uint32_t demux_ctx)
 {
     int num = 0;
-    gnrc_netreg_entry_t *entry = NULL;
 
-    while((entry = _netreg_lookup(entry, type, demux_ctx)) != NULL) {
-        num++;
+    if (_INVALID_TYPE(type)) {
+        return 0;
+    }
+    for (gnrc_netreg_entry_t *entry = netreg[type][_bucket(demux_ctx)];
+         entry != NULL; entry = entry->next) {
+        if (entry->demux_ctx == demux_ctx) {
+            num++;
+        }
     }
     return num;
 }
@@ -68,6 +68,11 @@ static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 kernel_pid_t gnrc_ipv6_pid = KERNEL_PID_UNDEF;
 
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+/* received packets for upper layers, passed on before the thread blocks */
+static gnrc_netapi_batch_t _rcv_batch;
+#endif
+
 /* handles GNRC_NETAPI_MSG_TYPE_RCV commands */
 static void _receive(gnrc_pktsnip_t *pkt);
 /* Sends packet over the appropriate interface(s).
@@ -141,6 +146,17 @@ ipv6_hdr_t *gnrc_ipv6_get_header(gnrc_pktsnip_t *pkt)
 }
 
 /* internal functions */
+static inline int _dispatch_receive(gnrc_nettype_t type, uint32_t demux_ctx,
+                                    gnrc_pktsnip_t *pkt)
+{
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    return gnrc_netapi_batch_dispatch_receive(&_rcv_batch, type, demux_ctx,
+                                              pkt);
+#else
+    return gnrc_netapi_dispatch_receive(type, demux_ctx, pkt);
+#endif
+}
+
 static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
                                   bool interested)
 {
@@ -153,9 +169,7 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
         gnrc_pktbuf_hold(pkt, 1);   /* don't remove from packet buffer in
                                      * next dispatch */
     }
-    if (gnrc_netapi_dispatch_receive(pkt->type,
-                                     GNRC_NETREG_DEMUX_CTX_ALL,
-                                     pkt) == 0) {
+    if (_dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL, pkt) == 0) {
         gnrc_pktbuf_release(pkt);
     }
     if (!has_nh_subs) {
@@ -166,7 +180,7 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
         gnrc_pktbuf_hold(pkt, 1);   /* don't remove from packet buffer in
                                      * next dispatch */
     }
-    if (gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6, nh, pkt) == 0) {
+    if (_dispatch_receive(GNRC_NETTYPE_IPV6, nh, pkt) == 0) {
         gnrc_pktbuf_release(pkt);
     }
 }
@@ -174,11 +188,14 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
 static void *_event_loop(void *args)
 {
     msg_t msg, reply, msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
-    gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
-                                                            thread_getpid());
+    gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_BATCH(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                              thread_getpid());
 
     (void)args;
     msg_init_queue(msg_q, GNRC_IPV6_MSG_QUEUE_SIZE);
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    gnrc_netapi_batch_init(&_rcv_batch);
+#endif
 
     /* initialize fragmentation data-structures */
 #ifdef MODULE_GNRC_IPV6_EXT_FRAG
@@ -192,6 +209,11 @@ static void *_event_loop(void *args)
 
     /* start event loop */
     while (1) {
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+        if (msg_avail() <= 0) {
+            gnrc_netapi_batch_flush(&_rcv_batch);
+        }
+#endif
         DEBUG("ipv6: waiting for incoming message.\n");
         msg_receive(&msg);
 
@@ -201,6 +223,17 @@ static void *_event_loop(void *args)
                 _receive(msg.content.ptr);
                 break;
 
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV_BATCH received\n");
+                for (unsigned i = 0; i < gnrc_netapi_batch_numof(msg.content.ptr);
+                     i++) {
+                    _receive(gnrc_netapi_batch_get(msg.content.ptr, i));
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+#endif
+
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
                 _send(msg.content.ptr, true);
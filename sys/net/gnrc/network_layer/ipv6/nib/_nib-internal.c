@@ -27,6 +27,7 @@
 #include "random.h"
 
 #include "_nib-internal.h"
+#include "_nib-offl_trie.h"
 #include "_nib-router.h"
 
 #define ENABLE_DEBUG    (0)
@@ -65,6 +66,7 @@ void _nib_init(void)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 #endif  /* TEST_SUITES */
+    _nib_offl_trie_init();
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
 }
@@ -515,6 +517,7 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        _nib_offl_trie_add(dst);
     }
     return dst;
 }
@@ -551,6 +554,7 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+        _nib_offl_trie_remove(dst);
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
 }
@@ -576,11 +580,14 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
 
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
-    _nib_offl_entry_t *res = NULL;
-    uint8_t best_match = 0;
-
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+    return _nib_offl_trie_get_match(dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+    _nib_offl_entry_t *res = NULL;
+    uint8_t best_len = 0;
+
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -593,14 +600,18 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
                   ipv6_addr_to_str(addr_str, &entry->next_hop->ipv6,
                                    sizeof(addr_str)),
                   _nib_onl_get_if(entry->next_hop), match);
-            if ((match > best_match) && (match >= entry->pfx_len)) {
-                DEBUG("nib: best match (%u bits)\n", match);
+            /* compare prefix lengths, not matching bits: the host bits of
+             * a shorter prefix are 0, so it may match more bits than a
+             * longer prefix */
+            if ((entry->pfx_len > best_len) && (match >= entry->pfx_len)) {
+                DEBUG("nib: best match (%u bits)\n", entry->pfx_len);
                 res = entry;
-                best_match = match;
+                best_len = entry->pfx_len;
             }
         }
     }
     return res;
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
 }
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
@@ -195,7 +195,15 @@ typedef struct {
 /**
  * @brief   Off-link NIB entry
  */
-typedef struct {
+typedef struct _nib_offl_entry {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE) || defined(DOXYGEN)
+    /**
+     * @brief   Next entry with the same prefix in the off-link trie
+     *
+     * @note    Only available with @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE.
+     */
+    struct _nib_offl_entry *trie_next;
+#endif
     _nib_onl_entry_t *next_hop; /**< next hop to destination */
     ipv6_addr_t pfx;            /**< prefix to the destination */
     /**
@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @author  agent <agent@local>
+ */
+
+#include <assert.h>
+#include <string.h>
+#include <kernel_defines.h>
+
+#include "net/ipv6/addr.h"
+
+#include "_nib-offl_trie.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+
+#define _NODES_NUMOF    (2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF)
+
+typedef struct _trie_node {
+    struct _trie_node *child[2];    /**< children by bit _trie_node_t::len */
+    _nib_offl_entry_t *entries;     /**< entries with exactly this prefix */
+    ipv6_addr_t pfx;                /**< prefix (bits behind len are 0) */
+    uint8_t len;                    /**< length of _trie_node_t::pfx in bits */
+} _trie_node_t;
+
+static _trie_node_t _nodes[_NODES_NUMOF];
+static _trie_node_t *_free_nodes;
+static _trie_node_t *_root;
+
+static inline unsigned _bit(const ipv6_addr_t *addr, unsigned pos)
+{
+    return (addr->u8[pos >> 3] >> (7 - (pos & 0x7))) & 0x1;
+}
+
+/* checks if the first len bits of a and b are equal */
+static bool _pfx_equal(const ipv6_addr_t *a, const ipv6_addr_t *b,
+                       unsigned len)
+{
+    unsigned bytes = len >> 3;
+    unsigned bits = len & 0x7;
+
+    if (memcmp(a, b, bytes) != 0) {
+        return false;
+    }
+    return (bits == 0) ||
+           (((a->u8[bytes] ^ b->u8[bytes]) & (0xff00 >> bits) & 0xff) == 0);
+}
+
+static _trie_node_t *_node_alloc(const ipv6_addr_t *pfx, unsigned len)
+{
+    _trie_node_t *node = _free_nodes;
+
+    /* at most 2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF - 1 nodes are in use */
+    assert(node != NULL);
+    _free_nodes = node->child[0];
+    memset(node, 0, sizeof(*node));
+    ipv6_addr_init_prefix(&node->pfx, pfx, len);
+    node->len = len;
+    return node;
+}
+
+static void _node_free(_trie_node_t *node)
+{
+    node->child[0] = _free_nodes;
+    _free_nodes = node;
+}
+
+void _nib_offl_trie_init(void)
+{
+    _root = NULL;
+    _free_nodes = NULL;
+    for (unsigned i = 0; i < _NODES_NUMOF; i++) {
+        _node_free(&_nodes[i]);
+    }
+}
+
+static void _entries_add(_trie_node_t *node, _nib_offl_entry_t *dst)
+{
+    _nib_offl_entry_t **ptr = &node->entries;
+
+    /* keep entries in table order so the first entry in the table wins on
+     * equal prefixes, like with the linear search */
+    while ((*ptr != NULL) && (*ptr < dst)) {
+        ptr = &(*ptr)->trie_next;
+    }
+    dst->trie_next = *ptr;
+    *ptr = dst;
+}
+
+void _nib_offl_trie_add(_nib_offl_entry_t *dst)
+{
+    _trie_node_t **ptr = &_root;
+    const ipv6_addr_t *pfx = &dst->pfx;
+    unsigned len = dst->pfx_len;
+
+    assert((dst->pfx_len > 0) && (dst->pfx_len <= IPV6_ADDR_BIT_LEN));
+    while (1) {
+        _trie_node_t *node = *ptr;
+        unsigned common;
+
+        if (node == NULL) {
+            node = _node_alloc(pfx, len);
+            _entries_add(node, dst);
+            *ptr = node;
+            return;
+        }
+        common = ipv6_addr_match_prefix(&node->pfx, pfx);
+        common = (common > node->len) ? node->len : common;
+        common = (common > len) ? len : common;
+        if (common == node->len) {
+            if (len == node->len) {
+                /* exact prefix already in trie */
+                _entries_add(node, dst);
+                return;
+            }
+            /* node's prefix is a prefix of pfx => descend */
+            ptr = &node->child[_bit(pfx, node->len)];
+        }
+        else if (common == len) {
+            /* pfx is a prefix of node's prefix => insert above node */
+            _trie_node_t *new = _node_alloc(pfx, len);
+
+            _entries_add(new, dst);
+            new->child[_bit(&node->pfx, len)] = node;
+            *ptr = new;
+            return;
+        }
+        else {
+            /* prefixes diverge => split at common bits */
+            _trie_node_t *branch = _node_alloc(pfx, common);
+            _trie_node_t *leaf = _node_alloc(pfx, len);
+
+            _entries_add(leaf, dst);
+            branch->child[_bit(pfx, common)] = leaf;
+            branch->child[_bit(&node->pfx, common)] = node;
+            *ptr = branch;
+            return;
+        }
+    }
+}
+
+/* removes node that does not hold entries anymore if it isn't needed for
+ * branching */
+static void _compress(_trie_node_t **ptr)
+{
+    _trie_node_t *node = *ptr;
+
+    assert(node->entries == NULL);
+    if ((node->child[0] != NULL) && (node->child[1] != NULL)) {
+        return;
+    }
+    *ptr = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+    _node_free(node);
+}
+
+void _nib_offl_trie_remove(_nib_offl_entry_t *dst)
+{
+    _trie_node_t **parent = NULL;
+    _trie_node_t **ptr = &_root;
+
+    while ((*ptr != NULL) && ((*ptr)->len < dst->pfx_len)) {
+        if (!_pfx_equal(&(*ptr)->pfx, &dst->pfx, (*ptr)->len)) {
+            return;
+        }
+        parent = ptr;
+        ptr = &(*ptr)->child[_bit(&dst->pfx, (*ptr)->len)];
+    }
+    if ((*ptr == NULL) || ((*ptr)->len != dst->pfx_len)) {
+        return;
+    }
+    for (_nib_offl_entry_t **entry = &(*ptr)->entries; *entry != NULL;
+         entry = &(*entry)->trie_next) {
+        if (*entry == dst) {
+            *entry = dst->trie_next;
+            dst->trie_next = NULL;
+            if ((*ptr)->entries == NULL) {
+                bool leaf = ((*ptr)->child[0] == NULL) &&
+                            ((*ptr)->child[1] == NULL);
+
+                _compress(ptr);
+                /* a branching parent without entries might have become
+                 * obsolete */
+                if (leaf && (parent != NULL) && ((*parent)->entries == NULL)) {
+                    _compress(parent);
+                }
+            }
+            return;
+        }
+    }
+}
+
+_nib_offl_entry_t *_nib_offl_trie_get_match(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+    const _trie_node_t *node = _root;
+
+    while ((node != NULL) && _pfx_equal(&node->pfx, dst, node->len)) {
+        for (_nib_offl_entry_t *entry = node->entries; entry != NULL;
+             entry = entry->trie_next) {
+            if (entry->mode != _EMPTY) {
+                DEBUG("nib: trie match /%u\n", node->len);
+                res = entry;
+                break;
+            }
+        }
+        if (node->len >= IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+        node = node->child[_bit(dst, node->len)];
+    }
+    return res;
+}
+
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+typedef int dont_be_pedantic;
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
+/** @} */
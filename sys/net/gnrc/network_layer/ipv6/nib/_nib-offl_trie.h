@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_ipv6_nib
+ * @{
+ *
+ * @file
+ * @brief   Definitions related to the prefix trie index of off-link entries
+ * @see     @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+ * @internal
+ *
+ * The trie is a path-compressed binary (Patricia) trie keyed on the prefix
+ * of an off-link entry. Every node either holds at least one off-link entry
+ * (all entries with the exact same prefix are chained via
+ * _nib_offl_entry_t::trie_next) or is a branching node with exactly two
+ * children. As such, at most `2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF - 1` nodes
+ * are required and node allocation can never fail.
+ */
+#ifndef PRIV_NIB_OFFL_TRIE_H
+#define PRIV_NIB_OFFL_TRIE_H
+
+#include <kernel_defines.h>
+
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE) || defined(DOXYGEN)
+/**
+ * @brief   Resets the trie
+ */
+void _nib_offl_trie_init(void);
+
+/**
+ * @brief   Adds an off-link entry to the trie
+ *
+ * @pre     `(dst != NULL) && (dst->pfx_len > 0)`
+ * @pre     @p dst is not already in the trie
+ *
+ * @param[in] dst   An off-link entry with _nib_offl_entry_t::pfx and
+ *                  _nib_offl_entry_t::pfx_len set.
+ */
+void _nib_offl_trie_add(_nib_offl_entry_t *dst);
+
+/**
+ * @brief   Removes an off-link entry from the trie
+ *
+ * @pre     `dst != NULL`
+ *
+ * @param[in] dst   An off-link entry. Nothing happens if it is not in the
+ *                  trie.
+ */
+void _nib_offl_trie_remove(_nib_offl_entry_t *dst);
+
+/**
+ * @brief   Gets the off-link entry with the longest prefix matching @p dst
+ *
+ * Entries with mode @ref _EMPTY are skipped. If there are multiple entries
+ * with the same prefix, the one stored first in the off-link table is
+ * returned.
+ *
+ * @pre     `dst != NULL`
+ *
+ * @param[in] dst   A destination address.
+ *
+ * @return  The best matching off-link entry for @p dst.
+ * @return  NULL, if no entry matches @p dst.
+ */
+_nib_offl_entry_t *_nib_offl_trie_get_match(const ipv6_addr_t *dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+#define _nib_offl_trie_init()           (void)0
+#define _nib_offl_trie_add(dst)         (void)dst
+#define _nib_offl_trie_remove(dst)      (void)dst
+/* _nib_offl_trie_get_match() doesn't make sense without the trie so don't
+ * even use it => throw error in case it is compiled in => don't define it here
+ * as NOP macro */
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIV_NIB_OFFL_TRIE_H */
+/** @} */
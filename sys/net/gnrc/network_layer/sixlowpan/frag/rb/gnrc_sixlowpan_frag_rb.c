@@ -56,6 +56,36 @@ static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
+#ifndef RBUF_BUCKETS
+/* number of hash buckets to look up reassembly buffer entries */
+#define RBUF_BUCKETS (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE)
+#endif
+
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE >= UINT8_MAX
+#error "CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE must be smaller than 255"
+#endif
+
+/* Index over the entries of rbuf that are in use: they are chained into hash
+ * buckets by (src, dst, tag) and into a list sorted by arrival time, so look-ups,
+ * eviction of the oldest entry and garbage collection do not need to scan the
+ * whole buffer. Entries are referred to by their position in rbuf + 1, 0 ends a
+ * list. */
+typedef struct {
+    uint8_t next;       /* next entry in the same bucket or the free list */
+    uint8_t older;      /* next older entry */
+    uint8_t newer;      /* next newer entry */
+    bool used;          /* entry is in the index */
+} _rbuf_link_t;
+
+static _rbuf_link_t _links[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+static uint8_t _buckets[RBUF_BUCKETS];
+static uint8_t _oldest;
+static uint8_t _newest;
+/* released entries */
+static uint8_t _free;
+/* entries from here on were never used */
+static uint8_t _fresh;
+
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
 static xtimer_t _gc_timer;
@@ -80,6 +110,10 @@ static int _rbuf_get(const void *src, size_t src_len,
 /* gets an entry only by link-layer information and tag */
 static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
                                                   uint16_t tag);
+/* gets an entry by its tuple from the index, size 0 matches any size */
+static gnrc_sixlowpan_frag_rb_t *_rbuf_find(const uint8_t *src, size_t src_len,
+                                            const uint8_t *dst, size_t dst_len,
+                                            uint16_t tag, size_t size);
 /* internal add to repeat add when fragments overlapped */
 static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                      size_t offset, unsigned page);
@@ -161,25 +195,163 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
                                                   uint16_t tag)
 {
     assert(netif_hdr != NULL);
-    const uint8_t *src = gnrc_netif_hdr_get_src_addr(netif_hdr);
-    const uint8_t *dst = gnrc_netif_hdr_get_dst_addr(netif_hdr);
-    const uint8_t src_len = netif_hdr->src_l2addr_len;
-    const uint8_t dst_len = netif_hdr->dst_l2addr_len;
+    return _rbuf_find(gnrc_netif_hdr_get_src_addr(netif_hdr),
+                      netif_hdr->src_l2addr_len,
+                      gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                      netif_hdr->dst_l2addr_len, tag, 0);
+}
+
+static inline gnrc_sixlowpan_frag_rb_t *_entry(uint8_t link)
+{
+    return &rbuf[link - 1];
+}
+
+static inline uint8_t _link(const gnrc_sixlowpan_frag_rb_t *entry)
+{
+    return (entry - &rbuf[0]) + 1;
+}
+
+static unsigned _bucket(const uint8_t *src, size_t src_len,
+                        const uint8_t *dst, size_t dst_len, uint16_t tag)
+{
+    uint32_t hash = tag;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash * 33) ^ src[i];
+    }
+    for (unsigned i = 0; i < dst_len; i++) {
+        hash = (hash * 33) ^ dst[i];
+    }
+    return hash % RBUF_BUCKETS;
+}
+
+static unsigned _entry_bucket(const gnrc_sixlowpan_frag_rb_t *entry)
+{
+    return _bucket(entry->super.src, entry->super.src_len,
+                   entry->super.dst, entry->super.dst_len, entry->super.tag);
+}
+
+static gnrc_sixlowpan_frag_rb_t *_rbuf_find(const uint8_t *src, size_t src_len,
+                                            const uint8_t *dst, size_t dst_len,
+                                            uint16_t tag, size_t size)
+{
+    uint8_t link = _buckets[_bucket(src, src_len, dst, dst_len, tag)];
 
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
+    while (link) {
+        gnrc_sixlowpan_frag_rb_t *e = _entry(link);
 
-        if ((e->pkt != NULL) && (e->super.tag == tag) &&
+        if ((e->super.tag == tag) &&
+            ((size == 0) || (e->super.datagram_size == size)) &&
             (e->super.src_len == src_len) &&
             (e->super.dst_len == dst_len) &&
             (memcmp(e->super.src, src, src_len) == 0) &&
             (memcmp(e->super.dst, dst, dst_len) == 0)) {
             return e;
         }
+        link = _links[link - 1].next;
     }
     return NULL;
 }
 
+/* sorts entry into the age list by its arrival time */
+static void _age_insert(uint8_t link)
+{
+    uint32_t arrival = _entry(link)->super.arrival;
+    uint8_t older = _newest;
+    uint8_t newer = 0;
+
+    /* entries are usually inserted with the current time, so this only
+     * iterates for entries that are scheduled for deletion */
+    while (older &&
+           ((int32_t)(_entry(older)->super.arrival - arrival) > 0)) {
+        newer = older;
+        older = _links[older - 1].older;
+    }
+    _links[link - 1].older = older;
+    _links[link - 1].newer = newer;
+    if (older) {
+        _links[older - 1].newer = link;
+    }
+    else {
+        _oldest = link;
+    }
+    if (newer) {
+        _links[newer - 1].older = link;
+    }
+    else {
+        _newest = link;
+    }
+}
+
+static void _age_unlink(uint8_t link)
+{
+    uint8_t older = _links[link - 1].older;
+    uint8_t newer = _links[link - 1].newer;
+
+    if (older) {
+        _links[older - 1].newer = newer;
+    }
+    else {
+        _oldest = newer;
+    }
+    if (newer) {
+        _links[newer - 1].older = older;
+    }
+    else {
+        _newest = older;
+    }
+}
+
+static bool _has_free(void)
+{
+    return (_free != 0) || (_fresh < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE);
+}
+
+static gnrc_sixlowpan_frag_rb_t *_pop_free(void)
+{
+    if (_free) {
+        uint8_t link = _free;
+
+        _free = _links[link - 1].next;
+        return _entry(link);
+    }
+    assert(_fresh < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE);
+    return &rbuf[_fresh++];
+}
+
+/* adds an entry with its tuple and arrival time set to the index */
+static void _index_add(gnrc_sixlowpan_frag_rb_t *entry)
+{
+    uint8_t link = _link(entry);
+    unsigned bucket = _entry_bucket(entry);
+
+    _links[link - 1].next = _buckets[bucket];
+    _buckets[bucket] = link;
+    _links[link - 1].used = true;
+    _age_insert(link);
+}
+
+/* removes an entry from the index and puts it into the free list */
+static void _index_rm(gnrc_sixlowpan_frag_rb_t *entry)
+{
+    uint8_t link = _link(entry);
+    uint8_t *ptr;
+
+    if (!_links[link - 1].used) {
+        return;
+    }
+    ptr = &_buckets[_entry_bucket(entry)];
+    while (*ptr != link) {
+        assert(*ptr != 0);
+        ptr = &_links[*ptr - 1].next;
+    }
+    *ptr = _links[link - 1].next;
+    _age_unlink(link);
+    _links[link - 1].used = false;
+    _links[link - 1].next = _free;
+    _free = link;
+}
+
 #ifndef NDEBUG
 static bool _valid_offset(gnrc_pktsnip_t *pkt, size_t offset)
 {
@@ -379,26 +551,25 @@ static void _gc_pkt(gnrc_sixlowpan_frag_rb_t *rbuf)
 void gnrc_sixlowpan_frag_rb_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
-    unsigned int i;
-
-    for (i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* since pkt occupies pktbuf, aggressivly collect garbage */
-        if (!gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i]) &&
-              ((now_usec - rbuf[i].super.arrival) >
-               CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)) {
-            DEBUG("6lo rfrag: entry (%s, ",
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) timed out\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
 
-            _gc_pkt(&rbuf[i]);
-            gnrc_sixlowpan_frag_rb_remove(&(rbuf[i]));
-        }
+    /* since pkt occupies pktbuf, aggressivly collect garbage */
+    while (_oldest &&
+           ((now_usec - _entry(_oldest)->super.arrival) >
+            CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)) {
+        gnrc_sixlowpan_frag_rb_t *entry = _entry(_oldest);
+
+        DEBUG("6lo rfrag: entry (%s, ",
+              gnrc_netif_addr_to_str(entry->super.src,
+                                     entry->super.src_len,
+                                     l2addr_str));
+        DEBUG("%s, %u, %u) timed out\n",
+              gnrc_netif_addr_to_str(entry->super.dst,
+                                     entry->super.dst_len,
+                                     l2addr_str),
+              (unsigned)entry->super.datagram_size, entry->super.tag);
+
+        _gc_pkt(entry);
+        gnrc_sixlowpan_frag_rb_remove(entry);
     }
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
     gnrc_sixlowpan_frag_vrb_gc();
@@ -416,56 +587,41 @@ static int _rbuf_get(const void *src, size_t src_len,
                      size_t size, uint16_t tag,
                      unsigned page)
 {
-    gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
+    gnrc_sixlowpan_frag_rb_t *res;
     uint32_t now_usec = xtimer_now_usec();
 
-    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.datagram_size == size) &&
-            (rbuf[i].super.tag == tag) && (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+    /* check first if entry already available */
+    res = _rbuf_find(src, src_len, dst, dst_len, tag, size);
+    if (res != NULL) {
+        DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
+              gnrc_netif_addr_to_str(res->super.src,
+                                     res->super.src_len,
+                                     l2addr_str));
+        DEBUG("%s, %u, %u) found\n",
+              gnrc_netif_addr_to_str(res->super.dst,
+                                     res->super.dst_len,
+                                     l2addr_str),
+              (unsigned)res->super.datagram_size, res->super.tag);
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
-                /* ensure that only empty reassembly buffer entries and entries
-                 * scheduled for deletion have `current_size == 0` */
-                DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
-                return -1;
-            }
-#endif
-            rbuf[i].super.arrival = now_usec;
-            _set_rbuf_timeout();
-            return i;
-        }
-
-        /* if there is a free spot: remember it */
-        if ((res == NULL) && gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
-            res = &(rbuf[i]);
-        }
-
-        /* remember oldest slot */
-        /* note that xtimer_now will overflow in ~1.2 hours */
-        if ((oldest == NULL) ||
-            (oldest->super.arrival - rbuf[i].super.arrival < UINT32_MAX / 2)) {
-            oldest = &(rbuf[i]);
+        if (res->super.current_size == 0) {
+            /* ensure that only empty reassembly buffer entries and entries
+             * scheduled for deletion have `current_size == 0` */
+            DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
+            return -1;
         }
+#endif
+        res->super.arrival = now_usec;
+        _age_unlink(_link(res));
+        _age_insert(_link(res));
+        _set_rbuf_timeout();
+        return res - &(rbuf[0]);
     }
 
-    /* entry not in buffer and no empty spot found */
-    if (res == NULL) {
-        assert(oldest != NULL);
-        /* if oldest is not empty, res must not be NULL (because otherwise
-         * oldest could have been picked as res) */
+    /* entry not in buffer and no empty spot available */
+    if (!_has_free()) {
+        gnrc_sixlowpan_frag_rb_t *oldest = _entry(_oldest);
+
+        assert(_oldest != 0);
         assert(!gnrc_sixlowpan_frag_rb_entry_empty(oldest));
         if (GNRC_SIXLOWPAN_FRAG_RBUF_AGGRESSIVE_OVERRIDE ||
             ((now_usec - oldest->super.arrival) >
@@ -473,7 +629,6 @@ static int _rbuf_get(const void *src, size_t src_len,
             DEBUG("6lo rfrag: reassembly buffer full, remove oldest entry\n");
             gnrc_pktbuf_release(oldest->pkt);
             gnrc_sixlowpan_frag_rb_remove(oldest);
-            res = oldest;
 #if GNRC_SIXLOWPAN_FRAG_RBUF_AGGRESSIVE_OVERRIDE && \
     defined(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
             gnrc_sixlowpan_frag_stats_get()->rbuf_full++;
@@ -500,11 +655,13 @@ static int _rbuf_get(const void *src, size_t src_len,
         default:
             reass_type = GNRC_NETTYPE_UNDEF;
     }
-    res->pkt = gnrc_pktbuf_add(NULL, NULL, size, reass_type);
-    if (res->pkt == NULL) {
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, size, reass_type);
+    if (pkt == NULL) {
         DEBUG("6lo rfrag: can not allocate reassembly buffer space.\n");
         return -1;
     }
+    res = _pop_free();
+    res->pkt = pkt;
 
     if (res->pkt->data) {
         /* clean first few bytes for later look-ups */
@@ -518,6 +675,7 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->super.dst_len = dst_len;
     res->super.tag = tag;
     res->super.current_size = 0;
+    _index_add(res);
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
@@ -544,6 +702,12 @@ void gnrc_sixlowpan_frag_rb_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+    memset(_links, 0, sizeof(_links));
+    memset(_buckets, 0, sizeof(_buckets));
+    _oldest = 0;
+    _newest = 0;
+    _free = 0;
+    _fresh = 0;
 }
 
 const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
@@ -565,6 +729,14 @@ void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry)
     entry->datagram_size = 0;
 }
 
+void gnrc_sixlowpan_frag_rb_remove(gnrc_sixlowpan_frag_rb_t *rbuf)
+{
+    assert(rbuf != NULL);
+    _index_rm(rbuf);
+    gnrc_sixlowpan_frag_rb_base_rm(&rbuf->super);
+    rbuf->pkt = NULL;
+}
+
 static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
 {
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0U
@@ -576,6 +748,8 @@ static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
         rbuf->super.arrival = xtimer_now_usec() -
                               (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US -
                                CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER);
+        _age_unlink(_link(rbuf));
+        _age_insert(_link(rbuf));
         /* reset current size to prevent late duplicates to trigger another
          * dispatch */
         rbuf->super.current_size = 0;
@@ -30,7 +30,33 @@
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+#ifndef VRB_BUCKETS
+/* number of hash buckets to look up VRB entries */
+#define VRB_BUCKETS (CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE)
+#endif
+
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE >= UINT8_MAX
+#error "CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE must be smaller than 255"
+#endif
+
+/* Index over the entries of _vrb that are in use, chained into hash buckets by
+ * (src, tag) and into a list sorted by arrival time. Entries are referred to by
+ * their position in _vrb + 1, 0 ends a list. */
+typedef struct {
+    uint8_t next;       /* next entry in the same bucket or the free list */
+    uint8_t older;      /* next older entry */
+    uint8_t newer;      /* next newer entry */
+} _vrb_link_t;
+
 static gnrc_sixlowpan_frag_vrb_t _vrb[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+static _vrb_link_t _links[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+static uint8_t _buckets[VRB_BUCKETS];
+static uint8_t _oldest;
+static uint8_t _newest;
+/* released entries */
+static uint8_t _free;
+/* entries from here on were never used */
+static uint8_t _fresh;
 #ifdef MODULE_GNRC_IPV6_NIB
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 #else   /* MODULE_GNRC_IPV6_NIB */
@@ -46,6 +72,123 @@ static inline bool _equal_index(const gnrc_sixlowpan_frag_vrb_t *vrbe,
             (memcmp(vrbe->super.src, src, src_len) == 0));
 }
 
+static inline gnrc_sixlowpan_frag_vrb_t *_entry(uint8_t link)
+{
+    return &_vrb[link - 1];
+}
+
+static inline uint8_t _link(const gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    return (vrbe - &_vrb[0]) + 1;
+}
+
+static unsigned _bucket(const uint8_t *src, size_t src_len, unsigned tag)
+{
+    uint32_t hash = tag;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash * 33) ^ src[i];
+    }
+    return hash % VRB_BUCKETS;
+}
+
+static gnrc_sixlowpan_frag_vrb_t *_find(const uint8_t *src, size_t src_len,
+                                        unsigned tag)
+{
+    uint8_t link = _buckets[_bucket(src, src_len, tag)];
+
+    while (link && !_equal_index(_entry(link), src, src_len, tag)) {
+        link = _links[link - 1].next;
+    }
+    return (link) ? _entry(link) : NULL;
+}
+
+/* sorts entry into the age list by its arrival time */
+static void _age_insert(uint8_t link)
+{
+    uint32_t arrival = _entry(link)->super.arrival;
+    uint8_t older = _newest;
+    uint8_t newer = 0;
+
+    /* the arrival time is taken over from the reassembly buffer, so entries
+     * are mostly added in order */
+    while (older &&
+           ((int32_t)(_entry(older)->super.arrival - arrival) > 0)) {
+        newer = older;
+        older = _links[older - 1].older;
+    }
+    _links[link - 1].older = older;
+    _links[link - 1].newer = newer;
+    if (older) {
+        _links[older - 1].newer = link;
+    }
+    else {
+        _oldest = link;
+    }
+    if (newer) {
+        _links[newer - 1].older = link;
+    }
+    else {
+        _newest = link;
+    }
+}
+
+static gnrc_sixlowpan_frag_vrb_t *_pop_free(void)
+{
+    if (_free) {
+        uint8_t link = _free;
+
+        _free = _links[link - 1].next;
+        return _entry(link);
+    }
+    if (_fresh < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE) {
+        return &_vrb[_fresh++];
+    }
+    return NULL;
+}
+
+/* adds an entry with its source, tag, and arrival time set to the index */
+static void _index_add(gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    uint8_t link = _link(vrbe);
+    unsigned bucket = _bucket(vrbe->super.src, vrbe->super.src_len,
+                              vrbe->super.tag);
+
+    _links[link - 1].next = _buckets[bucket];
+    _buckets[bucket] = link;
+    _age_insert(link);
+}
+
+/* removes an entry from the index and puts it into the free list */
+static void _index_rm(gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    uint8_t link = _link(vrbe);
+    uint8_t older = _links[link - 1].older;
+    uint8_t newer = _links[link - 1].newer;
+    uint8_t *ptr = &_buckets[_bucket(vrbe->super.src, vrbe->super.src_len,
+                                     vrbe->super.tag)];
+
+    while (*ptr != link) {
+        assert(*ptr != 0);
+        ptr = &_links[*ptr - 1].next;
+    }
+    *ptr = _links[link - 1].next;
+    if (older) {
+        _links[older - 1].newer = newer;
+    }
+    else {
+        _oldest = newer;
+    }
+    if (newer) {
+        _links[newer - 1].older = older;
+    }
+    else {
+        _newest = older;
+    }
+    _links[link - 1].next = _free;
+    _free = link;
+}
+
 
 gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
         const gnrc_sixlowpan_frag_rb_base_t *base,
@@ -57,59 +200,55 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
     assert(out_netif != NULL);
     assert(out_dst != NULL);
     assert(out_dst_len > 0);
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        gnrc_sixlowpan_frag_vrb_t *ptr = &_vrb[i];
-
-        if (gnrc_sixlowpan_frag_vrb_entry_empty(ptr) ||
-            _equal_index(ptr, base->src, base->src_len, base->tag)) {
-            vrbe = ptr;
-            if (gnrc_sixlowpan_frag_vrb_entry_empty(vrbe)) {
-                vrbe->super = *base;
-                vrbe->out_netif = out_netif;
-                memcpy(vrbe->super.dst, out_dst, out_dst_len);
-                vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
-                vrbe->super.dst_len = out_dst_len;
-                DEBUG("6lo vrb: creating entry (%s, ",
-                      gnrc_netif_addr_to_str(vrbe->super.src,
-                                             vrbe->super.src_len,
-                                             addr_str));
-                DEBUG("%s, %u, %u) => ",
-                      gnrc_netif_addr_to_str(vrbe->super.dst,
-                                             vrbe->super.dst_len,
-                                             addr_str),
-                      (unsigned)vrbe->super.datagram_size, vrbe->super.tag);
-                DEBUG("(%s, %u)\n",
-                      gnrc_netif_addr_to_str(vrbe->super.dst,
-                                             vrbe->super.dst_len,
-                                             addr_str), vrbe->out_tag);
-            }
-            /* _equal_index() => append intervals of `base`, so they don't get
-             * lost. We use append, so we don't need to change base! */
-            else if (base->ints != NULL) {
-                gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
-
-                if (tmp != base->ints) {
-                    /* base->ints is not already vrbe->super.ints */
-                    if (tmp != NULL) {
-                        /* iterate before appending and check if `base->ints` is
-                         * not already part of list */
-                        while (tmp->next != NULL) {
-                            if (tmp == base->ints) {
-                                tmp = NULL;
-                                break;
-                            }
-                            tmp = tmp->next;
-                        }
-                        if (tmp != NULL) {
-                            tmp->next = base->ints;
-                        }
-                    }
-                    else {
-                        vrbe->super.ints = base->ints;
+    vrbe = _find(base->src, base->src_len, base->tag);
+    if (vrbe == NULL) {
+        vrbe = _pop_free();
+        if (vrbe != NULL) {
+            vrbe->super = *base;
+            vrbe->out_netif = out_netif;
+            memcpy(vrbe->super.dst, out_dst, out_dst_len);
+            vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
+            vrbe->super.dst_len = out_dst_len;
+            _index_add(vrbe);
+            DEBUG("6lo vrb: creating entry (%s, ",
+                  gnrc_netif_addr_to_str(vrbe->super.src,
+                                         vrbe->super.src_len,
+                                         addr_str));
+            DEBUG("%s, %u, %u) => ",
+                  gnrc_netif_addr_to_str(vrbe->super.dst,
+                                         vrbe->super.dst_len,
+                                         addr_str),
+                  (unsigned)vrbe->super.datagram_size, vrbe->super.tag);
+            DEBUG("(%s, %u)\n",
+                  gnrc_netif_addr_to_str(vrbe->super.dst,
+                                         vrbe->super.dst_len,
+                                         addr_str), vrbe->out_tag);
+        }
+    }
+    /* _equal_index() => append intervals of `base`, so they don't get
+     * lost. We use append, so we don't need to change base! */
+    else if (base->ints != NULL) {
+        gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
+
+        if (tmp != base->ints) {
+            /* base->ints is not already vrbe->super.ints */
+            if (tmp != NULL) {
+                /* iterate before appending and check if `base->ints` is
+                 * not already part of list */
+                while (tmp->next != NULL) {
+                    if (tmp == base->ints) {
+                        tmp = NULL;
+                        break;
                     }
+                    tmp = tmp->next;
+                }
+                if (tmp != NULL) {
+                    tmp->next = base->ints;
                 }
             }
-            break;
+            else {
+                vrbe->super.ints = base->ints;
+            }
         }
     }
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
@@ -169,39 +308,50 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(
 {
     DEBUG("6lo vrb: trying to get entry for (%s, %u)\n",
           gnrc_netif_addr_to_str(src, src_len, addr_str), src_tag);
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i];
+    gnrc_sixlowpan_frag_vrb_t *vrbe = _find(src, src_len, src_tag);
 
-        if (_equal_index(vrbe, src, src_len, src_tag)) {
-            DEBUG("6lo vrb: got VRB to (%s, %u)\n",
-                  gnrc_netif_addr_to_str(vrbe->super.dst,
-                                         vrbe->super.dst_len,
-                                         addr_str), vrbe->out_tag);
-            return vrbe;
-        }
+    if (vrbe != NULL) {
+        DEBUG("6lo vrb: got VRB to (%s, %u)\n",
+              gnrc_netif_addr_to_str(vrbe->super.dst,
+                                     vrbe->super.dst_len,
+                                     addr_str), vrbe->out_tag);
+        return vrbe;
     }
     DEBUG("6lo vrb: no entry found\n");
     return NULL;
 }
 
+void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrb)
+{
+    if (gnrc_sixlowpan_frag_vrb_entry_empty(vrb)) {
+        return;
+    }
+    _index_rm(vrb);
+    if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB)) {
+        gnrc_sixlowpan_frag_rb_base_rm(&vrb->super);
+    }
+    vrb->super.src_len = 0;
+}
+
 void gnrc_sixlowpan_frag_vrb_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
 
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        if (!gnrc_sixlowpan_frag_vrb_entry_empty(&_vrb[i]) &&
-            (now_usec - _vrb[i].super.arrival) > CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US) {
-            DEBUG("6lo vrb: entry (%s, ",
-                  gnrc_netif_addr_to_str(_vrb[i].super.src,
-                                         _vrb[i].super.src_len,
-                                         addr_str));
-            DEBUG("%s, %u, %u) timed out\n",
-                  gnrc_netif_addr_to_str(_vrb[i].super.dst,
-                                         _vrb[i].super.dst_len,
-                                         addr_str),
-                  (unsigned)_vrb[i].super.datagram_size, _vrb[i].super.tag);
-            gnrc_sixlowpan_frag_vrb_rm(&_vrb[i]);
-        }
+    while (_oldest &&
+           ((now_usec - _entry(_oldest)->super.arrival) >
+            CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US)) {
+        gnrc_sixlowpan_frag_vrb_t *vrbe = _entry(_oldest);
+
+        DEBUG("6lo vrb: entry (%s, ",
+              gnrc_netif_addr_to_str(vrbe->super.src,
+                                     vrbe->super.src_len,
+                                     addr_str));
+        DEBUG("%s, %u, %u) timed out\n",
+              gnrc_netif_addr_to_str(vrbe->super.dst,
+                                     vrbe->super.dst_len,
+                                     addr_str),
+              (unsigned)vrbe->super.datagram_size, vrbe->super.tag);
+        gnrc_sixlowpan_frag_vrb_rm(vrbe);
     }
 }
 
@@ -209,6 +359,12 @@ void gnrc_sixlowpan_frag_vrb_gc(void)
 void gnrc_sixlowpan_frag_vrb_reset(void)
 {
     memset(_vrb, 0, sizeof(_vrb));
+    memset(_links, 0, sizeof(_links));
+    memset(_buckets, 0, sizeof(_buckets));
+    _oldest = 0;
+    _newest = 0;
+    _free = 0;
+    _fresh = 0;
 }
 #endif
 
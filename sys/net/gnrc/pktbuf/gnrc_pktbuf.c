@@ -14,6 +14,9 @@
  */
 
 #include "net/gnrc/pktbuf.h"
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+#include "net/inet_csum.h"
+#endif
 
 gnrc_pktsnip_t *gnrc_pktbuf_remove_snip(gnrc_pktsnip_t *pkt,
                                         gnrc_pktsnip_t *snip)
@@ -101,4 +104,28 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt)
     return res;
 }
 
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+gnrc_pktsnip_t *gnrc_pktbuf_add_csum(gnrc_pktsnip_t *next, const void *data,
+                                     size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if ((size == 0) || (size > UINT16_MAX)) {
+        /* leave checksum unknown */
+        return gnrc_pktbuf_add(next, data, size, type);
+    }
+    pkt = gnrc_pktbuf_add(next, NULL, size, type);
+    if (pkt == NULL) {
+        return NULL;
+    }
+    pkt->csum = inet_csum_copy(0, pkt->data, data, size);
+    if (pkt->csum == 0) {
+        /* 0 marks the checksum as unknown, 0xffff is equivalent in one's
+         * complement */
+        pkt->csum = 0xffff;
+    }
+    return pkt;
+}
+#endif
+
 /** @} */
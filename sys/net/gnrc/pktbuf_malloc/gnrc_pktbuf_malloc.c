@@ -87,6 +87,9 @@ static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
 #ifdef MODULE_GNRC_NETERR
     pkt->err_sub = KERNEL_PID_UNDEF;
 #endif
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+    pkt->csum = 0;
+#endif
 }
 
 void gnrc_pktbuf_init(void)
@@ -153,6 +156,9 @@ static gnrc_pktsnip_t *_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t ty
     }
     pkt->data = payload;
     pkt->size -= size;
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+    pkt->csum = 0;
+#endif
     _set_pktsnip(header, pkt->next, header_data, size, type);
     pkt->next = header;
     return header;
@@ -193,6 +199,9 @@ static int _realloc_data(gnrc_pktsnip_t *pkt, size_t size)
         pkt->data = data;
     }
     pkt->size = size;
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+    pkt->csum = 0;
+#endif
     return 0;
 }
 
@@ -267,6 +276,15 @@ void gnrc_pktbuf_stats(void)
 {
     LOG_INFO("pktbuf: no stat output for gnrc_pktbuf_malloc, use tools like valgrind\n");
 }
+
+size_t gnrc_pktbuf_max_used(void)
+{
+    return 0;
+}
+
+void gnrc_pktbuf_max_used_reset(void)
+{
+}
 #endif
 
 #ifdef TEST_SUITES
@@ -0,0 +1,783 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Packet buffer with segregated size classes
+ *
+ * Packet snip descriptors and payloads of common sizes are allocated in O(1)
+ * from slabs of equally sized slots. Each slot has a reference counter, so
+ * @ref gnrc_pktbuf_mark() can split a slot without copying. Payloads that do
+ * not fit any class (or if all fitting slabs are exhausted) are allocated
+ * first-fit from a fallback arena of size @ref CONFIG_GNRC_PKTBUF_SIZE, just
+ * like with `gnrc_pktbuf_static`.
+ *
+ * @author  agent <agent@local>
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/types.h>
+
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "od.h"
+#include "utlist.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#define _ALIGNMENT_MASK    (sizeof(_unused_t) - 1)
+#define _SLOT_SIZE(size)   (((size) + _ALIGNMENT_MASK) & ~(_ALIGNMENT_MASK))
+
+#define _SNIP_SLOT_SIZE    _SLOT_SIZE(sizeof(gnrc_pktsnip_t))
+#define _SMALL_SLOT_SIZE   _SLOT_SIZE(CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE)
+#define _MEDIUM_SLOT_SIZE  _SLOT_SIZE(CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE)
+
+/**
+ * @brief   Index of the slab for packet snip descriptors
+ */
+#define _SLAB_SNIP         (0U)
+
+/**
+ * @brief   Index of the first payload slab
+ *
+ * Payload slabs are sorted by their slot size
+ */
+#define _SLAB_DATA         (1U)
+
+typedef struct _unused {
+    struct _unused *next;
+    unsigned int size;
+} _unused_t;
+
+static_assert(sizeof(_unused_t) == GNRC_PKTBUF_MARK_ALIGN,
+              "GNRC_PKTBUF_MARK_ALIGN must match the chunk alignment");
+
+typedef struct _slot {
+    struct _slot *next;
+} _slot_t;
+
+typedef struct {
+    uint8_t *buf;           /**< first slot */
+    uint8_t *refs;          /**< references per slot, 0 if slot is free */
+    _slot_t *free;          /**< free slots */
+    uint16_t size;          /**< size of a slot in bytes */
+    uint16_t numof;         /**< number of slots */
+    uint16_t used;          /**< number of slots in use */
+#ifdef DEVELHELP
+    uint16_t max_used;      /**< maximum number of slots in use */
+    uint16_t fallbacks;     /**< allocations that had to use the next class */
+#endif
+} _slab_t;
+
+static mutex_t _mutex = MUTEX_INIT;
+/* The static buffers need to be aligned to word size, so that their start
+ * address can be casted to `_unused_t *` / `_slot_t *` safely. Just
+ * allocating an array of (word sized) uintptr_t is a trivial way to do this */
+static uintptr_t _pktbuf_buf[CONFIG_GNRC_PKTBUF_SIZE / sizeof(uintptr_t)];
+static uintptr_t _snip_buf[(_SNIP_SLOT_SIZE * CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF) /
+                          sizeof(uintptr_t)];
+static uintptr_t _small_buf[(_SMALL_SLOT_SIZE * CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF) /
+                           sizeof(uintptr_t)];
+static uintptr_t _medium_buf[(_MEDIUM_SLOT_SIZE * CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF) /
+                            sizeof(uintptr_t)];
+static uint8_t _snip_refs[CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF];
+static uint8_t _small_refs[CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF];
+static uint8_t _medium_refs[CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF];
+static uint8_t *_pktbuf = (uint8_t *)_pktbuf_buf;
+static _unused_t *_first_unused;
+
+static _slab_t _slabs[] = {
+    {
+        .buf = (uint8_t *)_snip_buf,
+        .refs = _snip_refs,
+        .size = _SNIP_SLOT_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF,
+    },
+    {
+        .buf = (uint8_t *)_small_buf,
+        .refs = _small_refs,
+        .size = _SMALL_SLOT_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF,
+    },
+    {
+        .buf = (uint8_t *)_medium_buf,
+        .refs = _medium_refs,
+        .size = _MEDIUM_SLOT_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF,
+    },
+};
+
+#ifdef DEVELHELP
+/* maximum number of bytes allocated */
+static uint16_t max_byte_count = 0;
+#endif
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+static void *_pktbuf_alloc(unsigned first, size_t size);
+static void _pktbuf_free(void *data, size_t size);
+static void *_arena_alloc(size_t size);
+static void _arena_free(void *data, size_t size);
+
+static inline bool _arena_contains(void *ptr)
+{
+    return (unsigned)((uint8_t *)ptr - _pktbuf) < CONFIG_GNRC_PKTBUF_SIZE;
+}
+
+static inline bool _slab_contains(const _slab_t *slab, void *ptr)
+{
+    return (size_t)((uint8_t *)ptr - slab->buf) <
+           ((size_t)slab->size * slab->numof);
+}
+
+static _slab_t *_get_slab(void *ptr)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        if (_slab_contains(&_slabs[i], ptr)) {
+            return &_slabs[i];
+        }
+    }
+    return NULL;
+}
+
+static inline unsigned _slot_idx(const _slab_t *slab, void *ptr)
+{
+    return ((uint8_t *)ptr - slab->buf) / slab->size;
+}
+
+static inline bool _pktbuf_contains(void *ptr)
+{
+    return _arena_contains(ptr) || (_get_slab(ptr) != NULL);
+}
+
+/* fits size to byte alignment */
+static inline size_t _align(size_t size)
+{
+    return (size + _ALIGNMENT_MASK) & ~(_ALIGNMENT_MASK);
+}
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+    pkt->csum = 0;
+#endif
+}
+
+static void _slab_init(_slab_t *slab)
+{
+    slab->free = NULL;
+    slab->used = 0;
+#ifdef DEVELHELP
+    slab->max_used = 0;
+    slab->fallbacks = 0;
+#endif
+    memset(slab->refs, 0, slab->numof);
+    /* push backwards so slots are handed out in ascending order */
+    for (unsigned i = slab->numof; i > 0; i--) {
+        /* alignment is ensured by _SLOT_SIZE(). We cast to uintptr_t as
+         * intermediate step to silence -Wcast-align */
+        _slot_t *slot = (_slot_t *)(uintptr_t)&slab->buf[(i - 1) * slab->size];
+
+        slot->next = slab->free;
+        slab->free = slot;
+    }
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&_mutex);
+    _first_unused = (_unused_t *)_pktbuf_buf;
+    _first_unused->next = NULL;
+    _first_unused->size = sizeof(_pktbuf_buf);
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        _slab_init(&_slabs[i]);
+    }
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > CONFIG_GNRC_PKTBUF_SIZE) {
+        DEBUG("pktbuf: size (%u) > CONFIG_GNRC_PKTBUF_SIZE (%u)\n",
+              (unsigned)size, CONFIG_GNRC_PKTBUF_SIZE);
+        return NULL;
+    }
+    mutex_lock(&_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+    /* size required for chunk */
+    size_t required_new_size = _align(size);
+    void *new_data_marked;
+    _slab_t *slab;
+
+    mutex_lock(&_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
+              "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
+              (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _pktbuf_alloc(_SLAB_SNIP, sizeof(gnrc_pktsnip_t));
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    slab = _get_slab(pkt->data);
+    if ((pkt->size != size) && (slab != NULL)) {
+        /* both snips reference the same slot now */
+        uint8_t *ref = &slab->refs[_slot_idx(slab, pkt->data)];
+
+        assert((*ref > 0) && (*ref < UINT8_MAX));
+        (*ref)++;
+        new_data_marked = pkt->data;
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    /* marked data would not fit _unused_t marker => move data around to allow
+     * for proper free */
+    else if ((pkt->size != size) && (size < required_new_size)) {
+        void *new_data_rest;
+        new_data_marked = _pktbuf_alloc(_SLAB_DATA, size);
+        if (new_data_marked == NULL) {
+            DEBUG("pktbuf: could not reallocate marked section.\n");
+            _pktbuf_free(marked_snip, sizeof(gnrc_pktsnip_t));
+            mutex_unlock(&_mutex);
+            return NULL;
+        }
+        new_data_rest = _pktbuf_alloc(_SLAB_DATA, pkt->size - size);
+        if (new_data_rest == NULL) {
+            DEBUG("pktbuf: could not reallocate remaining section.\n");
+            _pktbuf_free(marked_snip, sizeof(gnrc_pktsnip_t));
+            _pktbuf_free(new_data_marked, size);
+            mutex_unlock(&_mutex);
+            return NULL;
+        }
+        memcpy(new_data_marked, pkt->data, size);
+        memcpy(new_data_rest, ((uint8_t *)pkt->data) + size, pkt->size - size);
+        _pktbuf_free(pkt->data, pkt->size);
+        marked_snip->data = new_data_marked;
+        pkt->data = new_data_rest;
+    }
+    else {
+        new_data_marked = pkt->data;
+        /* if (pkt->size - size) != 0 take remainder of data, otherwise set NULL */
+        pkt->data = (pkt->size != size) ? (((uint8_t *)pkt->data) + size) :
+                                          NULL;
+    }
+    pkt->size -= size;
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+    pkt->csum = 0;
+#endif
+    _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
+    pkt->next = marked_snip;
+    mutex_unlock(&_mutex);
+    return marked_snip;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    size_t aligned_size = _align(size);
+    _slab_t *slab;
+
+    mutex_lock(&_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && _pktbuf_contains(pkt->data)));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&_mutex);
+        return 0;
+    }
+    slab = (pkt->data != NULL) ? _get_slab(pkt->data) : NULL;
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        _pktbuf_free(pkt->data, pkt->size);
+        pkt->data = NULL;
+    }
+    /* if new size is bigger than old size */
+    else if (size > pkt->size) {
+        unsigned offset = (slab != NULL) ?
+                          ((uint8_t *)pkt->data - slab->buf) % slab->size : 0;
+
+        /* new size does not fit or slot is shared */
+        if ((slab == NULL) || ((offset + size) > slab->size) ||
+            (slab->refs[_slot_idx(slab, pkt->data)] > 1)) {
+            void *new_data = _pktbuf_alloc(_SLAB_DATA, size);
+            if (new_data == NULL) {
+                DEBUG("pktbuf: error allocating new data section\n");
+                mutex_unlock(&_mutex);
+                return ENOMEM;
+            }
+            if (pkt->data != NULL) {            /* if old data exist */
+                memcpy(new_data, pkt->data, (pkt->size < size) ? pkt->size : size);
+            }
+            _pktbuf_free(pkt->data, pkt->size);
+            pkt->data = new_data;
+        }
+    }
+    /* slots are only released as a whole */
+    else if ((slab == NULL) && (_align(pkt->size) > aligned_size)) {
+        _pktbuf_free(((uint8_t *)pkt->data) + aligned_size,
+                     pkt->size - aligned_size);
+    }
+    pkt->size = size;
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+    pkt->csum = 0;
+#endif
+    mutex_unlock(&_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&_mutex);
+    while (pkt) {
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&_mutex);
+}
+
+static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    while (pkt) {
+        gnrc_pktsnip_t *tmp;
+        assert(_pktbuf_contains(pkt));
+        assert(pkt->users > 0);
+        tmp = pkt->next;
+        if (pkt->users == 1) {
+            pkt->users = 0; /* not necessary but to be on the safe side */
+            _pktbuf_free(pkt->data, pkt->size);
+            _pktbuf_free(pkt, sizeof(gnrc_pktsnip_t));
+        }
+        else {
+            pkt->users--;
+        }
+        DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
+        gnrc_neterr_report(pkt, err);
+        pkt = tmp;
+    }
+}
+
+void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    mutex_lock(&_mutex);
+    _release_error_locked(pkt, err);
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&_mutex);
+        return new;
+    }
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+#ifdef DEVELHELP
+#ifdef MODULE_OD
+static inline void _print_chunk(void *chunk, size_t size, int num)
+{
+    printf("=========== chunk %3d (%-10p size: %4u) ===========\n", num, chunk,
+           (unsigned int)size);
+    od_hex_dump(chunk, size, OD_WIDTH_DEFAULT);
+}
+
+static inline void _print_ptr(_unused_t *ptr)
+{
+    if (ptr == NULL) {
+        printf("(nil)");
+    }
+    else {
+        printf("%p", (void *)ptr);
+    }
+}
+
+static inline void _print_unused(_unused_t *ptr)
+{
+    printf("~ unused: ");
+    _print_ptr(ptr);
+    printf(" (next: ");
+    _print_ptr(ptr->next);
+    printf(", size: %4u) ~\n", ptr->size);
+}
+#endif
+
+void gnrc_pktbuf_stats(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        _slab_t *slab = &_slabs[i];
+
+        printf("slab %u: %p (slot size: %4u, slots: %3u, used: %3u, "
+               "max used: %3u, fallbacks: %5u)\n", i, (void *)slab->buf,
+               slab->size, slab->numof, slab->used, slab->max_used,
+               slab->fallbacks);
+    }
+    printf("fallback arena: %p (size: %u, max used: %" PRIu16 ")\n",
+           (void *)&_pktbuf[0], CONFIG_GNRC_PKTBUF_SIZE, max_byte_count);
+#ifdef MODULE_OD
+    _unused_t *ptr = _first_unused;
+    uint8_t *chunk = &_pktbuf[0];
+    int count = 0;
+
+    printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
+           (void *)&_pktbuf[0], (void *)&_pktbuf[CONFIG_GNRC_PKTBUF_SIZE], CONFIG_GNRC_PKTBUF_SIZE);
+    printf("  position of last byte used: %" PRIu16 "\n", max_byte_count);
+    if (ptr == NULL) {  /* packet buffer is completely full */
+        _print_chunk(chunk, CONFIG_GNRC_PKTBUF_SIZE, count++);
+    }
+
+    if (((void *)ptr) == ((void *)chunk)) { /* _first_unused is at the beginning */
+        _print_unused(ptr);
+        chunk += ptr->size;
+        ptr = ptr->next;
+    }
+
+    while (ptr) {
+        size_t size = ((uint8_t *)ptr) - chunk;
+        if ((size == 0) && (!_arena_contains(ptr)) &&
+            (!_arena_contains(chunk)) && (size > CONFIG_GNRC_PKTBUF_SIZE)) {
+            puts("ERROR");
+            return;
+        }
+        _print_chunk(chunk, size, count++);
+        chunk += (size + ptr->size);
+        _print_unused(ptr);
+        ptr = ptr->next;
+    }
+
+    if (chunk <= &_pktbuf[CONFIG_GNRC_PKTBUF_SIZE - 1]) {
+        _print_chunk(chunk, &_pktbuf[CONFIG_GNRC_PKTBUF_SIZE] - chunk, count);
+    }
+#else
+    DEBUG("pktbuf: needs od module\n");
+#endif
+}
+
+size_t gnrc_pktbuf_max_used(void)
+{
+    return max_byte_count;
+}
+
+void gnrc_pktbuf_max_used_reset(void)
+{
+    mutex_lock(&_mutex);
+    max_byte_count = 0;
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        _slabs[i].max_used = _slabs[i].used;
+        _slabs[i].fallbacks = 0;
+    }
+    mutex_unlock(&_mutex);
+}
+
+int gnrc_pktbuf_slab_class_stats(unsigned idx, gnrc_pktbuf_slab_class_t *stats)
+{
+    if (idx >= ARRAY_SIZE(_slabs)) {
+        return -ENOENT;
+    }
+    mutex_lock(&_mutex);
+    stats->size = _slabs[idx].size;
+    stats->numof = _slabs[idx].numof;
+    stats->used = _slabs[idx].used;
+    stats->max_used = _slabs[idx].max_used;
+    stats->fallbacks = _slabs[idx].fallbacks;
+    mutex_unlock(&_mutex);
+    return 0;
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        if (_slabs[i].used > 0) {
+            return false;
+        }
+    }
+    return (_first_unused == (_unused_t *)_pktbuf) &&
+           (_first_unused->size == sizeof(_pktbuf_buf));
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    _unused_t *ptr = _first_unused;
+
+    /* Invariants of the slabs:
+     *  - forall slot in free list: slot is in slab && slot is at slot border &&
+     *                              refs of slot == 0
+     *  - length of free list == numof - used
+     */
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        _slab_t *slab = &_slabs[i];
+        unsigned free = 0;
+
+        for (_slot_t *slot = slab->free; slot != NULL; slot = slot->next) {
+            if (!_slab_contains(slab, slot) ||
+                ((((uint8_t *)slot) - slab->buf) % slab->size) ||
+                (slab->refs[_slot_idx(slab, slot)] != 0) ||
+                (++free > slab->numof)) {
+                return false;
+            }
+        }
+        if (free != (unsigned)(slab->numof - slab->used)) {
+            return false;
+        }
+    }
+
+    /* Invariants of the fallback arena (same as for gnrc_pktbuf_static):
+     *  - the head of _unused_t list is _first_unused
+     *  - if _unused_t list is empty the packet buffer is full and _first_unused is NULL
+     *  - forall ptr_in _unused_t list: &_pktbuf[0] < ptr < &_pktbuf[CONFIG_GNRC_PKTBUF_SIZE]
+     *  - forall ptr in _unused_t list: ptr->next == NULL || ptr < ptr->next
+     *  - forall ptr in _unused_t list: (ptr->next != NULL && ptr->size <= (ptr->next - ptr)) ||
+     *                                  (ptr->next == NULL && ptr->size == (CONFIG_GNRC_PKTBUF_SIZE - (ptr - &_pktbuf[0])))
+     */
+    while (ptr) {
+        if (&_pktbuf[0] >= (uint8_t *)ptr && (uint8_t *)ptr >= &_pktbuf[CONFIG_GNRC_PKTBUF_SIZE]) {
+            return false;
+        }
+        if ((ptr->next != NULL) && (ptr >= ptr->next)) {
+            return false;
+        }
+        if (((ptr->next == NULL) || (ptr->size > (size_t)((uint8_t *)(ptr->next) - (uint8_t *)ptr))) &&
+            ((ptr->next != NULL) ||
+             (ptr->size != (size_t)(CONFIG_GNRC_PKTBUF_SIZE - ((uint8_t *)ptr - &_pktbuf[0]))))) {
+            return false;
+        }
+        ptr = ptr->next;
+    }
+
+    return true;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _pktbuf_alloc(_SLAB_SNIP, sizeof(gnrc_pktsnip_t));
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _pktbuf_alloc(_SLAB_DATA, size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            _pktbuf_free(pkt, sizeof(gnrc_pktsnip_t));
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+/* allocates from the slab with the smallest slot that fits size, starting
+ * at slab index first, or from the fallback arena if there is none */
+static void *_pktbuf_alloc(unsigned first, size_t size)
+{
+    for (unsigned i = first; i < ARRAY_SIZE(_slabs); i++) {
+        _slab_t *slab = &_slabs[i];
+        _slot_t *slot = slab->free;
+
+        if (size > slab->size) {
+            continue;
+        }
+        if (slot == NULL) {
+#ifdef DEVELHELP
+            slab->fallbacks++;
+#endif
+            continue;
+        }
+        slab->free = slot->next;
+        slab->refs[_slot_idx(slab, slot)] = 1;
+        slab->used++;
+#ifdef DEVELHELP
+        if (slab->used > slab->max_used) {
+            slab->max_used = slab->used;
+        }
+#endif
+        return slot;
+    }
+    return _arena_alloc(size);
+}
+
+static void _pktbuf_free(void *data, size_t size)
+{
+    _slab_t *slab = _get_slab(data);
+
+    if (slab != NULL) {
+        unsigned idx = _slot_idx(slab, data);
+        /* alignment is ensured by _SLOT_SIZE(). We cast to uintptr_t as
+         * intermediate step to silence -Wcast-align */
+        _slot_t *slot = (_slot_t *)(uintptr_t)&slab->buf[idx * slab->size];
+
+        assert(slab->refs[idx] > 0);
+        if (--slab->refs[idx] == 0) {
+            slot->next = slab->free;
+            slab->free = slot;
+            slab->used--;
+        }
+    }
+    else {
+        _arena_free(data, size);
+    }
+}
+
+static void *_arena_alloc(size_t size)
+{
+    _unused_t *prev = NULL, *ptr = _first_unused;
+
+    size = _align(size);
+    while (ptr && (size > ptr->size)) {
+        prev = ptr;
+        ptr = ptr->next;
+    }
+    if (ptr == NULL) {
+        DEBUG("pktbuf: no space left in packet buffer\n");
+        return NULL;
+    }
+    /* _unused_t struct would fit => add new space at ptr */
+    if (sizeof(_unused_t) > (ptr->size - size)) {
+        if (prev == NULL) { /* ptr was _first_unused */
+            _first_unused = ptr->next;
+        }
+        else {
+            prev->next = ptr->next;
+        }
+    }
+    else {
+        /* alignment is ensured by rounding size up in the _align() function.
+         * We cast to uintptr_t as intermediate step to silence -Wcast-align */
+        _unused_t *new = (_unused_t *)((uintptr_t)ptr + size);
+
+        if (((((uint8_t *)new) - &(_pktbuf[0])) + sizeof(_unused_t)) > CONFIG_GNRC_PKTBUF_SIZE) {
+            /* content of new would exceed packet buffer size so set to NULL */
+            _first_unused = NULL;
+        }
+        else if (prev == NULL) { /* ptr was _first_unused */
+            _first_unused = new;
+        }
+        else {
+            prev->next = new;
+        }
+        new->next = ptr->next;
+        new->size = ptr->size - size;
+    }
+#ifdef DEVELHELP
+    uint16_t last_byte = (uint16_t)((((uint8_t *)ptr) + size) - &(_pktbuf[0]));
+    if (last_byte > max_byte_count) {
+        max_byte_count = last_byte;
+    }
+#endif
+    return (void *)ptr;
+}
+
+static inline bool _too_small_hole(_unused_t *a, _unused_t *b)
+{
+    return sizeof(_unused_t) > (size_t)(((uint8_t *)b) - (((uint8_t *)a) + a->size));
+}
+
+static inline _unused_t *_merge(_unused_t *a, _unused_t *b)
+{
+    assert(b != NULL);
+
+    a->next = b->next;
+    a->size = b->size + ((uint8_t *)b - (uint8_t *)a);
+    return a;
+}
+
+static void _arena_free(void *data, size_t size)
+{
+    size_t bytes_at_end;
+    _unused_t *new = (_unused_t *)data, *prev = NULL, *ptr = _first_unused;
+
+    if (!_arena_contains(data)) {
+        return;
+    }
+    while (ptr && (((void *)ptr) < data)) {
+        prev = ptr;
+        ptr = ptr->next;
+    }
+    new->next = ptr;
+    new->size = _align(size);
+    /* calculate number of bytes between new _unused_t chunk and end of packet
+     * buffer */
+    bytes_at_end = ((&_pktbuf[0] + CONFIG_GNRC_PKTBUF_SIZE) - (((uint8_t *)new) + new->size));
+    if (bytes_at_end < sizeof(_unused_t)) {
+        /* new is very last segment and there is a little bit of memory left
+         * that wouldn't fit _unused_t (cut of in _arena_alloc()) => re-add it */
+        new->size += bytes_at_end;
+    }
+    if (prev == NULL) { /* ptr was _first_unused or data before _first_unused */
+        _first_unused = new;
+    }
+    else {
+        prev->next = new;
+        if (_too_small_hole(prev, new)) {
+            new = _merge(prev, new);
+        }
+    }
+    if ((new->next != NULL) && (_too_small_hole(new, new->next))) {
+        _merge(new, new->next);
+    }
+}
+
+/** @} */
@@ -40,6 +40,9 @@ typedef struct _unused {
     unsigned int size;
 } _unused_t;
 
+static_assert(sizeof(_unused_t) == GNRC_PKTBUF_MARK_ALIGN,
+              "GNRC_PKTBUF_MARK_ALIGN must match the chunk alignment");
+
 static mutex_t _mutex = MUTEX_INIT;
 /* The static buffer needs to be aligned to word size, so that its start
  * address can be casted to `_unused_t *` safely. Just allocating an array of
@@ -81,6 +84,9 @@ static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
 #ifdef MODULE_GNRC_NETERR
     pkt->err_sub = KERNEL_PID_UNDEF;
 #endif
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+    pkt->csum = 0;
+#endif
 }
 
 void gnrc_pktbuf_init(void)
@@ -163,6 +169,9 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
                                           NULL;
     }
     pkt->size -= size;
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+    pkt->csum = 0;
+#endif
     _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
     pkt->next = marked_snip;
     mutex_unlock(&_mutex);
@@ -208,6 +217,9 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
                      pkt->size - aligned_size);
     }
     pkt->size = size;
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+    pkt->csum = 0;
+#endif
     mutex_unlock(&_mutex);
     return 0;
 }
@@ -339,6 +351,18 @@ void gnrc_pktbuf_stats(void)
     DEBUG("pktbuf: needs od module\n");
 #endif
 }
+
+size_t gnrc_pktbuf_max_used(void)
+{
+    return max_byte_count;
+}
+
+void gnrc_pktbuf_max_used_reset(void)
+{
+    mutex_lock(&_mutex);
+    max_byte_count = 0;
+    mutex_unlock(&_mutex);
+}
 #endif
 
 #ifdef TEST_SUITES
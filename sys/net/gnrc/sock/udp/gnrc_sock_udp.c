@@ -325,7 +325,11 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
         return -EINVAL;
     }
     /* generate payload and header snips */
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+    payload = gnrc_pktbuf_add_csum(NULL, data, len, GNRC_NETTYPE_UNDEF);
+#else
     payload = gnrc_pktbuf_add(NULL, (void *)data, len, GNRC_NETTYPE_UNDEF);
+#endif
     if (payload == NULL) {
         return -ENOMEM;
     }
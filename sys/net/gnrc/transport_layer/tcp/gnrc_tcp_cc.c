@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/cc.h and NewReno congestion control
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include "internal/common.h"
+#include "internal/cc.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+/**
+ * @brief Number of bytes in flight.
+ */
+static inline uint32_t _flight_size(const gnrc_tcp_tcb_t *tcb)
+{
+    return tcb->snd_nxt - tcb->snd_una;
+}
+
+static void _newreno_acked(gnrc_tcp_tcb_t *tcb, uint32_t acked)
+{
+    uint32_t smss = gnrc_tcp_cc_smss(tcb);
+
+    /* Slow start: Grow by at most SMSS per ACK (RFC 5681, section 3.1) */
+    if (tcb->cwnd < tcb->ssthresh) {
+        tcb->cwnd += (acked < smss) ? acked : smss;
+    }
+    /* Congestion avoidance: Grow by about SMSS per RTT */
+    else {
+        uint32_t incr = (smss * smss) / tcb->cwnd;
+        tcb->cwnd += (incr > 0) ? incr : 1;
+    }
+}
+
+static uint32_t _newreno_ssthresh(const gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t half = _flight_size(tcb) / 2;
+    uint32_t min = 2 * gnrc_tcp_cc_smss(tcb);
+
+    return (half > min) ? half : min;
+}
+
+const gnrc_tcp_cc_t gnrc_tcp_cc_newreno = {
+    .init = NULL,
+    .acked = _newreno_acked,
+    .ssthresh = _newreno_ssthresh,
+};
+
+void _cc_init(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t smss = gnrc_tcp_cc_smss(tcb);
+
+    /* Initial window (RFC 5681, section 3.1) */
+    if (smss > 2190) {
+        tcb->cwnd = 2 * smss;
+    }
+    else if (smss > 1095) {
+        tcb->cwnd = 3 * smss;
+    }
+    else {
+        tcb->cwnd = 4 * smss;
+    }
+    tcb->ssthresh = UINT32_MAX;
+    tcb->recover = tcb->snd_una;
+    tcb->status &= ~(STATUS_FAST_RECOVERY | STATUS_RTO_RECOVERY);
+    if (tcb->cc->init) {
+        tcb->cc->init(tcb);
+    }
+    DEBUG("gnrc_tcp_cc.c : _cc_init() : cwnd=%" PRIu32 "\n", tcb->cwnd);
+}
+
+bool _cc_ack(gnrc_tcp_tcb_t *tcb, uint32_t acked)
+{
+    uint32_t smss = gnrc_tcp_cc_smss(tcb);
+
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        /* Partial ACK: The next segment got lost as well (RFC 6582, section 3.2) */
+        if (LSS_32_BIT(tcb->snd_una, tcb->recover)) {
+            tcb->cwnd = (tcb->cwnd > acked) ? tcb->cwnd - acked : 0;
+            tcb->cwnd += smss;
+            return true;
+        }
+        /* Full ACK: Deflate the window */
+        uint32_t flight = _flight_size(tcb) + smss;
+        tcb->cwnd = (tcb->ssthresh < flight) ? tcb->ssthresh : flight;
+        tcb->status &= ~STATUS_FAST_RECOVERY;
+        DEBUG("gnrc_tcp_cc.c : _cc_ack() : Fast recovery done, cwnd=%" PRIu32 "\n",
+              tcb->cwnd);
+        return false;
+    }
+    tcb->cc->acked(tcb, acked);
+    if (tcb->status & STATUS_RTO_RECOVERY) {
+        /* Retransmit everything that was in flight on the timeout (go-back-N) */
+        if (LSS_32_BIT(tcb->snd_una, tcb->recover)) {
+            return true;
+        }
+        tcb->status &= ~STATUS_RTO_RECOVERY;
+    }
+    return false;
+}
+
+bool _cc_dup_ack(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t smss = gnrc_tcp_cc_smss(tcb);
+
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        /* Every duplicate ACK signals a segment leaving the network */
+        tcb->cwnd += smss;
+        return false;
+    }
+    if (tcb->dup_acks != DUP_ACK_THRESHOLD) {
+        return false;
+    }
+    /* Only one window reduction per window of data (RFC 6582, section 3.2) */
+    if ((tcb->status & STATUS_RTO_RECOVERY) || LSS_32_BIT(tcb->snd_una, tcb->recover)) {
+        return false;
+    }
+    tcb->ssthresh = tcb->cc->ssthresh(tcb);
+    tcb->cwnd = tcb->ssthresh + DUP_ACK_THRESHOLD * smss;
+    tcb->recover = tcb->snd_nxt;
+    tcb->status |= STATUS_FAST_RECOVERY;
+    DEBUG("gnrc_tcp_cc.c : _cc_dup_ack() : Fast retransmit, ssthresh=%" PRIu32 "\n",
+          tcb->ssthresh);
+    return true;
+}
+
+void _cc_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    /* Reduce ssthresh only once for repeated timeouts of the same segment
+     * (RFC 5681, section 3.1) */
+    if (tcb->retries == 0) {
+        tcb->ssthresh = tcb->cc->ssthresh(tcb);
+    }
+    tcb->cwnd = gnrc_tcp_cc_smss(tcb);
+    tcb->recover = tcb->snd_nxt;
+    tcb->status &= ~STATUS_FAST_RECOVERY;
+    tcb->status |= STATUS_RTO_RECOVERY;
+    DEBUG("gnrc_tcp_cc.c : _cc_timeout() : ssthresh=%" PRIu32 "\n", tcb->ssthresh);
+}
+
+uint32_t _cc_wnd(const gnrc_tcp_tcb_t *tcb)
+{
+    /* The congestion window only applies once the connection is established */
+    if (tcb->cwnd == 0) {
+        return tcb->snd_wnd;
+    }
+    return (tcb->cwnd < tcb->snd_wnd) ? tcb->cwnd : tcb->snd_wnd;
+}
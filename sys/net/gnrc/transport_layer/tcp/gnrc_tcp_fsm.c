@@ -26,6 +26,7 @@
 #include "internal/pkt.h"
 #include "internal/option.h"
 #include "internal/rcvbuf.h"
+#include "internal/cc.h"
 #include "internal/fsm.h"
 
 #ifdef MODULE_GNRC_IPV6
@@ -83,14 +84,36 @@ static uint16_t _get_random_local_port(void)
  */
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
-    if (tcb->pkt_retransmit != NULL) {
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
+    if (tcb->snd_queue_len > 0) {
+        for (unsigned i = 0; i < tcb->snd_queue_len; i++) {
+            gnrc_pktbuf_release(tcb->snd_queue[i]);
+        }
         xtimer_remove(&(tcb->timer_retransmit));
-        tcb->pkt_retransmit = NULL;
+        tcb->snd_queue_len = 0;
     }
+    tcb->status &= ~(STATUS_RTT_PENDING | STATUS_FAST_RECOVERY | STATUS_RTO_RECOVERY);
+    tcb->dup_acks = 0;
     return 0;
 }
 
+/**
+ * @brief Retransmits the oldest unacknowledged segment without waiting for
+ *        the retransmission timer.
+ *
+ * @param[in,out] tcb   TCB holding the retransmit queue.
+ */
+static void _retransmit_oldest(gnrc_tcp_tcb_t *tcb)
+{
+    DEBUG("gnrc_tcp_fsm.c : _retransmit_oldest()\n");
+    /* Every send attempt consumes a user */
+    gnrc_pktbuf_hold(tcb->snd_queue[0], 1);
+    /* Not counted in tcb->retries: that counts timeouts, see _cc_timeout() */
+    if (tcb->fast_retries < UINT8_MAX) {
+        tcb->fast_retries++;
+    }
+    _pkt_send(tcb, tcb->snd_queue[0], 0, true);
+}
+
 /**
  * @brief Restarts timewait timer.
  *
@@ -140,6 +163,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
             break;
 
         case FSM_STATE_LISTEN:
+            /* Clear retransmit queue, e.g. from a reset SYN+ACK */
+            _clear_retransmit(tcb);
+
             /* Clear address info */
 #ifdef MODULE_GNRC_IPV6
             if (tcb->address_family == AF_INET6) {
@@ -183,8 +209,12 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
             mutex_unlock(&_list_tcb_lock);
             break;
 
-        case FSM_STATE_SYN_RCVD:
         case FSM_STATE_ESTABLISHED:
+            _cc_init(tcb);
+            tcb->status |= STATUS_NOTIFY_USER;
+            break;
+
+        case FSM_STATE_SYN_RCVD:
         case FSM_STATE_CLOSE_WAIT:
             tcb->status |= STATUS_NOTIFY_USER;
             break;
@@ -220,7 +250,13 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
         return -ENOMEM;
     }
 
-    tcb->rcv_wnd = CONFIG_GNRC_TCP_DEFAULT_WINDOW;
+    tcb->rcv_wnd = _rcvbuf_get_free(tcb);
+
+    /* Options are negotiated anew for every connection */
+    tcb->status &= ~(STATUS_WND_SCALE | STATUS_TIMESTAMPS);
+    tcb->snd_wnd_scale = 0;
+    tcb->rcv_wnd_scale = 0;
+    tcb->ts_recent = 0;
 
     if (tcb->status & STATUS_PASSIVE) {
         /* Passive open, T: CLOSED -> LISTEN */
@@ -262,24 +298,41 @@ static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_call_send()\n");
 
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+
+    /* Send segments as long as send and congestion window are open and the
+     * retransmit queue has space */
+    while (sent < len && tcb->snd_queue_len < CONFIG_GNRC_TCP_SND_QUEUE_SIZE) {
+        uint32_t wnd_end = tcb->snd_una + _cc_wnd(tcb);
+
+        if (!LSS_32_BIT(tcb->snd_nxt, wnd_end)) {
+            break;
+        }
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
         /* Calculate segment size */
-        payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        size_t seg = len - sent;
+        seg = (seg < CONFIG_GNRC_TCP_MSS) ? seg : CONFIG_GNRC_TCP_MSS;
+        seg = (seg < tcb->mss) ? seg : tcb->mss;
+
+        /* Calculate payload size for this segment. Avoid sending small segments
+         * into a nearly closed window while segments are in flight (RFC 1122, 4.2.3.4) */
+        size_t payload = wnd_end - tcb->snd_nxt;
+        if (payload < seg && tcb->snd_queue_len > 0) {
+            break;
+        }
+        payload = (payload < seg) ? payload : seg;
 
-        /* Calculate payload size for this segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        if (_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt, tcb->rcv_nxt,
+                       (uint8_t *)buf + sent, payload) < 0) {
+            break;
+        }
         _pkt_setup_retransmit(tcb, out_pkt, false);
         _pkt_send(tcb, out_pkt, seq_con, false);
-        return payload;
+        sent += payload;
     }
-    return 0;
+    return sent;
 }
 
 /**
@@ -295,16 +348,18 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_call_recv()\n");
 
-    if (ringbuffer_empty(&tcb->rcv_buf)) {
+    if (_rcvbuf_empty(tcb)) {
         return 0;
     }
 
     /* Read data into 'buf' up to 'len' bytes from receive buffer */
-    size_t rcvd = ringbuffer_get(&(tcb->rcv_buf), buf, len);
+    size_t rcvd = _rcvbuf_get(tcb, buf, len);
 
-    /* If receive buffer can store more than CONFIG_GNRC_TCP_MSS: open window to available buffer size */
-    if (ringbuffer_get_free(&tcb->rcv_buf) >= CONFIG_GNRC_TCP_MSS) {
-        tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+    /* If receive buffer can store more than CONFIG_GNRC_TCP_MSS, or all it can get from
+     * the receive buffer pool: open window to available buffer size */
+    uint32_t free = _rcvbuf_get_free(tcb);
+    if ((free >= CONFIG_GNRC_TCP_MSS || _rcvbuf_empty(tcb)) && free > tcb->rcv_wnd) {
+        tcb->rcv_wnd = free;
 
         /* Send ACK to announce window update */
         gnrc_pktsnip_t *out_pkt = NULL;
@@ -397,6 +452,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     uint32_t seg_seq = 0;            /* Sequence number of the incoming packet*/
     uint32_t seg_ack = 0;            /* Acknowledgment number of the incoming packet */
     uint32_t seg_wnd = 0;            /* Receive window of the incoming packet */
+    option_values_t opts;            /* Options of the incoming packet */
 
     DEBUG("gnrc_tcp_fsm.c : _fsm_rcvd_pkt()\n");
     /* Search for TCP header. */
@@ -404,7 +460,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     tcp_hdr_t *tcp_hdr = (tcp_hdr_t *) snp->data;
 
     /* Parse packet options, return if they are malformed */
-    if (_option_parse(tcb, tcp_hdr) < 0) {
+    if (_option_parse(tcb, tcp_hdr, &opts) < 0) {
         return 0;
     }
 
@@ -413,6 +469,10 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     seg_seq = byteorder_ntohl(tcp_hdr->seq_num);
     seg_ack = byteorder_ntohl(tcp_hdr->ack_num);
     seg_wnd = byteorder_ntohs(tcp_hdr->window);
+    /* The window of a SYN is never scaled (see RFC 7323, section 2.2) */
+    if (!(ctl & MSK_SYN)) {
+        seg_wnd <<= tcb->snd_wnd_scale;
+    }
 
     /* Extract network layer header */
 #ifdef MODULE_GNRC_IPV6
@@ -502,6 +562,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             tcb->snd_una = tcb->iss;
             tcb->snd_nxt = tcb->iss;
             tcb->snd_wnd = seg_wnd;
+            _option_negotiate(tcb, &opts);
 
             /* Send SYN+ACK: seq_no = iss, ack_no = rcv_nxt, T: LISTEN -> SYN_RCVD */
             _pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN_ACK, tcb->iss, tcb->rcv_nxt, NULL, 0);
@@ -537,9 +598,11 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
         if (ctl & MSK_SYN) {
             tcb->rcv_nxt = seg_seq + 1;
             tcb->irs = seg_seq;
+            _option_negotiate(tcb, &opts);
             if (ctl & MSK_ACK) {
                 tcb->snd_una = seg_ack;
-                _pkt_acknowledge(tcb, seg_ack);
+                _pkt_acknowledge(tcb, seg_ack,
+                                 (opts.found & OPTION_FOUND_TS) ? opts.ts_ecr : 0);
             }
             /* Set local network layer address accordingly */
 #ifdef MODULE_GNRC_IPV6
@@ -574,8 +637,10 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     else {
         uint32_t seg_len = _pkt_get_seg_len(in_pkt);
         uint32_t pay_len = _pkt_get_pay_len(in_pkt);
-        /* 1) Verify sequence number ... */
-        if (_pkt_chk_seq_num(tcb, seg_seq, pay_len)) {
+        bool has_ts = (tcb->status & STATUS_TIMESTAMPS) && (opts.found & OPTION_FOUND_TS);
+        /* 1) Verify sequence number and timestamp (PAWS, see RFC 7323, section 5) ... */
+        if (_pkt_chk_seq_num(tcb, seg_seq, pay_len) ||
+            (has_ts && !(ctl & MSK_RST) && LSS_32_BIT(opts.ts_val, tcb->ts_recent))) {
             /* ... if invalid, and RST not set, reply with pure ACK, return */
             if ((ctl & MSK_RST) != MSK_RST) {
                 _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
@@ -583,6 +648,10 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             }
             return 0;
         }
+        /* Remember the timestamp to echo, if the segment is in sequence */
+        if (has_ts && LEQ_32_BIT(seg_seq, tcb->rcv_nxt)) {
+            tcb->ts_recent = opts.ts_val;
+        }
         /* 2) Check RST: If RST is set ... */
         if (ctl & MSK_RST) {
             /* .. and state is SYN_RCVD and the connection is passive: SYN_RCVD -> LISTEN */
@@ -625,8 +694,30 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                    uint32_t acked = seg_ack - tcb->snd_una;
+
                     tcb->snd_una = seg_ack;
-                    _pkt_acknowledge(tcb, seg_ack);
+                    tcb->dup_acks = 0;
+                    _pkt_acknowledge(tcb, seg_ack, has_ts ? opts.ts_ecr : 0);
+                    if (_cc_ack(tcb, acked) && tcb->snd_queue_len > 0) {
+                        _retransmit_oldest(tcb);
+                    }
+
+                    /* Signal user that there is space in the retransmit queue */
+                    tcb->status |= STATUS_NOTIFY_USER;
+                }
+                /* Duplicate ACK: After DUP_ACK_THRESHOLD of them, the oldest
+                 * segment is assumed to be lost (Fast Retransmit, RFC 5681) */
+                else if (seg_ack == tcb->snd_una && pay_len == 0 && seg_wnd == tcb->snd_wnd &&
+                         tcb->snd_queue_len > 0 && !(ctl & MSK_FIN)) {
+                    if (tcb->dup_acks < UINT8_MAX) {
+                        tcb->dup_acks++;
+                    }
+                    if (_cc_dup_ack(tcb)) {
+                        _retransmit_oldest(tcb);
+                    }
+                    /* The inflated congestion window may allow new data */
+                    tcb->status |= STATUS_NOTIFY_USER;
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -650,25 +741,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->snd_queue_len == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->snd_queue_len == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->snd_queue_len == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->snd_queue_len == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         return 0;
                     }
@@ -690,11 +781,11 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 if (tcb->rcv_nxt == seg_seq) {
                     /* Copy contents into receive buffer */
                     while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
+                        tcb->rcv_nxt += _rcvbuf_add(tcb, snp->data, snp->size);
                         snp = snp->next;
                     }
                     /* Shrink receive window */
-                    tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+                    tcb->rcv_wnd = _rcvbuf_get_free(tcb);
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
@@ -722,7 +813,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->snd_queue_len == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -764,9 +855,12 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit()\n");
-    if (tcb->pkt_retransmit != NULL) {
-        _pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->snd_queue_len > 0) {
+        tcb->dup_acks = 0;
+        _cc_timeout(tcb);
+        _pkt_setup_retransmit(tcb, tcb->snd_queue[0], true);
+        tcb->retries += 1;
+        _pkt_send(tcb, tcb->snd_queue[0], 0, true);
     }
     else {
         DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit() : Retransmit queue is empty\n");
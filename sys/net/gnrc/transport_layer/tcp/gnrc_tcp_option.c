@@ -16,14 +16,81 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  * @}
  */
+#include <string.h>
+#include "kernel_defines.h"
 #include "internal/common.h"
 #include "internal/option.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
-int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
+uint8_t _option_build(const gnrc_tcp_tcb_t *tcb, uint16_t ctl, uint8_t *opt_ptr)
 {
+    uint8_t len = 0;
+
+    /* If SYN flag is set: Add MSS option */
+    if (ctl & MSK_SYN) {
+        if (opt_ptr) {
+            network_uint32_t mss_option = byteorder_htonl(_option_build_mss(CONFIG_GNRC_TCP_MSS));
+            memcpy(opt_ptr + len, &mss_option, sizeof(mss_option));
+        }
+        len += sizeof(network_uint32_t);
+    }
+    /* Offer window scaling in a SYN, confirm it in a SYN+ACK */
+    if (IS_ACTIVE(CONFIG_GNRC_TCP_WND_SCALE) && (ctl & MSK_SYN) &&
+        (!(ctl & MSK_ACK) || (tcb->status & STATUS_WND_SCALE))) {
+        if (opt_ptr) {
+            opt_ptr[len] = TCP_OPTION_KIND_NOP;
+            opt_ptr[len + 1] = TCP_OPTION_KIND_WS;
+            opt_ptr[len + 2] = TCP_OPTION_LENGTH_WS;
+            opt_ptr[len + 3] = _option_wnd_scale();
+        }
+        len += 4;
+    }
+    /* Offer timestamps in a SYN, add them to every segment once both sides use them */
+    if (IS_ACTIVE(CONFIG_GNRC_TCP_TIMESTAMPS) && !(ctl & MSK_RST) &&
+        (((ctl & MSK_SYN_ACK) == MSK_SYN) || (tcb->status & STATUS_TIMESTAMPS))) {
+        if (opt_ptr) {
+            network_uint32_t ts_val = byteorder_htonl(_option_ts_now());
+            network_uint32_t ts_ecr = byteorder_htonl(tcb->ts_recent);
+
+            opt_ptr[len] = TCP_OPTION_KIND_NOP;
+            opt_ptr[len + 1] = TCP_OPTION_KIND_NOP;
+            opt_ptr[len + 2] = TCP_OPTION_KIND_TS;
+            opt_ptr[len + 3] = TCP_OPTION_LENGTH_TS;
+            memcpy(opt_ptr + len + 4, &ts_val, sizeof(ts_val));
+            memcpy(opt_ptr + len + 8, &ts_ecr, sizeof(ts_ecr));
+        }
+        len += 12;
+    }
+    return len;
+}
+
+void _option_negotiate(gnrc_tcp_tcb_t *tcb, const option_values_t *opts)
+{
+    tcb->status &= ~(STATUS_WND_SCALE | STATUS_TIMESTAMPS);
+    tcb->snd_wnd_scale = 0;
+    tcb->rcv_wnd_scale = 0;
+    tcb->ts_recent = 0;
+
+    if (IS_ACTIVE(CONFIG_GNRC_TCP_WND_SCALE) && (opts->found & OPTION_FOUND_WS)) {
+        tcb->status |= STATUS_WND_SCALE;
+        tcb->snd_wnd_scale = opts->ws_shift;
+        tcb->rcv_wnd_scale = _option_wnd_scale();
+    }
+    if (IS_ACTIVE(CONFIG_GNRC_TCP_TIMESTAMPS) && (opts->found & OPTION_FOUND_TS)) {
+        tcb->status |= STATUS_TIMESTAMPS;
+        tcb->ts_recent = opts->ts_val;
+    }
+    DEBUG("gnrc_tcp_option.c : _option_negotiate() : snd_wnd_scale=%u, rcv_wnd_scale=%u, "
+          "timestamps=%u\n", tcb->snd_wnd_scale, tcb->rcv_wnd_scale,
+          (tcb->status & STATUS_TIMESTAMPS) ? 1 : 0);
+}
+
+int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr, option_values_t *opts)
+{
+    opts->found = 0;
+
     /* Extract offset value. Return if no options are set */
     uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
     if (offset <= TCP_HDR_OFFSET_MIN) {
@@ -62,6 +129,35 @@ int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                       tcb->mss);
                 break;
 
+            case TCP_OPTION_KIND_WS:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_WS) {
+                    DEBUG("gnrc_tcp_option.c : _option_parse() : invalid WS Option length.\n");
+                    return -1;
+                }
+                opts->found |= OPTION_FOUND_WS;
+                opts->ws_shift = option->value[0];
+                /* Larger shifts are treated as the maximum (RFC 7323, section 2.3) */
+                if (opts->ws_shift > OPTION_WS_SHIFT_MAX) {
+                    opts->ws_shift = OPTION_WS_SHIFT_MAX;
+                }
+                DEBUG("gnrc_tcp_option.c : _option_parse() : WS option found. shift=%u\n",
+                      opts->ws_shift);
+                break;
+
+            case TCP_OPTION_KIND_TS:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_TS) {
+                    DEBUG("gnrc_tcp_option.c : _option_parse() : invalid TS Option length.\n");
+                    return -1;
+                }
+                opts->found |= OPTION_FOUND_TS;
+                opts->ts_val = byteorder_bebuftohl(&option->value[0]);
+                opts->ts_ecr = byteorder_bebuftohl(&option->value[4]);
+                DEBUG("gnrc_tcp_option.c : _option_parse() : TS option found. TSval=%"PRIu32
+                      ", TSecr=%"PRIu32"\n", opts->ts_val, opts->ts_ecr);
+                break;
+
             default:
                 if (opt_left >= TCP_OPTION_LENGTH_MIN) {
                     DEBUG("gnrc_tcp_option.c : _option_parse() : Unsupported option found.\
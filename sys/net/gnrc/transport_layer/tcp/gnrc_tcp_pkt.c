@@ -150,7 +150,11 @@ int _pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt, uint16_t *seq_con,
 
     /* Add payload, if supplied */
     if (payload != NULL && payload_len > 0) {
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+        pay_snp = gnrc_pktbuf_add_csum(pay_snp, payload, payload_len, GNRC_NETTYPE_UNDEF);
+#else
         pay_snp = gnrc_pktbuf_add(pay_snp, payload, payload_len, GNRC_NETTYPE_UNDEF);
+#endif
         if (pay_snp == NULL) {
             DEBUG("gnrc_tcp_pkt.c : _pkt_build() : Can't allocate buffer for payload\n.");
             *(out_pkt) = NULL;
@@ -164,14 +168,13 @@ int _pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt, uint16_t *seq_con,
     tcp_hdr.checksum = byteorder_htons(0);
     tcp_hdr.seq_num = byteorder_htonl(seq_num);
     tcp_hdr.ack_num = byteorder_htonl(ack_num);
-    tcp_hdr.window = byteorder_htons(tcb->rcv_wnd);
+    /* The window of a SYN is never scaled (see RFC 7323, section 2.2) */
+    uint32_t wnd = (ctl & MSK_SYN) ? tcb->rcv_wnd : (tcb->rcv_wnd >> tcb->rcv_wnd_scale);
+    tcp_hdr.window = byteorder_htons((wnd < UINT16_MAX) ? wnd : UINT16_MAX);
     tcp_hdr.urgent_ptr = byteorder_htons(0);
 
     /* Calculate option field size. */
-    /* Add MSS option if SYN is sent */
-    if (ctl & MSK_SYN) {
-        offset += 1;
-    }
+    offset += _option_build(tcb, ctl, NULL) / sizeof(network_uint32_t);
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(_option_build_offset_control(offset, ctl));
 
@@ -199,13 +202,7 @@ int _pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt, uint16_t *seq_con,
             /* Init options field with 'End Of List' - option (0) */
             memset(opt_ptr, TCP_OPTION_KIND_EOL, opt_left);
 
-            /* If SYN flag is set: Add MSS option */
-            if (ctl & MSK_SYN) {
-                network_uint32_t mss_option = byteorder_htonl(_option_build_mss(CONFIG_GNRC_TCP_MSS));
-                memcpy(opt_ptr, &mss_option, sizeof(mss_option));
-            }
-            /* Increase opt_ptr and decrease opt_left, if other options are added */
-            /* NOTE: Add additional options here */
+            _option_build(tcb, ctl, opt_ptr);
         }
         *(out_pkt) = tcp_snp;
     }
@@ -267,14 +264,21 @@ int _pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt, const uint16_t seq_c
         return -EINVAL;
     }
 
-    /* If this is no retransmission, advance sequence number and measure time */
+    /* If this is no retransmission, advance sequence number and measure time
+     * until this segment is acknowledged, if no other segment is timed already.
+     * With timestamps, every acknowledgment carries its own time measurement. */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = xtimer_now().ticks32;
+        if (seq_con > 0 && !(tcb->status & (STATUS_RTT_PENDING | STATUS_TIMESTAMPS))) {
+            tcb->status |= STATUS_RTT_PENDING;
+            tcb->rtt_start = xtimer_now().ticks32;
+            tcb->rtt_seq = tcb->snd_nxt;
+        }
     }
     else {
-        tcb->retries += 1;
+        tcb->retransmits += 1;
+        /* Karns Algorithm: Don't measure time over retransmissions */
+        tcb->status &= ~STATUS_RTT_PENDING;
     }
 
     /* Pass packet down the network stack */
@@ -349,6 +353,43 @@ uint32_t _pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
+/**
+ * @brief Calculates the RTO from the current RTT estimation.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _update_rto(gnrc_tcp_tcb_t *tcb)
+{
+    /* If there is no estimation yet: rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND;
+    }
+    else {
+        tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY, CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+    }
+}
+
+/**
+ * @brief (Re-)starts the retransmission timer with the current RTO.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _start_retransmit_timer(gnrc_tcp_tcb_t *tcb)
+{
+    /* Perform boundary checks on current RTO before usage */
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND;
+    }
+
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    tcb->msg_retransmit.type = MSG_TYPE_RETRANSMISSION;
+    tcb->msg_retransmit.content.ptr = (void *) tcb;
+    xtimer_set_msg(&tcb->timer_retransmit, tcb->rto, &tcb->msg_retransmit, gnrc_tcp_pid);
+}
+
 int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool retransmit)
 {
     gnrc_pktsnip_t *snp = NULL;
@@ -361,9 +402,15 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
+    /* Only the oldest segment is retransmitted */
+    if (retransmit && (tcb->snd_queue_len == 0 || tcb->snd_queue[0] != pkt)) {
         DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : Nothing to do\n");
+        return -EINVAL;
+    }
+
+    /* Check if retransmit queue is full */
+    if (!retransmit && tcb->snd_queue_len >= GNRC_TCP_SND_QUEUE_LEN) {
+        DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : Retransmit queue is full\n");
         return -ENOMEM;
     }
 
@@ -377,19 +424,18 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
+    /* Increase users: every send attempt consumes a user */
     gnrc_pktbuf_hold(pkt, 1);
 
     /* RTO adjustment */
     if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY, CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+        tcb->snd_queue[tcb->snd_queue_len++] = pkt;
+
+        /* The timer is already running for an older segment */
+        if (tcb->snd_queue_len > 1) {
+            return 0;
         }
+        _update_rto(tcb);
     }
     else {
         /* If this is a retransmission: Double the rto (Timer Backoff) */
@@ -403,63 +449,80 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
         }
     }
 
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND;
-    }
-
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    tcb->msg_retransmit.type = MSG_TYPE_RETRANSMISSION;
-    tcb->msg_retransmit.content.ptr = (void *) tcb;
-    xtimer_set_msg(&tcb->timer_retransmit, tcb->rto, &tcb->msg_retransmit, gnrc_tcp_pid);
+    _start_retransmit_timer(tcb);
     return 0;
 }
 
-int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
+int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack, const uint32_t ts_ecr)
 {
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
+    unsigned acked = 0;
+    int32_t rtt = 0;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->snd_queue_len == 0) {
         DEBUG("gnrc_tcp_pkt.c : _pkt_acknowledge() : There is no packet to ack\n");
         return -ENODATA;
     }
 
-    LL_SEARCH_SCALAR(tcb->pkt_retransmit, snp, type, GNRC_NETTYPE_TCP);
-    hdr = (tcp_hdr_t *) snp->data;
-
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _pkt_get_seg_len(tcb->pkt_retransmit) - 1;
-
-    /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        xtimer_remove(&(tcb->timer_retransmit));
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
-
-        /* Measure round trip time */
-        int32_t rtt = xtimer_now().ticks32 - tcb->rtt_start;
-
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
-            /* If this is the first sample taken */
-            if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
-                tcb->srtt = rtt;
-                tcb->rtt_var = (rtt >> 1);
-            }
-            /* If this is a subsequent sample */
-            else {
-                tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
-                tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
-                tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
-                tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
-            }
+    /* Release all segments that are acknowledged completely (cumulative ACK) */
+    while (acked < tcb->snd_queue_len) {
+        gnrc_pktsnip_t *pkt = tcb->snd_queue[acked];
+        gnrc_pktsnip_t *snp = NULL;
+
+        LL_SEARCH_SCALAR(pkt, snp, type, GNRC_NETTYPE_TCP);
+        uint32_t seg = byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num) +
+                       _pkt_get_seg_len(pkt) - 1;
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
         }
+        gnrc_pktbuf_release(pkt);
+        acked++;
+    }
+    if (acked == 0) {
+        return 0;
+    }
+    tcb->snd_queue_len -= acked;
+    memmove(tcb->snd_queue, &tcb->snd_queue[acked],
+            tcb->snd_queue_len * sizeof(tcb->snd_queue[0]));
+    xtimer_remove(&(tcb->timer_retransmit));
+
+    /* Measure round trip time with the echoed timestamp. Retransmitted segments
+     * carry the timestamp of their first transmission, so skip those. */
+    if (tcb->status & STATUS_TIMESTAMPS) {
+        if (ts_ecr != 0 && tcb->retries == 0 && tcb->fast_retries == 0) {
+            rtt = (_option_ts_now() - ts_ecr) * US_PER_MS;
+            /* Clock granularity is one millisecond */
+            rtt = (rtt > 0) ? rtt : 1;
+        }
+    }
+    /* Measure round trip time, if the timed segment was acknowledged */
+    else if ((tcb->status & STATUS_RTT_PENDING) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
+        rtt = xtimer_now().ticks32 - tcb->rtt_start;
+        tcb->status &= ~STATUS_RTT_PENDING;
+    }
+    tcb->retries = 0;
+    tcb->fast_retries = 0;
+
+    /* Use time only if there was no timer overflow */
+    if (rtt > 0) {
+        /* If this is the first sample taken */
+        if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
+            tcb->srtt = rtt;
+            tcb->rtt_var = (rtt >> 1);
+        }
+        /* If this is a subsequent sample */
+        else {
+            tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
+            tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
+            tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
+            tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
+        }
+    }
+
+    /* Restart timer for the oldest segment that is still unacknowledged */
+    if (tcb->snd_queue_len > 0) {
+        _update_rto(tcb);
+        _start_retransmit_timer(tcb);
     }
     return 0;
 }
@@ -476,7 +539,16 @@ uint16_t _pkt_calc_csum(const gnrc_pktsnip_t *hdr, const gnrc_pktsnip_t *pseudo_
 
     /* Process payload */
     while (payload && payload != hdr) {
-        csum = inet_csum(csum, (uint8_t *)payload->data, payload->size);
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+        if (payload->csum != 0) {
+            /* checksum was already calculated when the payload was copied */
+            csum = inet_csum_add(csum, payload->csum, 0);
+        }
+        else
+#endif
+        {
+            csum = inet_csum(csum, (uint8_t *)payload->data, payload->size);
+        }
         len += (uint16_t)payload->size;
         payload = payload->next;
     }
@@ -15,87 +15,230 @@
  *
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
+#include <assert.h>
 #include <errno.h>
+#include <string.h>
 #include "internal/rcvbuf.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
+static_assert(GNRC_TCP_RCV_BUF_RESERVED_BLOCKS > 0,
+              "receive buffer pool too small for CONFIG_GNRC_TCP_RCV_BUFFERS connections");
+
 /**
- * @brief Internal struct holding receive buffers.
+ * @brief Internal struct holding the receive buffer pool.
  */
 rcvbuf_t _static_buf;
 
 /**
- * @brief Initializes all receive buffers.
+ * @brief Initializes the receive buffer pool.
  */
 void _rcvbuf_init(void)
 {
     DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_init() : entry\n");
     mutex_init(&(_static_buf.lock));
-    for (size_t i = 0; i < CONFIG_GNRC_TCP_RCV_BUFFERS; ++i) {
-        _static_buf.entries[i].used = 0;
+    _static_buf.free = NULL;
+    for (size_t i = 0; i < GNRC_TCP_RCV_BUF_BLOCKS; ++i) {
+        _static_buf.blocks[i].next = _static_buf.free;
+        _static_buf.free = &_static_buf.blocks[i];
     }
+    _static_buf.free_numof = GNRC_TCP_RCV_BUF_BLOCKS;
+    _static_buf.reserved_numof = 0;
 }
 
 /**
- * @brief Allocate receive buffer.
+ * @brief Number of blocks of the reservation of a receive buffer that are
+ *        still free.
  *
- * @returns   Not NULL if a receive buffer was allocated.
- *            NULL if allocation failed.
+ * @param[in] rb       Receive buffer.
+ * @param[in] blocks   Number of blocks @p rb holds.
  */
-static void* _rcvbuf_alloc(void)
+static size_t _reserved_free(const gnrc_tcp_rcvbuf_t *rb, size_t blocks)
 {
-    void *result = NULL;
-    DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_alloc() : Entry\n");
+    if (!rb->reserved || blocks >= GNRC_TCP_RCV_BUF_RESERVED_BLOCKS) {
+        return 0;
+    }
+    return GNRC_TCP_RCV_BUF_RESERVED_BLOCKS - blocks;
+}
+
+/**
+ * @brief Allocate a receive buffer block.
+ *
+ * Takes a block of the reservation of @p rb, or else an unreserved one.
+ *
+ * @param[in,out] rb   Receive buffer the block is allocated for.
+ *
+ * @returns   Not NULL if a block was allocated.
+ *            NULL if the pool is exhausted.
+ */
+static rcvbuf_block_t *_rcvbuf_alloc(gnrc_tcp_rcvbuf_t *rb)
+{
+    rcvbuf_block_t *result = NULL;
+    size_t reserved = _reserved_free(rb, rb->blocks);
+
     mutex_lock(&(_static_buf.lock));
-    for (size_t i = 0; i < CONFIG_GNRC_TCP_RCV_BUFFERS; ++i) {
-        if (_static_buf.entries[i].used == 0) {
-            _static_buf.entries[i].used = 1;
-            result = (void *)(_static_buf.entries[i].buffer);
-            break;
+    if (reserved > 0 || _static_buf.free_numof > _static_buf.reserved_numof) {
+        result = _static_buf.free;
+        _static_buf.free = result->next;
+        _static_buf.free_numof--;
+        if (reserved > 0) {
+            _static_buf.reserved_numof--;
         }
+        result->next = NULL;
+        rb->blocks++;
     }
     mutex_unlock(&(_static_buf.lock));
     return result;
 }
 
 /**
- * @brief Release allocated receive buffer.
+ * @brief Release a list of receive buffer blocks.
  *
- * @param[in] buf   Pointer to buffer that should be released.
+ * Blocks within the reservation of @p rb stay reserved for it.
+ *
+ * @param[in,out] rb      Receive buffer the blocks were allocated for.
+ * @param[in]     first   First block of the list.
+ * @param[in]     last    Last block of the list.
+ * @param[in]     numof   Number of blocks in the list.
  */
-static void _rcvbuf_free(void * const buf)
+static void _rcvbuf_free(gnrc_tcp_rcvbuf_t *rb, rcvbuf_block_t *first,
+                         rcvbuf_block_t *last, size_t numof)
 {
-    DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_free() : Entry\n");
+    size_t reserved = _reserved_free(rb, rb->blocks - numof) -
+                      _reserved_free(rb, rb->blocks);
+
+    DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_free() : %u blocks\n", (unsigned)numof);
     mutex_lock(&(_static_buf.lock));
-    for (size_t i = 0; i < CONFIG_GNRC_TCP_RCV_BUFFERS; ++i) {
-        if ((_static_buf.entries[i].used == 1) && (buf == _static_buf.entries[i].buffer)) {
-            _static_buf.entries[i].used = 0;
-        }
-    }
+    last->next = _static_buf.free;
+    _static_buf.free = first;
+    _static_buf.free_numof += numof;
+    _static_buf.reserved_numof += reserved;
     mutex_unlock(&(_static_buf.lock));
+    rb->blocks -= numof;
 }
 
 int _rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb)
 {
-    if (tcb->rcv_buf_raw == NULL) {
-        tcb->rcv_buf_raw = _rcvbuf_alloc();
-        if (tcb->rcv_buf_raw == NULL) {
-            DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_get_buffer() : Can't allocate rcv_buf_raw\n");
-            return -ENOMEM;
+    int ret = 0;
+
+    _rcvbuf_release_buffer(tcb);
+    mutex_lock(&(_static_buf.lock));
+    if (_static_buf.free_numof - _static_buf.reserved_numof >= GNRC_TCP_RCV_BUF_RESERVED_BLOCKS) {
+        _static_buf.reserved_numof += GNRC_TCP_RCV_BUF_RESERVED_BLOCKS;
+        tcb->rcv_buf.reserved = true;
+    }
+    else {
+        DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_get_buffer() : Receive buffer pool exhausted\n");
+        ret = -ENOMEM;
+    }
+    mutex_unlock(&(_static_buf.lock));
+    return ret;
+}
+
+void _rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
+{
+    gnrc_tcp_rcvbuf_t *rb = &tcb->rcv_buf;
+
+    if (rb->head != NULL) {
+        _rcvbuf_free(rb, rb->head, rb->tail, rb->blocks);
+    }
+    if (rb->reserved) {
+        mutex_lock(&(_static_buf.lock));
+        _static_buf.reserved_numof -= GNRC_TCP_RCV_BUF_RESERVED_BLOCKS;
+        mutex_unlock(&(_static_buf.lock));
+    }
+    memset(rb, 0, sizeof(*rb));
+}
+
+size_t _rcvbuf_add(gnrc_tcp_tcb_t *tcb, const void *data, size_t len)
+{
+    gnrc_tcp_rcvbuf_t *rb = &tcb->rcv_buf;
+    size_t added = 0;
+
+    if (len > GNRC_TCP_RCV_BUF_SIZE - rb->len) {
+        len = GNRC_TCP_RCV_BUF_SIZE - rb->len;
+    }
+    while (added < len) {
+        /* Append a new block if the current one is full */
+        if (rb->tail == NULL || rb->tail_pos == CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE) {
+            rcvbuf_block_t *block = _rcvbuf_alloc(rb);
+
+            if (block == NULL) {
+                DEBUG("gnrc_tcp_rcvbuf.c : _rcvbuf_add() : Receive buffer pool exhausted\n");
+                break;
+            }
+            if (rb->tail == NULL) {
+                rb->head = block;
+                rb->head_pos = 0;
+            }
+            else {
+                rb->tail->next = block;
+            }
+            rb->tail = block;
+            rb->tail_pos = 0;
         }
-        else {
-            ringbuffer_init(&tcb->rcv_buf, (char *) tcb->rcv_buf_raw, GNRC_TCP_RCV_BUF_SIZE);
+        size_t chunk = CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE - rb->tail_pos;
+        chunk = (chunk < len - added) ? chunk : len - added;
+        memcpy(&rb->tail->data[rb->tail_pos], (const uint8_t *)data + added, chunk);
+        rb->tail_pos += chunk;
+        added += chunk;
+    }
+    rb->len += added;
+    return added;
+}
+
+size_t _rcvbuf_get(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
+{
+    gnrc_tcp_rcvbuf_t *rb = &tcb->rcv_buf;
+    rcvbuf_block_t *first = rb->head;
+    rcvbuf_block_t *last = NULL;
+    size_t numof = 0;
+    size_t read = 0;
+
+    len = (len < rb->len) ? len : rb->len;
+    while (read < len) {
+        size_t end = (rb->head == rb->tail) ? rb->tail_pos : CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE;
+        size_t chunk = end - rb->head_pos;
+
+        chunk = (chunk < len - read) ? chunk : len - read;
+        memcpy((uint8_t *)buf + read, &rb->head->data[rb->head_pos], chunk);
+        rb->head_pos += chunk;
+        read += chunk;
+
+        /* Collect blocks that were read completely */
+        if (rb->head_pos == CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE ||
+            (rb->head == rb->tail && rb->head_pos == rb->tail_pos)) {
+            last = rb->head;
+            numof++;
+            if (rb->head == rb->tail) {
+                rb->head = NULL;
+                rb->tail = NULL;
+                rb->tail_pos = 0;
+            }
+            else {
+                rb->head = rb->head->next;
+            }
+            rb->head_pos = 0;
         }
     }
-    return 0;
+    rb->len -= read;
+    if (numof > 0) {
+        _rcvbuf_free(rb, first, last, numof);
+    }
+    return read;
 }
 
-void _rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
+uint32_t _rcvbuf_get_free(const gnrc_tcp_tcb_t *tcb)
 {
-    if (tcb->rcv_buf_raw != NULL) {
-        _rcvbuf_free(tcb->rcv_buf_raw);
-        tcb->rcv_buf_raw = NULL;
+    const gnrc_tcp_rcvbuf_t *rb = &tcb->rcv_buf;
+    uint32_t space = GNRC_TCP_RCV_BUF_SIZE - rb->len;
+    size_t blocks = _static_buf.free_numof - _static_buf.reserved_numof +
+                    _reserved_free(rb, rb->blocks);
+    uint32_t pool = blocks * CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE;
+
+    if (rb->tail != NULL) {
+        pool += CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE - rb->tail_pos;
     }
+    return (space < pool) ? space : pool;
 }
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       Congestion window handling and loss recovery.
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef CC_H
+#define CC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "net/gnrc/tcp/cc.h"
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initializes congestion control of a newly established connection.
+ *
+ * @param[in,out] tcb   TCB of the connection.
+ */
+void _cc_init(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Updates the congestion window on an acknowledgment of new data.
+ *
+ * @note tcb->snd_una must already be updated.
+ *
+ * @param[in,out] tcb     TCB of the connection.
+ * @param[in]     acked   Number of newly acknowledged bytes.
+ *
+ * @returns   true, if the oldest unacknowledged segment must be retransmitted
+ *            (partial acknowledgment during loss recovery).
+ *            false otherwise.
+ */
+bool _cc_ack(gnrc_tcp_tcb_t *tcb, uint32_t acked);
+
+/**
+ * @brief Updates the congestion window on a duplicate acknowledgment.
+ *
+ * @param[in,out] tcb   TCB of the connection. tcb->dup_acks must already
+ *                      count this duplicate acknowledgment.
+ *
+ * @returns   true, if the oldest unacknowledged segment must be retransmitted
+ *            (fast retransmit).
+ *            false otherwise.
+ */
+bool _cc_dup_ack(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Collapses the congestion window on a retransmission timeout.
+ *
+ * @param[in,out] tcb   TCB of the connection.
+ */
+void _cc_timeout(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Returns the number of bytes that may be in flight.
+ *
+ * @param[in] tcb   TCB of the connection.
+ *
+ * @returns   Minimum of send window and congestion window.
+ */
+uint32_t _cc_wnd(const gnrc_tcp_tcb_t *tcb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CC_H */
+/** @} */
@@ -46,8 +46,18 @@ extern "C" {
 #define STATUS_PASSIVE        (1 << 0)
 #define STATUS_ALLOW_ANY_ADDR (1 << 1)
 #define STATUS_NOTIFY_USER    (1 << 2)
+#define STATUS_RTT_PENDING    (1 << 3)
+#define STATUS_FAST_RECOVERY  (1 << 4)
+#define STATUS_RTO_RECOVERY   (1 << 5)
+#define STATUS_WND_SCALE      (1 << 6)
+#define STATUS_TIMESTAMPS     (1 << 7)
 /** @} */
 
+/**
+ * @brief Number of duplicate ACKs triggering a fast retransmit (see RFC 5681)
+ */
+#define DUP_ACK_THRESHOLD (3U)
+
 /**
  * @brief Defines for "eventloop" thread settings.
  * @{
@@ -23,12 +23,60 @@
 #include <stdint.h>
 #include "assert.h"
 #include "net/tcp.h"
+#include "net/gnrc/tcp/config.h"
 #include "net/gnrc/tcp/tcb.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Maximum window scale shift (see RFC 7323, section 2.3)
+ */
+#define OPTION_WS_SHIFT_MAX (14U)
+
+/**
+ * @brief Flags of options found by _option_parse().
+ * @{
+ */
+#define OPTION_FOUND_WS (1 << 0)
+#define OPTION_FOUND_TS (1 << 1)
+/** @} */
+
+/**
+ * @brief Values of options that are not stored in the TCB directly.
+ */
+typedef struct {
+    uint8_t found;      /**< Found options, see OPTION_FOUND_* */
+    uint8_t ws_shift;   /**< Shift of the window scale option */
+    uint32_t ts_val;    /**< TSval of the timestamps option */
+    uint32_t ts_ecr;    /**< TSecr of the timestamps option */
+} option_values_t;
+
+/**
+ * @brief Helper function to calculate the own window scale shift.
+ *
+ * @returns   Smallest shift, that allows to announce the complete receive buffer.
+ */
+static inline uint8_t _option_wnd_scale(void)
+{
+    uint8_t shift = 0;
+    while (shift < OPTION_WS_SHIFT_MAX && (GNRC_TCP_RCV_BUF_SIZE >> shift) > UINT16_MAX) {
+        shift++;
+    }
+    return shift;
+}
+
+/**
+ * @brief Helper function to get the current value of the timestamp clock.
+ *
+ * @returns   Timestamp clock value in milliseconds.
+ */
+static inline uint32_t _option_ts_now(void)
+{
+    return (uint32_t)(xtimer_now_usec64() / US_PER_MS);
+}
+
 /**
  * @brief Helper function to build the MSS option.
  *
@@ -56,16 +104,36 @@ static inline uint16_t _option_build_offset_control(uint16_t nopts, uint16_t ctl
     return (nopts << 12) | ctl;
 }
 
+/**
+ * @brief Builds the options of an outgoing segment.
+ *
+ * @param[in]  tcb       TCB holding the connection information.
+ * @param[in]  ctl       Control bits of the segment.
+ * @param[out] opt_ptr   Option field to fill, NULL to calculate its size only.
+ *
+ * @returns   Size of the option field in bytes, a multiple of 4.
+ */
+uint8_t _option_build(const gnrc_tcp_tcb_t *tcb, uint16_t ctl, uint8_t *opt_ptr);
+
 /**
  * @brief Parses options of a given TCP header.
  *
- * @param[in,out] tcb   TCB holding the connection information.
- * @param[in]     hdr   TCP header to be parsed.
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[in]     hdr    TCP header to be parsed.
+ * @param[out]    opts   Values of further options found in @p hdr.
  *
  * @returns   Zero on success.
  *            Negative value on error.
  */
-int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
+int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr, option_values_t *opts);
+
+/**
+ * @brief Enables the options supported by the peer, on reception of a SYN.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[in]     opts   Options of the received SYN.
+ */
+void _option_negotiate(gnrc_tcp_tcb_t *tcb, const option_values_t *opts);
 
 #ifdef __cplusplus
 }
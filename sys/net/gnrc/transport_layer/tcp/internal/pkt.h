@@ -111,23 +111,28 @@ uint32_t _pkt_get_pay_len(gnrc_pktsnip_t *pkt);
  * @param[in,out] tcb          TCB holding the connection information.
  * @param[in]     pkt          Packet to add to the retransmission mechanism.
  * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit.
+ *                             It must be the oldest packet in the retransmission
+ *                             queue then.
  *
  * @returns   Zero on success.
  *            -ENOMEM if the retransmission queue is full.
- *            -EINVAL if pkt is null.
+ *            -EINVAL if pkt is null or not the oldest packet on retransmit.
  */
 int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool retransmit);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Acknowledges and removes all packets covered by @p ack from the
+ *        retransmission mechanism.
  *
- * @param[in,out] tcb   TCB holding the connection information.
- * @param[in]     ack   Acknowldegment number used to acknowledge packets.
+ * @param[in,out] tcb      TCB holding the connection information.
+ * @param[in]     ack      Acknowldegment number used to acknowledge packets.
+ * @param[in]     ts_ecr   Echoed timestamp of the acknowledgment, zero if
+ *                         there is none.
  *
  * @returns   Zero on success.
  *            -ENODATA if there is nothing to acknowledge.
  */
-int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
+int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack, const uint32_t ts_ecr);
 
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
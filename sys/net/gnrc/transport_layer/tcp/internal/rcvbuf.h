@@ -12,7 +12,7 @@
  * @{
  *
  * @file
- * @brief       Functions for allocating and freeing the receive buffer.
+ * @brief       Functions for allocating, filling and reading the receive buffer.
  *
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
@@ -20,6 +20,8 @@
 #ifndef RCVBUF_H
 #define RCVBUF_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "mutex.h"
 #include "net/gnrc/tcp/config.h"
@@ -30,43 +32,126 @@ extern "C" {
 #endif
 
 /**
- * @brief Receive buffer entry.
+ * @brief Receive buffer block.
  */
-typedef struct rcvbuf_entry {
-    uint8_t used;                          /**< Flag: Is buffer in use? */
-    uint8_t buffer[GNRC_TCP_RCV_BUF_SIZE]; /**< Receive buffer storage */
-} rcvbuf_entry_t;
+typedef struct gnrc_tcp_rcvbuf_block {
+    struct gnrc_tcp_rcvbuf_block *next;                  /**< Next block */
+    uint8_t data[CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE];    /**< Block storage */
+} rcvbuf_block_t;
 
 /**
- * @brief   Struct holding receive buffers.
+ * @brief Number of blocks in the receive buffer pool.
+ *
+ * Including the block headers, the pool is no larger than
+ * @ref CONFIG_GNRC_TCP_RCV_BUFFERS receive buffers of
+ * @ref GNRC_TCP_RCV_BUF_SIZE bytes.
+ */
+#define GNRC_TCP_RCV_BUF_BLOCKS ((CONFIG_GNRC_TCP_RCV_BUFFERS * GNRC_TCP_RCV_BUF_SIZE) / \
+                                 sizeof(rcvbuf_block_t))
+
+/**
+ * @brief Number of blocks needed for a segment of @ref CONFIG_GNRC_TCP_MSS bytes.
+ */
+#define GNRC_TCP_RCV_BUF_MSS_BLOCKS ((CONFIG_GNRC_TCP_MSS + CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE - 1) / \
+                                     CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE)
+
+/**
+ * @brief Number of blocks reserved in the pool for every open connection.
+ *
+ * One MSS, as long as the pool holds that much for
+ * @ref CONFIG_GNRC_TCP_RCV_BUFFERS connections. Beyond its reservation, a
+ * connection borrows blocks no other connection reserved.
+ */
+#define GNRC_TCP_RCV_BUF_RESERVED_BLOCKS \
+    ((GNRC_TCP_RCV_BUF_MSS_BLOCKS < GNRC_TCP_RCV_BUF_BLOCKS / CONFIG_GNRC_TCP_RCV_BUFFERS) ? \
+     GNRC_TCP_RCV_BUF_MSS_BLOCKS : GNRC_TCP_RCV_BUF_BLOCKS / CONFIG_GNRC_TCP_RCV_BUFFERS)
+
+/**
+ * @brief   Struct holding the receive buffer pool.
  */
 typedef struct rcvbuf {
-    mutex_t lock;                                 /**< Lock for allocation synchronization */
-    rcvbuf_entry_t entries[CONFIG_GNRC_TCP_RCV_BUFFERS]; /**< Maintained receive buffers */
+    mutex_t lock;                                   /**< Lock for allocation synchronization */
+    rcvbuf_block_t *free;                           /**< List of free blocks */
+    size_t free_numof;                              /**< Number of free blocks */
+    size_t reserved_numof;                          /**< Number of free blocks reserved for
+                                                         open connections */
+    rcvbuf_block_t blocks[GNRC_TCP_RCV_BUF_BLOCKS]; /**< Maintained blocks */
 } rcvbuf_t;
 
 /**
- * @brief   Initializes global receive buffer.
+ * @brief   Initializes global receive buffer pool.
  */
 void _rcvbuf_init(void);
 
 /**
- * @brief Allocate receive buffer and assign it to TCB.
+ * @brief Initialize the (empty) receive buffer of a TCB.
+ *
+ * Reserves @ref GNRC_TCP_RCV_BUF_RESERVED_BLOCKS in the receive buffer pool
+ * for @p tcb.
  *
  * @param[in,out] tcb   TCB that acquires receive buffer.
  *
  * @returns   Zero  on success.
- *            -ENOMEM if all receive buffers are currently used.
+ *            -ENOMEM if the pool has not enough unreserved free blocks.
  */
 int _rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
 
 /**
- * @brief Release allocated receive buffer.
+ * @brief Release all blocks and the reservation of the receive buffer of a TCB.
  *
  * @param[in,out] tcb   TCB holding the receive buffer that should be released.
  */
 void _rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Append data to the receive buffer of a TCB.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ * @param[in]     data  Data to append.
+ * @param[in]     len   Length of @p data.
+ *
+ * @returns   Number of appended bytes. Less than @p len if the receive buffer
+ *            or the receive buffer pool is full.
+ */
+size_t _rcvbuf_add(gnrc_tcp_tcb_t *tcb, const void *data, size_t len);
+
+/**
+ * @brief Read data from the receive buffer of a TCB.
+ *
+ * Blocks that were read completely are released.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ * @param[out]    buf   Buffer to read into.
+ * @param[in]     len   Maximum number of bytes to read.
+ *
+ * @returns   Number of bytes read.
+ */
+size_t _rcvbuf_get(gnrc_tcp_tcb_t *tcb, void *buf, size_t len);
+
+/**
+ * @brief Get the number of bytes that can still be appended to the receive
+ *        buffer of a TCB.
+ *
+ * @param[in] tcb   TCB holding the receive buffer.
+ *
+ * @returns   Free space of the receive buffer, limited by the blocks the
+ *            connection can still take from the receive buffer pool: its own
+ *            reservation and the free blocks no other connection reserved.
+ */
+uint32_t _rcvbuf_get_free(const gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Check if the receive buffer of a TCB is empty.
+ *
+ * @param[in] tcb   TCB holding the receive buffer.
+ *
+ * @returns   true if the receive buffer holds no data.
+ */
+static inline bool _rcvbuf_empty(const gnrc_tcp_tcb_t *tcb)
+{
+    return tcb->rcv_buf.len == 0;
+}
+
 #ifdef __cplusplus
 }
 #endif
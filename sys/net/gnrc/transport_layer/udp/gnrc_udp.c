@@ -48,6 +48,14 @@ static char _stack[GNRC_UDP_STACK_SIZE + THREAD_EXTRA_STACKSIZE_PRINTF];
 static char _stack[GNRC_UDP_STACK_SIZE];
 #endif
 
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+/**
+ * @brief   Received packets for the application, passed on before the thread
+ *          blocks
+ */
+static gnrc_netapi_batch_t _rcv_batch;
+#endif
+
 /**
  * @brief   Calculate the UDP checksum dependent on the network protocol
  *
@@ -69,7 +77,17 @@ static uint16_t _calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr,
 
     /* process the payload */
     while (payload && payload != hdr && payload != pseudo_hdr) {
-        csum = inet_csum_slice(csum, (uint8_t *)(payload->data), payload->size, len);
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+        if (payload->csum != 0) {
+            /* checksum was already calculated when the payload was copied */
+            csum = inet_csum_add(csum, payload->csum, len);
+        }
+        else
+#endif
+        {
+            csum = inet_csum_slice(csum, (uint8_t *)(payload->data),
+                                   payload->size, len);
+        }
         len += (uint16_t)payload->size;
         payload = payload->next;
     }
@@ -156,7 +174,12 @@ static void _receive(gnrc_pktsnip_t *pkt)
     port = (uint32_t)byteorder_ntohs(hdr->dst_port);
 
     /* send payload to receivers */
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    if (!gnrc_netapi_batch_dispatch_receive(&_rcv_batch, GNRC_NETTYPE_UDP,
+                                            port, pkt)) {
+#else
     if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_UDP, port, pkt)) {
+#endif
         DEBUG("udp: unable to forward packet as no one is interested in it\n");
         /* TODO determine if IPv6 packet, when IPv4 is implemented */
         gnrc_icmpv6_error_dst_unr_send(ICMPV6_ERROR_DST_UNR_PORT, pkt);
@@ -225,24 +248,42 @@ static void *_event_loop(void *arg)
     (void)arg;
     msg_t msg, reply;
     msg_t msg_queue[GNRC_UDP_MSG_QUEUE_SIZE];
-    gnrc_netreg_entry_t netreg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
-                                                            thread_getpid());
+    gnrc_netreg_entry_t netreg = GNRC_NETREG_ENTRY_INIT_BATCH(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                              thread_getpid());
     /* preset reply message */
     reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
     reply.content.value = (uint32_t)-ENOTSUP;
     /* initialize message queue */
     msg_init_queue(msg_queue, GNRC_UDP_MSG_QUEUE_SIZE);
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    gnrc_netapi_batch_init(&_rcv_batch);
+#endif
     /* register UPD at netreg */
     gnrc_netreg_register(GNRC_NETTYPE_UDP, &netreg);
 
     /* dispatch NETAPI messages */
     while (1) {
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+        if (msg_avail() <= 0) {
+            gnrc_netapi_batch_flush(&_rcv_batch);
+        }
+#endif
         msg_receive(&msg);
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
                 DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV\n");
                 _receive(msg.content.ptr);
                 break;
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV_BATCH\n");
+                for (unsigned i = 0; i < gnrc_netapi_batch_numof(msg.content.ptr);
+                     i++) {
+                    _receive(gnrc_netapi_batch_get(msg.content.ptr, i));
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+#endif
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
                 _send(msg.content.ptr);
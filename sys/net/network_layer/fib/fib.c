@@ -24,6 +24,7 @@
 #include <string.h>
 #include <inttypes.h>
 #include <errno.h>
+#include "kernel_defines.h"
 #include "thread.h"
 #include "mutex.h"
 #include "msg.h"
@@ -65,9 +66,279 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
     *target = xtimer_now_usec64() + (ms * US_PER_MS);
 }
 
+/**
+ * @brief returns the absolute lifetime of the entry or source route an
+ *        expiry heap node belongs to
+ */
+static uint64_t fib_expiry_lifetime(fib_table_t *table, fib_expiry_t *node)
+{
+    if (table->table_type == FIB_TABLE_TYPE_SR) {
+        return container_of(node, fib_sr_t, expiry)->sr_lifetime;
+    }
+    return container_of(node, fib_entry_t, expiry)->lifetime;
+}
+
+/**
+ * @brief returns the element at array position @p pos of the expiry heap
+ */
+static fib_expiry_t **fib_expiry_slot(fib_table_t *table, size_t pos)
+{
+    if (table->table_type == FIB_TABLE_TYPE_SR) {
+        return &table->data.source_routes->headers[pos].expiry.heap;
+    }
+    return &table->data.entries[pos].expiry.heap;
+}
+
+/**
+ * @brief puts @p node at array position @p pos of the expiry heap
+ */
+static void fib_expiry_set(fib_table_t *table, size_t pos, fib_expiry_t *node)
+{
+    *fib_expiry_slot(table, pos) = node;
+    node->heap_pos = pos + 1;
+}
+
+/**
+ * @brief moves the node at array position @p pos of the expiry heap up or
+ *        down until its parent expires earlier and its children later
+ */
+static void fib_expiry_sift(fib_table_t *table, size_t pos)
+{
+    fib_expiry_t *node = *fib_expiry_slot(table, pos);
+    uint64_t lifetime = fib_expiry_lifetime(table, node);
+
+    while (pos > 0) {
+        size_t parent = (pos - 1) / 2;
+        fib_expiry_t *tmp = *fib_expiry_slot(table, parent);
+
+        if (fib_expiry_lifetime(table, tmp) <= lifetime) {
+            break;
+        }
+        fib_expiry_set(table, pos, tmp);
+        pos = parent;
+    }
+    while ((2 * pos + 1) < table->expiry_numof) {
+        size_t child = 2 * pos + 1;
+        fib_expiry_t *tmp = *fib_expiry_slot(table, child);
+
+        if ((child + 1) < table->expiry_numof) {
+            fib_expiry_t *right = *fib_expiry_slot(table, child + 1);
+
+            if (fib_expiry_lifetime(table, right) < fib_expiry_lifetime(table, tmp)) {
+                child++;
+                tmp = right;
+            }
+        }
+        if (fib_expiry_lifetime(table, tmp) >= lifetime) {
+            break;
+        }
+        fib_expiry_set(table, pos, tmp);
+        pos = child;
+    }
+    fib_expiry_set(table, pos, node);
+}
+
+/**
+ * @brief removes an entry or source route from the expiry heap
+ * @param[in] table     the FIB table
+ * @param[in] node      the expiry heap node of the entry, nothing happens if
+ *                      it is not in the heap
+ */
+static void fib_expiry_remove(fib_table_t *table, fib_expiry_t *node)
+{
+    size_t pos = node->heap_pos;
+
+    if (pos == 0) {
+        return;
+    }
+    node->heap_pos = 0;
+    table->expiry_numof--;
+    if ((pos - 1) < table->expiry_numof) {
+        /* fill the gap with the last element */
+        fib_expiry_set(table, pos - 1,
+                       *fib_expiry_slot(table, table->expiry_numof));
+        fib_expiry_sift(table, pos - 1);
+    }
+}
+
+/**
+ * @brief adds, moves or removes an entry or source route in the expiry heap
+ *        after its lifetime was set
+ * @param[in] table     the FIB table
+ * @param[in] node      the expiry heap node of the entry
+ */
+static void fib_expiry_update(fib_table_t *table, fib_expiry_t *node)
+{
+    uint64_t lifetime = fib_expiry_lifetime(table, node);
+
+    if ((lifetime == 0) || (lifetime == FIB_LIFETIME_NO_EXPIRE)) {
+        fib_expiry_remove(table, node);
+        return;
+    }
+    if (node->heap_pos == 0) {
+        fib_expiry_set(table, table->expiry_numof++, node);
+    }
+    fib_expiry_sift(table, node->heap_pos - 1);
+}
+
+/**
+ * @brief returns the entry or source route that expires next, iff it has
+ *        expired at @p now
+ */
+static fib_expiry_t *fib_expiry_get_expired(fib_table_t *table, uint64_t now)
+{
+    fib_expiry_t *node;
+
+    if (table->expiry_numof == 0) {
+        return NULL;
+    }
+    node = *fib_expiry_slot(table, 0);
+    return (fib_expiry_lifetime(table, node) < now) ? node : NULL;
+}
+
+/**
+ * @brief checks if the first @p len bits of @p a and @p b are equal
+ */
+static bool fib_prefix_equal(const uint8_t *a, const uint8_t *b, size_t len)
+{
+    size_t bytes = len >> 3;
+    uint8_t mask = (uint8_t)(0xff00 >> (len & 0x7));
+
+    return (memcmp(a, b, bytes) == 0) &&
+           (((len & 0x7) == 0) || (((a[bytes] ^ b[bytes]) & mask) == 0));
+}
+
+/**
+ * @brief hashes the first @p len bits of an address into a bucket of @p table
+ *        (FNV-1a)
+ */
+static size_t fib_prefix_hash(fib_table_t *table, const uint8_t *addr,
+                              size_t addr_size, size_t len)
+{
+    size_t bytes = len >> 3;
+    uint32_t hash = 2166136261U ^ (uint32_t)((addr_size << 8) | len);
+
+    for (size_t i = 0; i < bytes; i++) {
+        hash = (hash ^ addr[i]) * 16777619U;
+    }
+    if (len & 0x7) {
+        hash = (hash ^ (addr[bytes] & (uint8_t)(0xff00 >> (len & 0x7)))) * 16777619U;
+    }
+    return hash % table->size;
+}
+
+/**
+ * @brief returns the prefix length an entry is indexed with, i.e.
+ *        0 for the default route, the length given by the prefix flags for
+ *        network prefixes and the full address length for host entries
+ */
+static size_t fib_entry_prefix_len(const fib_entry_t *entry)
+{
+    size_t addr_bits = entry->global->address_size << 3;
+    size_t len = (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK)
+                 >> FIB_FLAG_NET_PREFIX_SHIFT;
+
+    for (size_t i = 0; i < entry->global->address_size; i++) {
+        if (entry->global->address[i] != 0) {
+            return ((len == 0) || (len > addr_bits)) ? addr_bits : len;
+        }
+    }
+    /* the address is all 0, i.e. the default route, e.g. ::/0 for IPv6 */
+    return 0;
+}
+
+/**
+ * @brief adds an entry to the prefix hash index
+ *
+ * @param[in] table     the FIB table
+ * @param[in] entry     the entry with fib_entry_t::global set
+ */
+static void fib_index_add(fib_table_t *table, fib_entry_t *entry)
+{
+    size_t len = fib_entry_prefix_len(entry);
+    size_t idx = fib_prefix_hash(table, entry->global->address,
+                                 entry->global->address_size, len);
+    fib_entry_t **ptr = &table->data.entries[idx].bucket;
+
+    /* keep buckets in table order, so the first entry in the table wins on
+     * duplicates */
+    while ((*ptr != NULL) && (*ptr < entry)) {
+        ptr = &(*ptr)->hash_next;
+    }
+    entry->hash_next = *ptr;
+    *ptr = entry;
+    bf_set(table->prefix_lens, len);
+}
+
+/**
+ * @brief removes an entry from the prefix hash index
+ *
+ * @note  fib_table_t::prefix_lens is not updated, a stale prefix length only
+ *        costs an additional probe until fib_index_update_prefix_lens() is
+ *        called after fib_table_t::size removals
+ *
+ * @param[in] table     the FIB table
+ * @param[in] entry     the entry with fib_entry_t::global set
+ */
+static void fib_index_remove(fib_table_t *table, fib_entry_t *entry)
+{
+    size_t idx = fib_prefix_hash(table, entry->global->address,
+                                 entry->global->address_size,
+                                 fib_entry_prefix_len(entry));
+
+    for (fib_entry_t **ptr = &table->data.entries[idx].bucket; *ptr != NULL;
+         ptr = &(*ptr)->hash_next) {
+        if (*ptr == entry) {
+            *ptr = entry->hash_next;
+            break;
+        }
+    }
+    entry->hash_next = NULL;
+    table->prefix_lens_stale++;
+}
+
+/**
+ * @brief recalculates the prefix lengths in use by the table
+ */
+static void fib_index_update_prefix_lens(fib_table_t *table)
+{
+    memset(table->prefix_lens, 0, sizeof(table->prefix_lens));
+    table->prefix_lens_stale = 0;
+    for (size_t i = 0; i < table->size; ++i) {
+        if ((table->data.entries[i].lifetime != 0) &&
+            (table->data.entries[i].global != NULL)) {
+            bf_set(table->prefix_lens,
+                   fib_entry_prefix_len(&table->data.entries[i]));
+        }
+    }
+}
+
+static int fib_remove(fib_table_t *table, fib_entry_t *entry);
+
+/**
+ * @brief removes all expired entries, taking them from the expiry heap in
+ *        the order they expire
+ *
+ * @param[in] table     the FIB table
+ */
+static void fib_purge_expired(fib_table_t *table)
+{
+    uint64_t now = xtimer_now_usec64();
+    fib_expiry_t *node;
+
+    while ((node = fib_expiry_get_expired(table, now)) != NULL) {
+        fib_remove(table, container_of(node, fib_entry_t, expiry));
+    }
+}
+
 /**
  * @brief returns pointer to the entry for the given destination address
  *
+ * The entries are looked up in the prefix hash index from the longest to the
+ * shortest prefix length in use, so the cost only depends on the number of
+ * distinct prefix lengths in the table. Expired entries are purged
+ * beforehand.
+ *
  * @param[in] table                the FIB table to search in
  * @param[in] dst                  the destination address
  * @param[in] dst_size             the destination address size
@@ -81,13 +352,8 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
  */
 static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
                           fib_entry_t **entry_arr, size_t *entry_arr_size) {
-    uint64_t now = xtimer_now_usec64();
-
-    size_t count = 0;
-    size_t prefix_size = 0;
-    size_t match_size = dst_size << 3;
+    size_t dst_bits = dst_size << 3;
     int ret = -EHOSTUNREACH;
-    bool is_all_zeros_addr = true;
 
 #if ENABLE_DEBUG
     DEBUG("[fib_find_entry] dst =");
@@ -97,86 +363,44 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
     DEBUG("\n");
 #endif
 
-    for (size_t i = 0; i < dst_size; ++i) {
-        if (dst[i] != 0) {
-            is_all_zeros_addr = false;
-            break;
-        }
-    }
-
-    for (size_t i = 0; i < table->size; ++i) {
+    fib_purge_expired(table);
 
-        /* autoinvalidate if the entry lifetime is not set to not expire */
-        if (table->data.entries[i].lifetime != FIB_LIFETIME_NO_EXPIRE) {
-
-            /* check if the lifetime expired */
-            if (table->data.entries[i].lifetime < now) {
-                /* remove this entry if its lifetime expired */
-                table->data.entries[i].lifetime = 0;
-                table->data.entries[i].global_flags = 0;
-                table->data.entries[i].next_hop_flags = 0;
-                table->data.entries[i].iface_id = KERNEL_PID_UNDEF;
-
-                if (table->data.entries[i].global != NULL) {
-                    universal_address_rem(table->data.entries[i].global);
-                    table->data.entries[i].global = NULL;
-                }
+    if (dst_bits >= FIB_PREFIX_LEN_NUMOF) {
+        /* cannot be stored in a universal address, so there is no entry */
+        *entry_arr_size = 0;
+        return ret;
+    }
 
-                if (table->data.entries[i].next_hop != NULL) {
-                    universal_address_rem(table->data.entries[i].next_hop);
-                    table->data.entries[i].next_hop = NULL;
-                }
-            }
+    for (size_t len = dst_bits + 1; len-- > 0;) {
+        if (!bf_isset(table->prefix_lens, len)) {
+            continue;
         }
 
-        if ((prefix_size < (dst_size<<3)) && (table->data.entries[i].global != NULL)) {
+        size_t idx = fib_prefix_hash(table, dst, dst_size, len);
 
-            int ret_comp = universal_address_compare(table->data.entries[i].global, dst, &match_size);
-            /* If we found an exact match */
-            if ((ret_comp == UNIVERSAL_ADDRESS_EQUAL)
-                || (is_all_zeros_addr && (ret_comp == UNIVERSAL_ADDRESS_IS_ALL_ZERO_ADDRESS))) {
-                entry_arr[0] = &(table->data.entries[i]);
+        for (fib_entry_t *entry = table->data.entries[idx].bucket;
+             entry != NULL; entry = entry->hash_next) {
+            if ((entry->global->address_size != dst_size) ||
+                (fib_entry_prefix_len(entry) != len) ||
+                !fib_prefix_equal(entry->global->address, dst, len)) {
+                continue;
+            }
+            if (memcmp(entry->global->address, dst, dst_size) == 0) {
+                /* we found an exact match, we will not find a better one */
+                entry_arr[0] = entry;
                 *entry_arr_size = 1;
-                /* we will not find a better one so we return */
                 return 1;
             }
-            else {
-                /* we try to find the most fitting prefix */
-                if (ret_comp == UNIVERSAL_ADDRESS_MATCHING_PREFIX) {
-                    if (table->data.entries[i].global_flags & FIB_FLAG_NET_PREFIX_MASK) {
-                        /* we shift the most upper flag byte back to get the number of prefix bits */
-                        size_t global_prefix_len = (table->data.entries[i].global_flags
-                                                    & FIB_FLAG_NET_PREFIX_MASK) >> FIB_FLAG_NET_PREFIX_SHIFT;
-
-                        if ((match_size >= global_prefix_len) &&
-                            ((prefix_size == 0) || (match_size > prefix_size))) {
-                            entry_arr[0] = &(table->data.entries[i]);
-                            /* we could find a better one so we move on */
-                            ret = 0;
-
-                            prefix_size = match_size;
-                            count = 1;
-                        }
-                    }
-                 }
-                 else if (ret_comp == UNIVERSAL_ADDRESS_IS_ALL_ZERO_ADDRESS) {
-                    /* we found the default gateway entry, e.g. ::/0 for IPv6
-                     * and we keep it only if there is no better one
-                     */
-                    if (prefix_size == 0) {
-                        entry_arr[0] = &(table->data.entries[i]);
-                        /* we could find a better one so we move on */
-                        ret = 0;
-                        count = 1;
-                    }
-                }
-                match_size = dst_size<<3;
+            if (ret != 0) {
+                /* the longest prefix, but an exact match still has precedence */
+                entry_arr[0] = entry;
+                ret = 0;
             }
         }
     }
 
 #if ENABLE_DEBUG
-    if (count > 0) {
+    if (ret == 0) {
         DEBUG("[fib_find_entry] found prefix on interface %d:", entry_arr[0]->iface_id);
         for (size_t i = 0; i < entry_arr[0]->global->address_size; i++) {
             DEBUG(" %02x", entry_arr[0]->global->address[i]);
@@ -185,13 +409,14 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
     }
 #endif
 
-    *entry_arr_size = count;
+    *entry_arr_size = (ret == 0) ? 1 : 0;
     return ret;
 }
 
 /**
  * @brief updates the next hop the lifetime and the interface id for a given entry
  *
+ * @param[in] table          the FIB table the entry is in
  * @param[in] entry          the entry to be updated
  * @param[in] next_hop       the next hop address to be updated
  * @param[in] next_hop_size  the next hop address size
@@ -201,9 +426,9 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
  * @return 0 if the entry has been updated
  *         -ENOMEM if the entry cannot be updated due to insufficient RAM
  */
-static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
-                         size_t next_hop_size, uint32_t next_hop_flags,
-                         uint32_t lifetime)
+static int fib_upd_entry(fib_table_t *table, fib_entry_t *entry,
+                         uint8_t *next_hop, size_t next_hop_size,
+                         uint32_t next_hop_flags, uint32_t lifetime)
 {
     universal_address_container_t *container = universal_address_add(next_hop, next_hop_size);
 
@@ -221,6 +446,7 @@ static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
     else {
         entry->lifetime = FIB_LIFETIME_NO_EXPIRE;
     }
+    fib_expiry_update(table, &entry->expiry);
 
     return 0;
 }
@@ -267,9 +493,18 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                 else {
                     table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
                 }
+                fib_expiry_update(table, &table->data.entries[i].expiry);
+                fib_index_add(table, &table->data.entries[i]);
 
                 return 0;
             }
+
+            /* do not leave a half-initialized entry behind */
+            universal_address_rem(table->data.entries[i].global);
+            table->data.entries[i].global = NULL;
+            table->data.entries[i].global_flags = 0;
+            table->data.entries[i].next_hop_flags = 0;
+            return -ENOMEM;
         }
     }
 
@@ -279,15 +514,20 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
 /**
  * @brief removes the given entry
  *
+ * @param[in] table the FIB table the entry is in
  * @param[in] entry the entry to be removed
  *
  * @return 0 on success
  */
-static int fib_remove(fib_entry_t *entry)
+static int fib_remove(fib_table_t *table, fib_entry_t *entry)
 {
     if (entry->global != NULL) {
+        if (entry->lifetime != 0) {
+            fib_index_remove(table, entry);
+        }
         universal_address_rem(entry->global);
     }
+    fib_expiry_remove(table, &entry->expiry);
 
     if (entry->next_hop) {
         universal_address_rem(entry->next_hop);
@@ -301,6 +541,11 @@ static int fib_remove(fib_entry_t *entry)
     entry->iface_id = KERNEL_PID_UNDEF;
     entry->lifetime = 0;
 
+    if (table->prefix_lens_stale >= table->size) {
+        /* amortized over the removals since the last update */
+        fib_index_update_prefix_lens(table);
+    }
+
     return 0;
 }
 
@@ -403,7 +648,8 @@ int fib_add_entry(fib_table_t *table,
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size,
+                            next_hop_flags, lifetime);
     }
     else {
         ret = fib_create_entry(table, iface_id, dst, dst_size, dst_flags,
@@ -433,7 +679,8 @@ int fib_update_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
     if (fib_find_entry(table, dst, dst_size, &(entry[0]), &count) == 1) {
         DEBUG("[fib_update_entry] found entry: %p\n", (void *)(entry[0]));
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size,
+                            next_hop_flags, lifetime);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -457,7 +704,7 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        fib_remove(entry[0]);
+        fib_remove(table, entry[0]);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -477,9 +724,10 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
     for (size_t i = 0; i < table->size; ++i) {
         if ((interface == KERNEL_PID_UNDEF) ||
             (interface == table->data.entries[i].iface_id)) {
-            fib_remove(&table->data.entries[i]);
+            fib_remove(table, &table->data.entries[i]);
         }
     }
+    fib_index_update_prefix_lens(table);
 
     mutex_unlock(&(table->mtx_access));
 }
@@ -587,6 +835,9 @@ void fib_init(fib_table_t *table)
     }
 
     table->notify_rp_pos = 0;
+    table->expiry_numof = 0;
+    memset(table->prefix_lens, 0, sizeof(table->prefix_lens));
+    table->prefix_lens_stale = 0;
 
     if (table->table_type == FIB_TABLE_TYPE_SR) {
         memset(table->data.source_routes->headers, 0,
@@ -612,6 +863,9 @@ void fib_deinit(fib_table_t *table)
     }
 
     table->notify_rp_pos = 0;
+    table->expiry_numof = 0;
+    memset(table->prefix_lens, 0, sizeof(table->prefix_lens));
+    table->prefix_lens_stale = 0;
 
     if (table->table_type == FIB_TABLE_TYPE_SR) {
         memset(table->data.source_routes->headers, 0,
@@ -688,6 +942,7 @@ int fib_sr_create(fib_table_t *table, fib_sr_t **fib_sr, kernel_pid_t sr_iface_i
             else {
                 table->data.source_routes->headers[i].sr_lifetime = FIB_LIFETIME_NO_EXPIRE;
             }
+            fib_expiry_update(table, &table->data.source_routes->headers[i].expiry);
             *fib_sr = &table->data.source_routes->headers[i];
             mutex_unlock(&(table->mtx_access));
             return 0;
@@ -698,25 +953,92 @@ int fib_sr_create(fib_table_t *table, fib_sr_t **fib_sr, kernel_pid_t sr_iface_i
     return -ENOBUFS;
 }
 
+/**
+* @brief Internal function:
+*        returns the bucket of the destination hash index for the source
+*        route, NULL if the source route is not in the index
+*/
+static fib_sr_t **fib_sr_index_bucket(fib_table_t *table, fib_sr_t *fib_sr)
+{
+    universal_address_container_t *dest;
+
+    if ((fib_sr->sr_lifetime == 0) || (fib_sr->sr_dest == NULL)
+        || (fib_sr->sr_dest->address == NULL)) {
+        return NULL;
+    }
+    dest = fib_sr->sr_dest->address;
+    return &table->data.source_routes->headers[
+        fib_prefix_hash(table, dest->address, dest->address_size,
+                        dest->address_size << 3)].bucket;
+}
+
+/**
+* @brief Internal function:
+*        adds a source route to the destination hash index,
+*        must be called after its destination changed
+*/
+static void fib_sr_index_add(fib_table_t *table, fib_sr_t *fib_sr)
+{
+    fib_sr_t **ptr = fib_sr_index_bucket(table, fib_sr);
+
+    if (ptr == NULL) {
+        return;
+    }
+    /* keep buckets in table order */
+    while ((*ptr != NULL) && (*ptr < fib_sr)) {
+        ptr = &(*ptr)->hash_next;
+    }
+    fib_sr->hash_next = *ptr;
+    *ptr = fib_sr;
+}
+
+/**
+* @brief Internal function:
+*        removes a source route from the destination hash index,
+*        must be called before its destination changes
+*/
+static void fib_sr_index_remove(fib_table_t *table, fib_sr_t *fib_sr)
+{
+    fib_sr_t **ptr = fib_sr_index_bucket(table, fib_sr);
+
+    if (ptr == NULL) {
+        return;
+    }
+    for (; *ptr != NULL; ptr = &(*ptr)->hash_next) {
+        if (*ptr == fib_sr) {
+            *ptr = fib_sr->hash_next;
+            break;
+        }
+    }
+    fib_sr->hash_next = NULL;
+}
+
 /**
 * @brief Internal function:
 *        checks the lifetime and removes the entry in case it expired
 */
-static int fib_sr_check_lifetime(fib_sr_t *fib_sr)
+static int fib_sr_check_lifetime(fib_table_t *table, fib_sr_t *fib_sr)
 {
     uint64_t tm = fib_sr->sr_lifetime - xtimer_now_usec64();
     /* check if the lifetime expired */
     if ((int64_t)tm < 0) {
         /* remove this sr if its lifetime expired */
+        fib_sr_index_remove(table, fib_sr);
+        fib_expiry_remove(table, &fib_sr->expiry);
         fib_sr->sr_lifetime = 0;
 
         if (fib_sr->sr_path != NULL) {
-            fib_sr_entry_t *elt = NULL;
-            LL_FOREACH(fib_sr->sr_path, elt) {
+            fib_sr_entry_t *elt = NULL, *tmp = NULL;
+            LL_FOREACH_SAFE(fib_sr->sr_path, elt, tmp) {
                 universal_address_rem(elt->address);
+                elt->address = NULL;
+                LL_DELETE(fib_sr->sr_path, elt);
             }
             fib_sr->sr_path = NULL;
         }
+        /* the destination was one of the released path entries, it may be
+         * reused by another source route */
+        fib_sr->sr_dest = NULL;
 
         /* and return an errorcode */
         return -ENOENT;
@@ -753,12 +1075,29 @@ static int fib_sr_new_entry(fib_table_t *table, uint8_t *addr, size_t addr_size,
 */
 static int fib_is_sr_in_table(fib_table_t *table, fib_sr_t *fib_sr)
 {
-    for (size_t i = 0; i < table->size; ++i) {
-        if (&(table->data.source_routes->headers[i]) == fib_sr) {
-            return 0;
-        }
+    uintptr_t start = (uintptr_t)table->data.source_routes->headers;
+    uintptr_t pos = (uintptr_t)fib_sr;
+
+    if ((pos < start) || (pos >= (uintptr_t)(table->data.source_routes->headers + table->size))
+        || (((pos - start) % sizeof(fib_sr_t)) != 0)) {
+        return -ENOENT;
+    }
+    return 0;
+}
+
+/**
+* @brief Internal function:
+*        removes the expired source routes, taking them from the expiry heap
+*        in the order they expire
+*/
+static void fib_sr_purge_expired(fib_table_t *table)
+{
+    uint64_t now = xtimer_now_usec64();
+    fib_expiry_t *node;
+
+    while ((node = fib_expiry_get_expired(table, now)) != NULL) {
+        fib_sr_check_lifetime(table, container_of(node, fib_sr_t, expiry));
     }
-    return -ENOENT;
 }
 
 int fib_sr_read_head(fib_table_t *table, fib_sr_t *fib_sr, kernel_pid_t *iface_id,
@@ -771,7 +1110,7 @@ int fib_sr_read_head(fib_table_t *table, fib_sr_t *fib_sr, kernel_pid_t *iface_i
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -794,7 +1133,7 @@ int fib_sr_read_destination(fib_table_t *table, fib_sr_t *fib_sr,
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -822,7 +1161,7 @@ int fib_sr_set(fib_table_t *table, fib_sr_t *fib_sr, kernel_pid_t *sr_iface_id,
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -837,6 +1176,7 @@ int fib_sr_set(fib_table_t *table, fib_sr_t *fib_sr, kernel_pid_t *sr_iface_id,
 
     if (sr_lifetime != NULL) {
         fib_lifetime_to_absolute(*sr_lifetime, &(fib_sr->sr_lifetime));
+        fib_expiry_update(table, &fib_sr->expiry);
     }
 
     mutex_unlock(&(table->mtx_access));
@@ -851,6 +1191,8 @@ int fib_sr_delete(fib_table_t *table, fib_sr_t *fib_sr)
         return -EFAULT;
     }
 
+    fib_sr_index_remove(table, fib_sr);
+    fib_expiry_remove(table, &fib_sr->expiry);
     fib_sr->sr_lifetime = 0;
 
     if (fib_sr->sr_path != NULL) {
@@ -862,6 +1204,7 @@ int fib_sr_delete(fib_table_t *table, fib_sr_t *fib_sr)
         }
         fib_sr->sr_path = NULL;
     }
+    fib_sr->sr_dest = NULL;
 
     mutex_unlock(&(table->mtx_access));
     return 0;
@@ -881,7 +1224,7 @@ int fib_sr_next(fib_table_t *table, fib_sr_t *fib_sr, fib_sr_entry_t **sr_path_e
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -915,7 +1258,7 @@ int fib_sr_search(fib_table_t *table, fib_sr_t *fib_sr, uint8_t *addr, size_t ad
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -948,7 +1291,7 @@ int fib_sr_entry_append(fib_table_t *table, fib_sr_t *fib_sr,
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -967,6 +1310,8 @@ int fib_sr_entry_append(fib_table_t *table, fib_sr_t *fib_sr,
 
     if (ret == 0) {
         fib_sr_entry_t *tmp = fib_sr->sr_dest;
+        /* the destination changes */
+        fib_sr_index_remove(table, fib_sr);
         if (tmp != NULL) {
             /* we append the new entry behind the former destination */
             tmp->next = new_entry[0];
@@ -976,6 +1321,7 @@ int fib_sr_entry_append(fib_table_t *table, fib_sr_t *fib_sr,
             fib_sr->sr_path = new_entry[0];
         }
         fib_sr->sr_dest = new_entry[0];
+        fib_sr_index_add(table, fib_sr);
     }
 
     mutex_unlock(&(table->mtx_access));
@@ -993,7 +1339,7 @@ int fib_sr_entry_add(fib_table_t *table, fib_sr_t *fib_sr,
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -1017,6 +1363,8 @@ int fib_sr_entry_add(fib_table_t *table, fib_sr_t *fib_sr,
         fib_sr_entry_t *new_entry[1];
         ret = fib_sr_new_entry(table, addr, addr_size, &new_entry[0]);
         if (ret == 0) {
+            /* the destination might change */
+            fib_sr_index_remove(table, fib_sr);
             fib_sr_entry_t *remaining = sr_path_entry->next;
             sr_path_entry->next = new_entry[0];
             if (keep_remaining_route) {
@@ -1032,6 +1380,7 @@ int fib_sr_entry_add(fib_table_t *table, fib_sr_t *fib_sr,
                 new_entry[0]->next = NULL;
                 fib_sr->sr_dest = new_entry[0];
             }
+            fib_sr_index_add(table, fib_sr);
         }
     }
 
@@ -1048,7 +1397,7 @@ int fib_sr_entry_delete(fib_table_t *table, fib_sr_t *fib_sr, uint8_t *addr, siz
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -1059,7 +1408,10 @@ int fib_sr_entry_delete(fib_table_t *table, fib_sr_t *fib_sr, uint8_t *addr, siz
         size_t addr_size_match = addr_size << 3;
 
         if (universal_address_compare(elt->address, addr, &addr_size_match) == UNIVERSAL_ADDRESS_EQUAL) {
+            /* the destination might change */
+            fib_sr_index_remove(table, fib_sr);
             universal_address_rem(elt->address);
+            elt->address = NULL;
             if (keep_remaining_route) {
                 tmp->next = elt->next;
             }
@@ -1079,6 +1431,7 @@ int fib_sr_entry_delete(fib_table_t *table, fib_sr_t *fib_sr, uint8_t *addr, siz
                 /* if we remove the last entry we must adjust the destination */
                 fib_sr->sr_dest = tmp;
             }
+            fib_sr_index_add(table, fib_sr);
             mutex_unlock(&(table->mtx_access));
             return 0;
         }
@@ -1099,7 +1452,7 @@ int fib_sr_entry_overwrite(fib_table_t *table, fib_sr_t *fib_sr,
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -1120,6 +1473,8 @@ int fib_sr_entry_overwrite(fib_table_t *table, fib_sr_t *fib_sr,
     }
 
     if (elt_repl != NULL) {
+        /* the destination might change */
+        fib_sr_index_remove(table, fib_sr);
         universal_address_rem(elt_repl->address);
         universal_address_container_t *add = universal_address_add(addr_new, addr_new_size);
 
@@ -1129,10 +1484,12 @@ int fib_sr_entry_overwrite(fib_table_t *table, fib_sr_t *fib_sr,
              * so we add back the old entry, i.e. increasing the usecount
              */
             universal_address_add(addr_old, addr_old_size);
+            fib_sr_index_add(table, fib_sr);
             mutex_unlock(&(table->mtx_access));
             return -ENOMEM;
         }
         elt_repl->address = add;
+        fib_sr_index_add(table, fib_sr);
     }
 
     mutex_unlock(&(table->mtx_access));
@@ -1148,7 +1505,7 @@ int fib_sr_entry_get_address(fib_table_t *table, fib_sr_t *fib_sr, fib_sr_entry_
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -1219,6 +1576,8 @@ fib_sr_t* hit = NULL;
                                 new_sr->sr_flags = table->data.source_routes->headers[i].sr_flags;
                                 new_sr->sr_lifetime = table->data.source_routes->headers[i].sr_lifetime;
                                 new_sr->sr_path = NULL;
+                                new_sr->sr_dest = NULL;
+                                fib_expiry_update(table, &new_sr->expiry);
 
                                 /* and the path until the searched destination */
                                 fib_sr_entry_t *elt_iter = NULL, *elt_add = NULL;
@@ -1248,6 +1607,7 @@ fib_sr_t* hit = NULL;
                                     if (elt_iter == elt) {
                                         /* we copied until the destination */
                                         new_sr->sr_dest = new_entry;
+                                        fib_sr_index_add(table, new_sr);
                                         hit = new_sr;
 
                                         /* tell the RPs that a new sr has been created
@@ -1300,43 +1660,37 @@ int fib_sr_get_route(fib_table_t *table, uint8_t *dst, size_t dst_size, kernel_p
     int check_free_entry = -1;
 
     bool skip = (fib_sr != NULL) && (*fib_sr != NULL)?true:false;
-    /* Case 1 - check if we know a direct route */
-    for (size_t i = 0; i < table->size; ++i) {
+    fib_sr_t *headers = table->data.source_routes->headers;
 
-        if (fib_sr_check_lifetime(&table->data.source_routes->headers[i]) == -ENOENT) {
-            /* expired, so skip this sr and remember its position */
-            if (check_free_entry == -1) {
-                /* we want to fill up the source routes from the beginning */
-                check_free_entry = i;
-            }
-            continue;
-        }
+    fib_sr_purge_expired(table);
 
-        if( skip ) {
-            if(*fib_sr == &table->data.source_routes->headers[i]) {
-                skip = false;
+    /* Case 1 - check if we know a direct route
+     * the destination hash index yields all source routes to dst in table
+     * order, a consecutive search continues behind the previous hit */
+    if (!skip || ((fib_is_sr_in_table(table, *fib_sr) == 0) &&
+                  (fib_sr_check_lifetime(table, *fib_sr) == 0))) {
+        size_t idx = fib_prefix_hash(table, dst, dst_size, dst_size << 3);
+
+        for (fib_sr_t *sr = headers[idx].bucket; sr != NULL; sr = sr->hash_next) {
+            if ((skip && (sr <= *fib_sr)) || (fib_sr_check_lifetime(table, sr) == -ENOENT)) {
+                continue;
             }
-            /* we skip all entries upon the consecutive one to start search */
-            continue;
-        }
 
-        size_t addr_size_match = dst_size << 3;
-        if (universal_address_compare(table->data.source_routes->headers[i].sr_dest->address,
-                                      dst, &addr_size_match) == UNIVERSAL_ADDRESS_EQUAL) {
-            if (*sr_flags == table->data.source_routes->headers[i].sr_flags) {
-                /* found a perfect matching sr, no need to search further */
-                hit = &table->data.source_routes->headers[i];
-                tmp_hit = NULL;
-                if (check_free_entry == -1) {
-                    check_free_entry = i;
+            size_t addr_size_match = dst_size << 3;
+            if (universal_address_compare(sr->sr_dest->address,
+                                          dst, &addr_size_match) == UNIVERSAL_ADDRESS_EQUAL) {
+                if (*sr_flags == sr->sr_flags) {
+                    /* found a perfect matching sr, no need to search further */
+                    hit = sr;
+                    tmp_hit = NULL;
+                    break;
+                }
+                else {
+                    /* found a sr to the destination but with different flags,
+                     * maybe we find a better one.
+                     */
+                    tmp_hit = sr;
                 }
-                break;
-            }
-            else {
-                /* found a sr to the destination but with different flags,
-                 * maybe we find a better one.
-                 */
-                tmp_hit = &table->data.source_routes->headers[i];
             }
         }
     }
@@ -1352,6 +1706,14 @@ int fib_sr_get_route(fib_table_t *table, uint8_t *dst, size_t dst_size, kernel_p
     */
     if (hit == NULL) {
         int error = 0;
+
+        /* we want to fill up the source routes from the beginning */
+        for (size_t i = 0; i < table->size; ++i) {
+            if (fib_sr_check_lifetime(table, &headers[i]) == -ENOENT) {
+                check_free_entry = i;
+                break;
+            }
+        }
         hit = _fib_create_sr_from_partial(table, dst, dst_size, check_free_entry, &error);
         if ((error != 0) && (error != -EHOSTUNREACH)) {
             /* something went wrong, so we clean up our mess
@@ -1362,6 +1724,8 @@ int fib_sr_get_route(fib_table_t *table, uint8_t *dst, size_t dst_size, kernel_p
              * That's why I let it pass for now.
              */
             if (hit != NULL) {
+                fib_sr_index_remove(table, hit);
+                fib_expiry_remove(table, &hit->expiry);
                 hit->sr_lifetime = 0;
 
                 if (hit->sr_path != NULL) {
@@ -1625,8 +1989,9 @@ int fib_devel_get_lifetime(fib_table_t *table, uint64_t *lifetime, uint8_t *dst,
         size_t addr_size_match = dst_size << 3;
         /* first hit wins here */
         for (size_t i = 0; i < table->size; ++i) {
-            if (universal_address_compare(table->data.source_routes->headers[i].sr_dest->address,
-                                        dst, &addr_size_match) == UNIVERSAL_ADDRESS_EQUAL) {
+            if ((table->data.source_routes->headers[i].sr_dest != NULL) &&
+                (universal_address_compare(table->data.source_routes->headers[i].sr_dest->address,
+                                           dst, &addr_size_match) == UNIVERSAL_ADDRESS_EQUAL)) {
                 *lifetime = table->data.source_routes->headers[i].sr_lifetime;
                 return 0;
             }
@@ -17,6 +17,8 @@
 
 #include <stdio.h>
 #include <assert.h>
+#include <inttypes.h>
+#include <string.h>
 
 #include "thread.h"
 #include "sched.h"
@@ -71,6 +73,25 @@ static const char *state_to_string(thread_status_t state)
     return (name != NULL) ? name : STATE_NAME_UNKNOWN;
 }
 
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+/**
+ * Formats a percentile of the wakeup latency of a thread in microseconds,
+ * "-" if the thread was never woken up.
+ */
+static void _format_latency(char *buf, const schedstat_t *stat,
+                            unsigned percentile)
+{
+    uint32_t latency = schedstat_wakeup_latency_percentile(stat, percentile);
+
+    if (latency == UINT32_MAX) {
+        strcpy(buf, "-");
+    }
+    else {
+        sprintf(buf, "%" PRIu32 "us", latency);
+    }
+}
+#endif
+
 /**
  * @brief Prints a list of running threads including stack usage to stdout.
  */
@@ -91,6 +112,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
            "| runtime  | switches"
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+           "  | wake p50 | wake p99 | preempt"
 #endif
            "\n",
 #ifdef CONFIG_THREAD_NAMES
@@ -142,6 +166,13 @@ void ps(void)
             unsigned runtime_major = runtime_ticks / rt_sum;
             unsigned runtime_minor = ((runtime_ticks % rt_sum) * 1000) / rt_sum;
             unsigned switches = sched_pidlist[i].schedules;
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+            char wake_p50[16];
+            char wake_p99[16];
+            _format_latency(wake_p50, &sched_pidlist[i], 50);
+            _format_latency(wake_p99, &sched_pidlist[i], 99);
+            unsigned preemptions = sched_pidlist[i].preemptions;
 #endif
             printf("\t%3" PRIkernel_pid
 #ifdef CONFIG_THREAD_NAMES
@@ -153,6 +184,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    " | %2d.%03d%% |  %8u"
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+                   " | %8s | %8s | %7u"
 #endif
                    "\n",
                    p->pid,
@@ -166,6 +200,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    , runtime_major, runtime_minor, switches
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+                   , wake_p50, wake_p99, preemptions
 #endif
                   );
         }
@@ -21,13 +21,137 @@
  * @}
  */
 
+#include <stdbool.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "irq.h"
 #include "sched.h"
 #include "schedstatistics.h"
 #include "thread.h"
 #include "xtimer.h"
 
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+#include "cpu.h"
+#include "periph_conf.h"
+#ifdef CPU_NATIVE
+#include "native_internal.h"
+#endif
+
+#if defined(DWT_CTRL_CYCCNTENA_Msk) && defined(CLOCK_CORECLOCK)
+#define SCHEDSTAT_CYCCNT
+#endif
+#endif
+
 schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+/* the timers must not be read before they are initialized */
+static bool _enabled;
+#ifdef SCHEDSTAT_CYCCNT
+static bool _cyccnt;
+#endif
+/* descheduled thread that was still runnable, and its priority */
+static kernel_pid_t _preempted = KERNEL_PID_UNDEF;
+static uint8_t _preempted_prio;
+
+static inline uint32_t _cycles(void)
+{
+#if defined(SCHEDSTAT_CYCCNT)
+    if (_cyccnt) {
+        return DWT->CYCCNT;
+    }
+#elif defined(CPU_NATIVE)
+    struct timespec ts;
+
+    /* only differences are used, truncating is fine */
+    real_clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * NS_PER_SEC + ts.tv_nsec;
+#endif
+    return xtimer_now().ticks32;
+}
+
+uint32_t schedstat_cycles_per_sec(void)
+{
+#if defined(SCHEDSTAT_CYCCNT)
+    if (_cyccnt) {
+        return CLOCK_CORECLOCK;
+    }
+#elif defined(CPU_NATIVE)
+    return NS_PER_SEC;
+#endif
+    return XTIMER_HZ;
+}
+
+static void _record_latency(schedstat_t *stat, uint32_t latency)
+{
+    /* bit length of the latency */
+    unsigned bucket = latency ? (bitarithm_msb(latency) + 1) : 0;
+
+    if (bucket >= SCHEDSTAT_HIST_BUCKETS) {
+        bucket = SCHEDSTAT_HIST_BUCKETS - 1;
+    }
+    if (stat->wakeup_hist[bucket] < UINT16_MAX) {
+        stat->wakeup_hist[bucket]++;
+    }
+}
+
+void sched_statistics_status_cb(kernel_pid_t pid, thread_status_t old,
+                                thread_status_t status)
+{
+    schedstat_t *stat = &sched_pidlist[pid];
+    uint32_t now;
+
+    if (!_enabled || (old == status)) {
+        return;
+    }
+    now = xtimer_now().ticks32;
+    /* a stopped thread was never blocked, it is (re)created */
+    if ((old < STATUS_ON_RUNQUEUE) && (old != STATUS_STOPPED)) {
+        stat->blocked_ticks[old] += now - stat->blocked_since;
+    }
+    if (status < STATUS_ON_RUNQUEUE) {
+        stat->blocked_since = now;
+        stat->woken = 0;
+    }
+    else if (old < STATUS_ON_RUNQUEUE) {
+        stat->runnable_since = _cycles();
+        stat->woken = 1;
+    }
+}
+
+uint32_t schedstat_wakeup_latency_percentile(const schedstat_t *stat,
+                                             unsigned percentile)
+{
+    uint16_t hist[SCHEDSTAT_HIST_BUCKETS];
+    uint32_t total = 0;
+    uint32_t rank;
+    unsigned bucket;
+
+    /* the histogram is updated by the scheduler */
+    unsigned state = irq_disable();
+    memcpy(hist, stat->wakeup_hist, sizeof(hist));
+    irq_restore(state);
+
+    for (bucket = 0; bucket < SCHEDSTAT_HIST_BUCKETS; bucket++) {
+        total += hist[bucket];
+    }
+    if (total == 0) {
+        return UINT32_MAX;
+    }
+    /* rank of the percentile, rounded up */
+    rank = (total * percentile + 99) / 100;
+    for (bucket = 0; bucket < SCHEDSTAT_HIST_BUCKETS - 1; bucket++) {
+        if (rank <= hist[bucket]) {
+            break;
+        }
+        rank -= hist[bucket];
+    }
+    uint32_t hz = schedstat_cycles_per_sec();
+    return ((((uint64_t)1 << bucket) * US_PER_SEC) + hz - 1) / hz;
+}
+#endif /* MODULE_SCHEDSTATISTICS_LATENCY */
+
 void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
 {
     uint32_t now = xtimer_now().ticks32;
@@ -36,6 +160,20 @@ void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
     if (active_thread != KERNEL_PID_UNDEF) {
         schedstat_t *active_stat = &sched_pidlist[active_thread];
         active_stat->runtime_ticks += now - active_stat->laststart;
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+        /* the scheduler sets the status of a thread that is still runnable
+         * to pending, the next thread is only known in the following call */
+        thread_t *active = thread_get(active_thread);
+        if (active->status == STATUS_PENDING) {
+            _preempted = active_thread;
+            _preempted_prio = active->priority;
+        }
+        else {
+            _preempted = KERNEL_PID_UNDEF;
+        }
+        /* a thread woken up before it was descheduled kept running */
+        active_stat->woken = 0;
+#endif
     }
 
     /* Update next_thread stats */
@@ -43,6 +181,19 @@ void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
         schedstat_t *next_stat = &sched_pidlist[next_thread];
         next_stat->laststart = now;
         next_stat->schedules++;
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+        /* a thread yielding to one of the same priority was not preempted */
+        if (_preempted != KERNEL_PID_UNDEF) {
+            if (thread_get(next_thread)->priority < _preempted_prio) {
+                sched_pidlist[_preempted].preemptions++;
+            }
+            _preempted = KERNEL_PID_UNDEF;
+        }
+        if (next_stat->woken) {
+            _record_latency(next_stat, _cycles() - next_stat->runnable_since);
+            next_stat->woken = 0;
+        }
+#endif
     }
 }
 
@@ -53,5 +204,21 @@ void init_schedstatistics(void)
     schedstat_t *active_stat = &sched_pidlist[thread_getpid()];
     active_stat->laststart = xtimer_now().ticks32;
     active_stat->schedules = 1;
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+#ifdef SCHEDSTAT_CYCCNT
+    /* the cycle counter is optional, check if it is there */
+    if (!(DWT->CTRL & DWT_CTRL_NOCYCCNT_Msk)) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        _cyccnt = true;
+    }
+#endif
+    /* blocked times are counted from now on */
+    uint32_t now = xtimer_now().ticks32;
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        sched_pidlist[pid].blocked_since = now;
+    }
+    _enabled = true;
+#endif
     sched_register_cb(sched_statistics_cb);
 }
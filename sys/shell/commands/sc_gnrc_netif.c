@@ -141,6 +141,35 @@ static int _netif_stats(netif_t *iface, unsigned module, bool reset)
     }
     return res;
 }
+
+#ifdef MODULE_NETSTATS_RX_BATCH
+static int _netif_stats_rx_batch(netif_t *iface, bool reset)
+{
+    netstats_rx_batch_t *stats;
+    int res = netif_get_opt(iface, NETOPT_RX_BATCH_STATS, 0, &stats,
+                            sizeof(&stats));
+
+    if (res < 0) {
+        /* not all devices receive in batches, so stay silent */
+        return res;
+    }
+    else if (reset) {
+        memset(stats, 0, sizeof(netstats_rx_batch_t));
+        puts("Reset statistics for module RX batches!");
+    }
+    else {
+        printf("          Statistics for RX batches\n"
+               "            Events %u  frames %u (max. %u per event)\n"
+               "            Limit reached %u\n",
+               (unsigned) stats->events,
+               (unsigned) stats->frames,
+               (unsigned) stats->frames_max,
+               (unsigned) stats->limit_reached);
+        res = 0;
+    }
+    return res;
+}
+#endif
 #endif /* MODULE_NETSTATS */
 
 static void _link_usage(char *cmd_name)
@@ -228,7 +257,7 @@ static void _del_usage(char *cmd_name)
 #ifdef MODULE_NETSTATS
 static void _stats_usage(char *cmd_name)
 {
-    printf("usage: %s <if_id> stats [l2|ipv6] [reset]\n", cmd_name);
+    printf("usage: %s <if_id> stats [l2|ipv6|rxbatch] [reset]\n", cmd_name);
     puts("       reset can be only used if the module is specified.");
 }
 #endif
@@ -804,6 +833,9 @@ static void _netif_list(netif_t *iface)
 #endif
 #ifdef MODULE_NETSTATS_IPV6
     _netif_stats(iface, NETSTATS_IPV6, false);
+#endif
+#ifdef MODULE_NETSTATS_RX_BATCH
+    _netif_stats_rx_batch(iface, false);
 #endif
     puts("");
 }
@@ -1691,6 +1723,9 @@ int _gnrc_netif_config(int argc, char **argv)
             else if (strcmp(argv[3], "ipv6") == 0) {
                 module = NETSTATS_IPV6;
             }
+            else if (strcmp(argv[3], "rxbatch") == 0) {
+                module = NETSTATS_RX_BATCH;
+            }
             else {
                 printf("Module %s doesn't exist or does not provide statistics.\n", argv[3]);
 
@@ -1707,6 +1742,11 @@ int _gnrc_netif_config(int argc, char **argv)
             if (module & NETSTATS_IPV6) {
                 _netif_stats(iface, NETSTATS_IPV6, reset);
             }
+#ifdef MODULE_NETSTATS_RX_BATCH
+            if (module & NETSTATS_RX_BATCH) {
+                _netif_stats_rx_batch(iface, reset);
+            }
+#endif
 
             return 1;
         }
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_trace_event
+ * @{
+ *
+ * @file
+ * @brief       Event tracing implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "cpu.h"
+#include "irq.h"
+#include "periph_conf.h"
+#include "thread.h"
+#include "trace_event.h"
+#include "xtimer.h"
+
+#if defined(DWT_CTRL_CYCCNTENA_Msk) && defined(CLOCK_CORECLOCK)
+#define TRACE_EVENT_CYCCNT
+#endif
+
+static_assert((CONFIG_TRACE_EVENT_BUFSIZE &
+               (CONFIG_TRACE_EVENT_BUFSIZE - 1)) == 0,
+              "CONFIG_TRACE_EVENT_BUFSIZE must be a power of two");
+
+static trace_event_t _events[CONFIG_TRACE_EVENT_BUFSIZE];
+/* number of events ever recorded, the next event goes to
+ * _events[_pos % CONFIG_TRACE_EVENT_BUFSIZE] */
+static atomic_uint _pos;
+/* nothing is recorded before the timer is initialized */
+static volatile bool _recording;
+#ifdef TRACE_EVENT_CYCCNT
+static bool _cyccnt;
+#endif
+
+static inline uint32_t _now(void)
+{
+#ifdef TRACE_EVENT_CYCCNT
+    if (_cyccnt) {
+        return DWT->CYCCNT;
+    }
+#endif
+    return xtimer_now_usec();
+}
+
+void trace_event_init(void)
+{
+#ifdef TRACE_EVENT_CYCCNT
+    /* the cycle counter is optional, check if it is there */
+    if (!(DWT->CTRL & DWT_CTRL_NOCYCCNT_Msk)) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        _cyccnt = true;
+    }
+#endif
+    _recording = true;
+}
+
+uint32_t trace_event_ticks_per_sec(void)
+{
+#ifdef TRACE_EVENT_CYCCNT
+    if (_cyccnt) {
+        return CLOCK_CORECLOCK;
+    }
+#endif
+    return US_PER_SEC;
+}
+
+void trace_event(trace_event_type_t type, const char *name, uint32_t arg)
+{
+    trace_event_t *event;
+    unsigned state;
+
+    if (!_recording) {
+        return;
+    }
+    /* an ISR recording an event between reserving the slot and taking the
+     * timestamp would put the events out of order */
+    state = irq_disable();
+    event = &_events[atomic_fetch_add_explicit(&_pos, 1, memory_order_relaxed) &
+                     (CONFIG_TRACE_EVENT_BUFSIZE - 1)];
+    event->time = _now();
+    irq_restore(state);
+    event->name = name;
+    event->arg = arg;
+    /* the scheduler runs in an ISR on some platforms, context switches
+     * belong to the threads nevertheless */
+    event->type = (irq_is_in() && (type != TRACE_EVENT_SWITCH))
+                ? (type | TRACE_EVENT_FLAG_ISR) : type;
+    event->pid = thread_getpid();
+}
+
+/* index of the oldest event and number of events */
+static unsigned _range(unsigned *first)
+{
+    unsigned pos = atomic_load_explicit(&_pos, memory_order_relaxed);
+    unsigned numof = (pos < CONFIG_TRACE_EVENT_BUFSIZE)
+                   ? pos : CONFIG_TRACE_EVENT_BUFSIZE;
+
+    *first = pos - numof;
+    return numof;
+}
+
+static inline const trace_event_t *_event(unsigned idx)
+{
+    return &_events[idx & (CONFIG_TRACE_EVENT_BUFSIZE - 1)];
+}
+
+unsigned trace_event_get(trace_event_t *events, unsigned max)
+{
+    unsigned first;
+    unsigned numof = _range(&first);
+
+    if (numof > max) {
+        /* the newest events are the most interesting ones */
+        first += numof - max;
+        numof = max;
+    }
+    for (unsigned i = 0; i < numof; i++) {
+        events[i] = *_event(first + i);
+    }
+    return numof;
+}
+
+static void _print_u32(uint32_t val)
+{
+    /* little endian, independent of the host */
+    for (unsigned i = 0; i < sizeof(val); i++) {
+        printf("%02x", (unsigned)((val >> (8 * i)) & 0xff));
+    }
+}
+
+void trace_event_dump(void)
+{
+    bool recording = _recording;
+    unsigned first;
+    unsigned numof;
+
+    /* events recorded during the (slow) printing would overwrite the ones
+     * being printed */
+    _recording = false;
+    numof = _range(&first);
+
+    printf("TRACE_EVENT %u %" PRIu32 " %u\n", TRACE_EVENT_DUMP_VERSION,
+           trace_event_ticks_per_sec(), numof);
+    for (unsigned i = 0; i < numof; i++) {
+        const char *name = _event(first + i)->name;
+        bool known = false;
+
+        for (unsigned j = 0; j < i; j++) {
+            if (_event(first + j)->name == name) {
+                known = true;
+                break;
+            }
+        }
+        if (!known) {
+            printf("S %08" PRIx32 " %s\n", (uint32_t)(uintptr_t)name,
+                   name ? name : "");
+        }
+    }
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        if (thread_get(pid)) {
+            const char *name = thread_getname(pid);
+
+            printf("T %d %s\n", (int)pid, name ? name : "");
+        }
+    }
+    for (unsigned i = 0; i < numof; i++) {
+        const trace_event_t *event = _event(first + i);
+
+        printf("E ");
+        _print_u32(event->time);
+        _print_u32((uint32_t)(uintptr_t)event->name);
+        _print_u32(event->arg);
+        _print_u32(event->type | ((uint32_t)event->reserved << 8) |
+                   ((uint32_t)(uint16_t)event->pid << 16));
+        puts("");
+    }
+    puts("TRACE_EVENT END");
+    _recording = recording;
+}
+
+void trace_event_reset(void)
+{
+    atomic_store_explicit(&_pos, 0, memory_order_relaxed);
+}
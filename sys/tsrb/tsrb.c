@@ -12,13 +12,27 @@
  * @file
  * @brief       thread-safe ringbuffer implementation
  *
+ * The producer only ever writes tsrb_t::writes and the consumer only ever
+ * writes tsrb_t::reads. Each side reads the other side's counter once per
+ * call and only updates its own counter after it is done with the data, so
+ * no locking is needed with a single producer and a single consumer.
+ *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  *
  * @}
  */
 
+#include <string.h>
+
 #include "tsrb.h"
 
+/* keeps the compiler from moving accesses to the buffer across the update of
+ * tsrb_t::reads or tsrb_t::writes */
+static inline void _barrier(void)
+{
+    __asm__ volatile ("" : : : "memory");
+}
+
 static void _push(tsrb_t *rb, uint8_t c)
 {
     rb->buf[rb->writes++ & (rb->size - 1)] = c;
@@ -29,6 +43,31 @@ static uint8_t _pop(tsrb_t *rb)
     return rb->buf[rb->reads++ & (rb->size - 1)];
 }
 
+/* copies up to n bytes out of the buffer, or just drops them if dst is NULL */
+static size_t _get(tsrb_t *rb, uint8_t *dst, size_t n)
+{
+    unsigned reads = rb->reads;
+    size_t avail = rb->writes - reads;
+
+    if (n > avail) {
+        n = avail;
+    }
+    _barrier();
+    if (dst) {
+        unsigned pos = reads & (rb->size - 1);
+        size_t first = rb->size - pos;
+
+        if (first > n) {
+            first = n;
+        }
+        memcpy(dst, &rb->buf[pos], first);
+        memcpy(dst + first, rb->buf, n - first);
+    }
+    _barrier();
+    rb->reads = reads + n;
+    return n;
+}
+
 int tsrb_get_one(tsrb_t *rb)
 {
     if (!tsrb_empty(rb)) {
@@ -41,22 +80,12 @@ int tsrb_get_one(tsrb_t *rb)
 
 int tsrb_get(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t tmp = n;
-    while (tmp && !tsrb_empty(rb)) {
-        *dst++ = _pop(rb);
-        tmp--;
-    }
-    return (n - tmp);
+    return _get(rb, dst, n);
 }
 
 int tsrb_drop(tsrb_t *rb, size_t n)
 {
-    size_t tmp = n;
-    while (tmp && !tsrb_empty(rb)) {
-        _pop(rb);
-        tmp--;
-    }
-    return (n - tmp);
+    return _get(rb, NULL, n);
 }
 
 int tsrb_add_one(tsrb_t *rb, uint8_t c)
@@ -72,10 +101,57 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c)
 
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n)
 {
-    size_t tmp = n;
-    while (tmp && !tsrb_full(rb)) {
-        _push(rb, *src++);
-        tmp--;
+    unsigned writes = rb->writes;
+    unsigned pos = writes & (rb->size - 1);
+    size_t space = rb->size - (writes - rb->reads);
+    size_t first = rb->size - pos;
+
+    if (n > space) {
+        n = space;
     }
-    return (n - tmp);
+    if (first > n) {
+        first = n;
+    }
+    _barrier();
+    memcpy(&rb->buf[pos], src, first);
+    memcpy(rb->buf, src + first, n - first);
+    _barrier();
+    rb->writes = writes + n;
+    return n;
+}
+
+size_t tsrb_get_region(tsrb_t *rb, uint8_t **data)
+{
+    unsigned reads = rb->reads;
+    unsigned pos = reads & (rb->size - 1);
+    size_t avail = rb->writes - reads;
+
+    _barrier();
+    *data = &rb->buf[pos];
+    return (avail < (rb->size - pos)) ? avail : (rb->size - pos);
+}
+
+void tsrb_get_commit(tsrb_t *rb, size_t n)
+{
+    assert(n <= tsrb_avail(rb));
+    _barrier();
+    rb->reads += n;
+}
+
+size_t tsrb_add_region(tsrb_t *rb, uint8_t **data)
+{
+    unsigned writes = rb->writes;
+    unsigned pos = writes & (rb->size - 1);
+    size_t space = rb->size - (writes - rb->reads);
+
+    _barrier();
+    *data = &rb->buf[pos];
+    return (space < (rb->size - pos)) ? space : (rb->size - pos);
+}
+
+void tsrb_add_commit(tsrb_t *rb, size_t n)
+{
+    assert(n <= tsrb_free(rb));
+    _barrier();
+    rb->writes += n;
 }
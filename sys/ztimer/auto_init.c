@@ -44,6 +44,7 @@
 #include "ztimer/periph_timer.h"
 #include "ztimer/periph_rtt.h"
 #include "ztimer/config.h"
+#include "ztimer/wheel.h"
 
 #include "log.h"
 
@@ -98,6 +99,13 @@ ztimer_clock_t *const ZTIMER_MSEC_BASE = &_ztimer_periph_timer_usec.super;
 #  endif
 #endif
 
+#if MODULE_ZTIMER_WHEEL && MODULE_ZTIMER_USEC && CONFIG_ZTIMER_USEC_WHEEL
+static ztimer_wheel_t _ztimer_wheel_usec;
+#endif
+#if MODULE_ZTIMER_WHEEL && MODULE_ZTIMER_MSEC && CONFIG_ZTIMER_MSEC_WHEEL
+static ztimer_wheel_t _ztimer_wheel_msec;
+#endif
+
 void ztimer_init(void)
 {
 #if MODULE_ZTIMER_USEC
@@ -140,6 +148,10 @@ void ztimer_init(void)
               CONFIG_ZTIMER_USEC_REQUIRED_PM_MODE);
     ZTIMER_USEC->required_pm_mode = CONFIG_ZTIMER_USEC_REQUIRED_PM_MODE;
 #  endif
+#  if MODULE_ZTIMER_WHEEL && CONFIG_ZTIMER_USEC_WHEEL
+    LOG_DEBUG("ztimer_init(): ZTIMER_USEC using a timer wheel\n");
+    ztimer_wheel_init(ZTIMER_USEC, &_ztimer_wheel_usec);
+#  endif
 #endif
 
 #ifdef ZTIMER_RTT_INIT
@@ -165,5 +177,9 @@ void ztimer_init(void)
               CONFIG_ZTIMER_MSEC_REQUIRED_PM_MODE);
     ZTIMER_MSEC->required_pm_mode = CONFIG_ZTIMER_MSEC_REQUIRED_PM_MODE;
 #  endif
+#  if MODULE_ZTIMER_WHEEL && CONFIG_ZTIMER_MSEC_WHEEL
+    LOG_DEBUG("ztimer_init(): ZTIMER_MSEC using a timer wheel\n");
+    ztimer_wheel_init(ZTIMER_MSEC, &_ztimer_wheel_msec);
+#  endif
 #endif
 }
@@ -31,6 +31,7 @@
 #include "pm_layered.h"
 #endif
 #include "ztimer.h"
+#include "ztimer/wheel.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
@@ -47,8 +48,23 @@ static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 }
 #endif
 
+static inline ztimer_wheel_t *_wheel(const ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_WHEEL
+    return clock->wheel;
+#else
+    (void)clock;
+    return NULL;
+#endif
+}
+
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
+#if MODULE_ZTIMER_WHEEL
+    if (_wheel(clock)) {
+        return (t->base.prev != NULL);
+    }
+#endif
     if (!clock->list.next) {
         return 0;
     }
@@ -93,7 +109,11 @@ void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
 
     timer->base.offset = val;
     _add_entry_to_list(clock, &timer->base);
-    if (clock->list.next == &timer->base) {
+    if (_wheel(clock)) {
+        /* the next event of the wheel may have changed */
+        _ztimer_update(clock);
+    }
+    else if (clock->list.next == &timer->base) {
 #ifdef MODULE_ZTIMER_EXTEND
         if (clock->max_value < UINT32_MAX) {
             val = _min_u32(val, clock->max_value >> 1);
@@ -112,6 +132,11 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
     ztimer_base_t *list = &clock->list;
 
+    if (_wheel(clock)) {
+        ztimer_wheel_add(clock, entry);
+        return;
+    }
+
 #ifdef MODULE_PM_LAYERED
     /* First timer on the clock's linked list */
     if (list->next == NULL &&
@@ -181,6 +206,11 @@ void ztimer_update_head_offset(ztimer_clock_t *clock)
 
     ztimer_base_t *entry = clock->list.next;
 
+    if (_wheel(clock)) {
+        ztimer_wheel_advance(clock, now);
+        return;
+    }
+
     DEBUG(
         "clock %p: ztimer_update_head_offset(): diff=%" PRIu32 " old head %p\n",
         (void *)clock, diff, (void *)entry);
@@ -222,6 +252,11 @@ static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
     assert(_is_set(clock, (ztimer_t *)entry));
 
+    if (_wheel(clock)) {
+        ztimer_wheel_del(clock, entry);
+        return;
+    }
+
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
         if (list_entry == entry) {
@@ -257,6 +292,10 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
 {
     ztimer_base_t *entry = clock->list.next;
 
+    if (_wheel(clock)) {
+        return (ztimer_t *)ztimer_wheel_pop(clock);
+    }
+
     if (entry && (entry->offset == 0)) {
         clock->list.next = entry->next;
         if (!entry->next) {
@@ -275,14 +314,27 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
     }
 }
 
+/* gets the ticks from clock->list.offset until the next event of the clock */
+static bool _next_offset(const ztimer_clock_t *clock, uint32_t *offset)
+{
+    if (_wheel(clock)) {
+        return ztimer_wheel_next(clock, offset);
+    }
+    if (clock->list.next) {
+        *offset = clock->list.next->offset;
+        return true;
+    }
+    return false;
+}
+
 static void _ztimer_update(ztimer_clock_t *clock)
 {
+    uint32_t offset;
+
 #ifdef MODULE_ZTIMER_EXTEND
     if (clock->max_value < UINT32_MAX) {
-        if (clock->list.next) {
-            clock->ops->set(clock,
-                            _min_u32(clock->list.next->offset,
-                                     clock->max_value >> 1));
+        if (_next_offset(clock, &offset)) {
+            clock->ops->set(clock, _min_u32(offset, clock->max_value >> 1));
         }
         else {
             clock->ops->set(clock, clock->max_value >> 1);
@@ -292,8 +344,8 @@ static void _ztimer_update(ztimer_clock_t *clock)
 #endif
     }
     else {
-        if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+        if (_next_offset(clock, &offset)) {
+            clock->ops->set(clock, offset);
         }
         else {
             if (IS_USED(MODULE_ZTIMER_NOW64)) {
@@ -309,6 +361,8 @@ static void _ztimer_update(ztimer_clock_t *clock)
 
 void ztimer_handler(ztimer_clock_t *clock)
 {
+    uint32_t offset;
+
     DEBUG("ztimer_handler(): %p now=%" PRIu32 "\n", (void *)clock, clock->ops->now(
               clock));
     if (ENABLE_DEBUG) {
@@ -320,18 +374,20 @@ void ztimer_handler(ztimer_clock_t *clock)
         /* calling now triggers checkpointing */
         uint32_t now = ztimer_now(clock);
 
-        if (clock->list.next) {
-            uint32_t target = clock->list.offset + clock->list.next->offset;
-            int32_t diff = (int32_t)(target - now);
-            if (diff > 0) {
-                DEBUG("ztimer_handler(): %p postponing by %" PRIi32 "\n",
+        if (_next_offset(clock, &offset)) {
+            /* clock->list.offset is never ahead of now, comparing the ticks
+             * elapsed since then allows offsets up to UINT32_MAX */
+            uint32_t elapsed = now - clock->list.offset;
+            if (offset > elapsed) {
+                uint32_t diff = offset - elapsed;
+                DEBUG("ztimer_handler(): %p postponing by %" PRIu32 "\n",
                       (void *)clock, diff);
                 clock->ops->set(clock, _min_u32(diff, clock->max_value >> 1));
                 return;
             }
             else {
-                DEBUG("ztimer_handler(): %p diff=%" PRIi32 "\n", (void *)clock,
-                      diff);
+                DEBUG("ztimer_handler(): %p late by %" PRIu32 "\n",
+                      (void *)clock, elapsed - offset);
             }
         }
         else {
@@ -345,8 +401,15 @@ void ztimer_handler(ztimer_clock_t *clock)
     }
 #endif
 
-    clock->list.offset += clock->list.next->offset;
-    clock->list.next->offset = 0;
+    if (_wheel(clock)) {
+        if (_next_offset(clock, &offset)) {
+            ztimer_wheel_advance(clock, clock->list.offset + offset);
+        }
+    }
+    else {
+        clock->list.offset += clock->list.next->offset;
+        clock->list.next->offset = 0;
+    }
 
     ztimer_t *entry = _now_next(clock);
     while (entry) {
@@ -378,6 +441,18 @@ static void _ztimer_print(const ztimer_clock_t *clock)
     const ztimer_base_t *entry = &clock->list;
     uint32_t last_offset = 0;
 
+    if (_wheel(clock)) {
+        uint32_t offset;
+
+        printf("wheel at %" PRIu32 ": %u timers", clock->list.offset,
+               _wheel(clock)->numof);
+        if (_next_offset(clock, &offset)) {
+            printf(", next event in %" PRIu32, offset);
+        }
+        puts("");
+        return;
+    }
+
     do {
         printf("0x%08x:%" PRIu32 "(%" PRIu32 ")%s", (unsigned)entry,
                entry->offset, entry->offset +
@@ -0,0 +1,257 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     sys_ztimer_wheel
+ * @{
+ *
+ * @file
+ * @brief       Hierarchical timing wheel for ztimer clocks
+ *
+ * Every slot holds a list whose first entry's ztimer_base_t::prev points to
+ * its last entry, so timers can be appended and removed in constant time.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#ifdef MODULE_PM_LAYERED
+#include "pm_layered.h"
+#endif
+#include "ztimer.h"
+#include "ztimer/wheel.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define _SHIFT(level)   ((level) * CONFIG_ZTIMER_WHEEL_SLOTS_EXP)
+#define _MASK           (ZTIMER_WHEEL_SLOTS - 1)
+
+static ztimer_base_t **_list(ztimer_wheel_t *wheel, uint8_t slot)
+{
+    if (slot == ZTIMER_WHEEL_EXPIRED) {
+        return &wheel->expired;
+    }
+    return &wheel->slots[slot / ZTIMER_WHEEL_SLOTS][slot & _MASK];
+}
+
+static void _append(ztimer_base_t **list, ztimer_base_t *entry)
+{
+    entry->next = NULL;
+    if (*list) {
+        entry->prev = (*list)->prev;
+        (*list)->prev->next = entry;
+        (*list)->prev = entry;
+    }
+    else {
+        entry->prev = entry;
+        *list = entry;
+    }
+}
+
+static void _unlink(ztimer_base_t **list, ztimer_base_t *entry)
+{
+    if (entry->prev == entry) {
+        *list = NULL;
+    }
+    else if (entry == *list) {
+        entry->next->prev = entry->prev;
+        *list = entry->next;
+    }
+    else {
+        entry->prev->next = entry->next;
+        if (entry->next) {
+            entry->next->prev = entry->prev;
+        }
+        else {
+            (*list)->prev = entry->prev;
+        }
+    }
+    /* reset the entry's pointers so _is_set() considers it unset */
+    entry->next = NULL;
+    entry->prev = NULL;
+}
+
+/* sorts entry into the wheel by its target time relative to now */
+static void _insert(ztimer_wheel_t *wheel, ztimer_base_t *entry, uint32_t now)
+{
+    uint32_t delta = entry->offset - now;
+    unsigned level = 0;
+    unsigned idx;
+
+    if (delta == 0) {
+        entry->slot = ZTIMER_WHEEL_EXPIRED;
+        _append(&wheel->expired, entry);
+        return;
+    }
+    while ((level < (ZTIMER_WHEEL_LEVELS - 1)) &&
+           (delta >> _SHIFT(level + 1))) {
+        level++;
+    }
+    idx = (entry->offset >> _SHIFT(level)) & _MASK;
+    entry->slot = (level * ZTIMER_WHEEL_SLOTS) + idx;
+    _append(&wheel->slots[level][idx], entry);
+    wheel->used[level] |= (1U << idx);
+}
+
+void ztimer_wheel_init(ztimer_clock_t *clock, ztimer_wheel_t *wheel)
+{
+    assert(clock->list.next == NULL);
+    memset(wheel, 0, sizeof(*wheel));
+    clock->wheel = wheel;
+}
+
+void ztimer_wheel_add(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_wheel_t *wheel = clock->wheel;
+
+#ifdef MODULE_PM_LAYERED
+    /* First timer on the clock's wheel */
+    if (wheel->numof == 0 &&
+        clock->required_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+        pm_block(clock->required_pm_mode);
+    }
+#endif
+    wheel->numof++;
+    /* ztimer_base_t::offset is the absolute target time from now on */
+    entry->offset += clock->list.offset;
+    _insert(wheel, entry, clock->list.offset);
+    DEBUG("ztimer_wheel_add() %p target %" PRIu32 " slot %u\n", (void *)entry,
+          entry->offset, entry->slot);
+}
+
+void ztimer_wheel_del(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_wheel_t *wheel = clock->wheel;
+    uint8_t slot = entry->slot;
+
+    assert(entry->prev != NULL);
+    _unlink(_list(wheel, slot), entry);
+    if ((slot != ZTIMER_WHEEL_EXPIRED) && (*_list(wheel, slot) == NULL)) {
+        wheel->used[slot / ZTIMER_WHEEL_SLOTS] &= ~(1U << (slot & _MASK));
+    }
+    wheel->numof--;
+#ifdef MODULE_PM_LAYERED
+    /* The last timer just got removed from the clock's wheel */
+    if (wheel->numof == 0 &&
+        clock->required_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+        pm_unblock(clock->required_pm_mode);
+    }
+#endif
+}
+
+/* ticks from now until the next slot of level needs to be handled */
+static uint64_t _level_next(const ztimer_wheel_t *wheel, unsigned level,
+                            uint32_t now)
+{
+    unsigned shift = _SHIFT(level);
+    /* rotate the slot after the current one to bit 0, the current one to the
+     * highest bit */
+    unsigned rot = ((now >> shift) & _MASK) + 1;
+    uint32_t used = wheel->used[level];
+
+    used = ((used >> rot) | (used << (ZTIMER_WHEEL_SLOTS - rot))) &
+           ((UINT32_C(1) << ZTIMER_WHEEL_SLOTS) - 1);
+    if (used == 0) {
+        return UINT64_MAX;
+    }
+    /* start of the interval of that slot */
+    return ((uint64_t)(bitarithm_lsb(used) + 1) << shift) -
+           (now & ((UINT32_C(1) << shift) - 1));
+}
+
+/* ticks from now until the next slot needs to be handled */
+static uint64_t _next(const ztimer_wheel_t *wheel, uint32_t now)
+{
+    uint64_t next = UINT64_MAX;
+
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        if (wheel->used[level]) {
+            uint64_t level_next = _level_next(wheel, level, now);
+
+            if (level_next < next) {
+                next = level_next;
+            }
+        }
+    }
+    return next;
+}
+
+bool ztimer_wheel_next(const ztimer_clock_t *clock, uint32_t *offset)
+{
+    const ztimer_wheel_t *wheel = clock->wheel;
+
+    if (wheel->expired) {
+        *offset = 0;
+        return true;
+    }
+    if (wheel->numof == 0) {
+        return false;
+    }
+    /* the slots of the highest level may start 2^32 ticks or more from now,
+     * the clock handles the next slot when it is within range */
+    uint64_t next = _next(wheel, clock->list.offset);
+    *offset = (next > UINT32_MAX) ? UINT32_MAX : (uint32_t)next;
+    return true;
+}
+
+/* handles the slots whose interval starts at now */
+static void _turn(ztimer_wheel_t *wheel, uint32_t now)
+{
+    /* higher levels first, their timers may move to the slots handled next */
+    for (unsigned level = ZTIMER_WHEEL_LEVELS; level-- > 0;) {
+        unsigned idx = (now >> _SHIFT(level)) & _MASK;
+        ztimer_base_t *entry = wheel->slots[level][idx];
+
+        if (now & ((UINT32_C(1) << _SHIFT(level)) - 1)) {
+            /* not at the start of a slot interval of this level */
+            continue;
+        }
+        if (entry == NULL) {
+            continue;
+        }
+        wheel->slots[level][idx] = NULL;
+        wheel->used[level] &= ~(1U << idx);
+        while (entry) {
+            ztimer_base_t *next = entry->next;
+
+            /* level 0 slots only hold timers with target now */
+            _insert(wheel, entry, now);
+            entry = next;
+        }
+    }
+}
+
+void ztimer_wheel_advance(ztimer_clock_t *clock, uint32_t now)
+{
+    ztimer_wheel_t *wheel = clock->wheel;
+    uint32_t diff = now - clock->list.offset;
+    uint64_t next;
+
+    while ((next = _next(wheel, clock->list.offset)) <= diff) {
+        clock->list.offset += next;
+        diff -= next;
+        _turn(wheel, clock->list.offset);
+    }
+    clock->list.offset = now;
+}
+
+ztimer_base_t *ztimer_wheel_pop(ztimer_clock_t *clock)
+{
+    ztimer_base_t *entry = clock->wheel->expired;
+
+    if (entry) {
+        ztimer_wheel_del(clock, entry);
+    }
+    return entry;
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compare the throughput of AES in the cipher modes when
+ *              encrypting block by block and with the multi-block functions
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "crypto/ciphers.h"
+#include "crypto/modes/cbc.h"
+#include "crypto/modes/ccm.h"
+#include "crypto/modes/ctr.h"
+#include "crypto/modes/ecb.h"
+#include "macros/units.h"
+#include "xtimer.h"
+
+#ifndef TEST_BYTES
+/* number of bytes to encrypt per measurement */
+#define TEST_BYTES          (32U * 1024U)
+#endif
+
+#ifndef TEST_MSG_SIZE
+/* size of a single message, about a full IEEE 802.15.4 frame */
+#define TEST_MSG_SIZE       (128U)
+#endif
+
+#define TEST_MAC_LEN        (8U)
+#define TEST_NONCE_LEN      (13U)
+
+typedef int (*_encrypt_t)(cipher_t *cipher, uint8_t *output);
+
+static const uint8_t _key[16] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+};
+static const uint8_t _nonce[16] = {
+    0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+    0xa8, 0xa9, 0xaa, 0xab, 0xac, 0x00, 0x00, 0x00,
+};
+static const uint8_t _adata[] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 };
+
+/* AES without the multi-block functions, so the cipher modes fall back to
+ * encrypting block by block */
+static cipher_interface_t _aes_per_block;
+
+static uint8_t _input[TEST_MSG_SIZE];
+static uint8_t _output[2][TEST_MSG_SIZE + TEST_MAC_LEN];
+
+static int _ecb(cipher_t *cipher, uint8_t *output)
+{
+    return cipher_encrypt_ecb(cipher, _input, TEST_MSG_SIZE, output);
+}
+
+static int _ctr(cipher_t *cipher, uint8_t *output)
+{
+    uint8_t nonce_counter[16];
+
+    memcpy(nonce_counter, _nonce, sizeof(nonce_counter));
+    return cipher_encrypt_ctr(cipher, nonce_counter, TEST_NONCE_LEN,
+                              _input, TEST_MSG_SIZE, output);
+}
+
+static int _cbc(cipher_t *cipher, uint8_t *output)
+{
+    uint8_t iv[16];
+
+    memcpy(iv, _nonce, sizeof(iv));
+    return cipher_encrypt_cbc(cipher, iv, _input, TEST_MSG_SIZE, output);
+}
+
+static int _ccm(cipher_t *cipher, uint8_t *output)
+{
+    return cipher_encrypt_ccm(cipher, _adata, sizeof(_adata), TEST_MAC_LEN,
+                              15 - TEST_NONCE_LEN, _nonce, TEST_NONCE_LEN,
+                              _input, TEST_MSG_SIZE, output);
+}
+
+static uint32_t _measure(cipher_t *cipher, _encrypt_t encrypt, uint8_t *output)
+{
+    unsigned iterations = TEST_BYTES / TEST_MSG_SIZE;
+    uint32_t start = xtimer_now_usec();
+
+    for (unsigned i = 0; i < iterations; i++) {
+        encrypt(cipher, output);
+    }
+    return xtimer_now_usec() - start;
+}
+
+static void _print(const char *mode, const char *impl, uint32_t time)
+{
+    uint64_t bytes = (uint64_t)(TEST_BYTES / TEST_MSG_SIZE) * TEST_MSG_SIZE;
+
+    if (time == 0) {
+        time = 1;
+    }
+    /* bytes per millisecond */
+    printf("{ \"mode\" : \"%s\", \"impl\" : \"%s\", \"result\" : %" PRIu32,
+           mode, impl, (uint32_t)((bytes * US_PER_MS) / time));
+#ifdef CLOCK_CORECLOCK
+    printf(", \"bytes_per_kcycle\" : %" PRIu32,
+           (uint32_t)((bytes * 1000U) /
+                      ((uint64_t)time * (CLOCK_CORECLOCK / MHZ(1)))));
+#endif
+    puts(" }");
+}
+
+static void _bench(const char *mode, _encrypt_t encrypt)
+{
+    cipher_t per_block, batched;
+    int res[2];
+
+    cipher_init(&per_block, &_aes_per_block, _key, sizeof(_key));
+    cipher_init(&batched, CIPHER_AES_128, _key, sizeof(_key));
+
+    res[0] = encrypt(&per_block, _output[0]);
+    res[1] = encrypt(&batched, _output[1]);
+    if ((res[0] < 0) || (res[0] != res[1]) ||
+        (memcmp(_output[0], _output[1], res[0]) != 0)) {
+        printf("{ \"mode\" : \"%s\", \"error\" : \"results differ\" }\n", mode);
+        return;
+    }
+    _print(mode, "per_block", _measure(&per_block, encrypt, _output[0]));
+    _print(mode, "batched", _measure(&batched, encrypt, _output[1]));
+}
+
+int main(void)
+{
+    _aes_per_block = *CIPHER_AES_128;
+    _aes_per_block.encrypt_blocks = NULL;
+    _aes_per_block.decrypt_blocks = NULL;
+    _aes_per_block.encrypt_chain = NULL;
+    for (unsigned i = 0; i < sizeof(_input); i++) {
+        _input[i] = (uint8_t)((i * 167) + 13);
+    }
+    puts("main starting");
+    _bench("ecb", _ecb);
+    _bench("ctr", _ctr);
+    _bench("cbc", _cbc);
+    _bench("ccm", _ccm);
+    puts("done");
+    return 0;
+}
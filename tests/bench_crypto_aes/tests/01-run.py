@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+MODES = ("ecb", "ctr", "cbc", "ccm")
+IMPLS = ("per_block", "batched")
+
+
+def testfunc(child):
+    child.expect_exact("main starting")
+    for mode in MODES:
+        for impl in IMPLS:
+            child.expect(r"{{ \"mode\" : \"{}\", \"impl\" : \"{}\", "
+                         r"\"result\" : \d+(, \"bytes_per_kcycle\" : \d+)? }}"
+                         .format(mode, impl))
+    child.expect_exact("done")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
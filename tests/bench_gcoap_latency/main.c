@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       CoAP server to measure the request latency through gcoap and
+ *              GNRC with `dist/tools/coap-bench`
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/gcoap.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ipv6/addr.h"
+#include "thread.h"
+
+static ssize_t _bench_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                              void *ctx);
+static ssize_t _stats_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                              void *ctx);
+
+/* CoAP resources. Must be sorted by path (ASCII order). */
+static const coap_resource_t _resources[] = {
+    { "/bench", COAP_GET | COAP_POST, _bench_handler, NULL },
+    { "/bench/stats", COAP_GET | COAP_DELETE, _stats_handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    &_resources[0],
+    ARRAY_SIZE(_resources),
+    NULL,
+    NULL
+};
+
+/*
+ * GET: empty response
+ * POST: echoes the payload of the request
+ */
+static ssize_t _bench_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                              void *ctx)
+{
+    (void)ctx;
+    const uint8_t *req_payload = pdu->payload;
+    size_t req_len = pdu->payload_len;
+    size_t resp_len;
+
+    if (coap_method2flag(coap_get_code_detail(pdu)) == COAP_GET) {
+        req_len = 0;
+    }
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    if (req_len == 0) {
+        return coap_opt_finish(pdu, COAP_OPT_FINISH_NONE);
+    }
+    coap_opt_add_format(pdu, COAP_FORMAT_OCTET);
+    resp_len = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
+    if (req_len > pdu->payload_len) {
+        return gcoap_response(pdu, buf, len, COAP_CODE_REQUEST_ENTITY_TOO_LARGE);
+    }
+    /* the request payload is still in buf, behind the response options */
+    memmove(pdu->payload, req_payload, req_len);
+    return resp_len + req_len;
+}
+
+static void _print_stats(void)
+{
+    gnrc_pktbuf_stats();
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        thread_t *thread = thread_get(pid);
+
+        if (thread && thread_has_msg_queue(thread)) {
+            printf("msg queue of %s: high-water mark %d of %u\n",
+                   thread_getname(pid), msg_queue_hwm(pid),
+                   thread->msg_queue.mask + 1);
+        }
+    }
+}
+
+/* appends line to the payload if it fits, returns the new payload length */
+static size_t _append(coap_pkt_t *pdu, size_t used, const char *line)
+{
+    size_t len = strlen(line);
+
+    if (used + len > pdu->payload_len) {
+        return used;
+    }
+    memcpy(pdu->payload + used, line, len);
+    return used + len;
+}
+
+/*
+ * GET: high-water marks of the packet buffer and of the message queues of all
+ *      threads, as text with one entry per line:
+ *
+ *      pktbuf <max used> <size>
+ *      slab <class> <max used> <slots> <slot size> <fallbacks>
+ *      msgq <pid> <thread name> <high-water mark> <size>
+ *
+ *      `slab` entries are only given with `gnrc_pktbuf_slab`, one per size
+ *      class, `pktbuf` then refers to its fallback arena.
+ *
+ *      Entries that do not fit into the response are left out.
+ *      Also prints gnrc_pktbuf_stats() to stdout.
+ * DELETE: resets the high-water marks of the packet buffer and of the message
+ *         queues
+ */
+static ssize_t _stats_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                              void *ctx)
+{
+    (void)ctx;
+    char line[48];
+    size_t used = 0;
+
+    if (coap_method2flag(coap_get_code_detail(pdu)) == COAP_DELETE) {
+        gnrc_pktbuf_max_used_reset();
+        for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST;
+             pid++) {
+            msg_queue_hwm_reset(pid);
+        }
+        return gcoap_response(pdu, buf, len, COAP_CODE_DELETED);
+    }
+
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    coap_opt_add_format(pdu, COAP_FORMAT_TEXT);
+    size_t resp_len = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
+
+    snprintf(line, sizeof(line), "pktbuf %u %u\n",
+             (unsigned)gnrc_pktbuf_max_used(),
+             (unsigned)CONFIG_GNRC_PKTBUF_SIZE);
+    used = _append(pdu, used, line);
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+    gnrc_pktbuf_slab_class_t slab;
+
+    for (unsigned i = 0; gnrc_pktbuf_slab_class_stats(i, &slab) == 0; i++) {
+        snprintf(line, sizeof(line), "slab %u %u %u %u %u\n", i,
+                 slab.max_used, slab.numof, slab.size, slab.fallbacks);
+        used = _append(pdu, used, line);
+    }
+#endif
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        thread_t *thread = thread_get(pid);
+
+        if (thread && thread_has_msg_queue(thread)) {
+            snprintf(line, sizeof(line), "msgq %d %s %d %u\n", (int)pid,
+                     thread_getname(pid), msg_queue_hwm(pid),
+                     thread->msg_queue.mask + 1);
+            used = _append(pdu, used, line);
+        }
+    }
+    _print_stats();
+    return resp_len + used;
+}
+
+static void _print_addrs(void)
+{
+    gnrc_netif_t *netif = NULL;
+
+    while ((netif = gnrc_netif_iter(netif))) {
+        ipv6_addr_t addrs[CONFIG_GNRC_NETIF_IPV6_ADDRS_NUMOF];
+        int res = gnrc_netif_ipv6_addrs_get(netif, addrs, sizeof(addrs));
+
+        for (int i = 0; i < (res / (int)sizeof(ipv6_addr_t)); i++) {
+            char addr_str[IPV6_ADDR_MAX_STR_LEN];
+
+            ipv6_addr_to_str(addr_str, &addrs[i], sizeof(addr_str));
+            printf("listening on [%s]:%u\n", addr_str, CONFIG_GCOAP_PORT);
+        }
+    }
+}
+
+int main(void)
+{
+    gcoap_register_listener(&_listener);
+    _print_addrs();
+    puts("bench_gcoap_latency: ready");
+    return 0;
+}
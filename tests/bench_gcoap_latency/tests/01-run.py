@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import json
+import os
+import subprocess
+import sys
+from testrunner import run
+
+COAP_BENCH = os.path.join(os.environ["RIOTBASE"], "dist", "tools",
+                          "coap-bench", "coap_bench.py")
+# fraction of the requests that may be lost, e.g. when the host is busy
+MAX_LOSS = 0.02
+
+
+def testfunc(child):
+    child.expect(r"listening on \[(fe80:[0-9a-f:]+)\]:(\d+)")
+    addr, port = child.match.group(1), child.match.group(2)
+    child.expect_exact("bench_gcoap_latency: ready")
+
+    out = subprocess.check_output(
+        [COAP_BENCH, addr, "--iface", os.environ.get("PORT", "tap0"),
+         "--port", port, "--rate", "50", "--duration", "2", "--json"],
+        timeout=30
+    )
+    result = json.loads(out.decode().splitlines()[-1])
+    print(result)
+    assert result["sent"] == 100
+    assert result["errors"] == 0
+    assert result["received"] >= result["sent"] * (1 - MAX_LOSS)
+    assert result["latency_ms"]["p999"] is not None
+    stats = result["stats"]
+    assert stats["pktbuf"]["max_used"] > 0
+    assert any(queue["hwm"] > 0 for queue in stats["msgq"])
+    # the node prints gnrc_pktbuf_stats() when asked for the stats
+    child.expect_exact("position of last byte used")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure forwarding table lookups per second
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "random.h"
+#include "xtimer.h"
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (1000000U)
+#endif
+
+#define TEST_IFACE          (1U)
+#define TEST_NEXT_HOPS      (4U)
+#define TEST_DSTS_NUMOF     (256U)
+
+static const unsigned _routes_numof[] = { 16, 256, 1024 };
+static ipv6_addr_t _dsts[TEST_DSTS_NUMOF];
+static volatile unsigned _flag = 0;
+
+static void _timer_callback(void *arg)
+{
+    (void)arg;
+
+    _flag = 1;
+}
+
+static void _random_addr(ipv6_addr_t *addr, unsigned idx)
+{
+    /* 2001:db8::/32, route index ensures unique prefixes of length >= 48 */
+    addr->u16[0] = byteorder_htons(0x2001);
+    addr->u16[1] = byteorder_htons(0x0db8);
+    addr->u16[2] = byteorder_htons(idx);
+    for (unsigned i = 3; i < 8; i++) {
+        addr->u16[i] = byteorder_htons(random_uint32());
+    }
+}
+
+static int _add_routes(unsigned start, unsigned end)
+{
+    for (unsigned i = start; i < end; i++) {
+        ipv6_addr_t pfx, next_hop = IPV6_ADDR_UNSPECIFIED;
+        unsigned pfx_len = random_uint32_range(48, IPV6_ADDR_BIT_LEN + 1);
+        int res;
+
+        _random_addr(&pfx, i);
+        ipv6_addr_set_link_local_prefix(&next_hop);
+        next_hop.u8[15] = (i % TEST_NEXT_HOPS) + 1;
+        if ((res = gnrc_ipv6_nib_ft_add(&pfx, pfx_len, &next_hop,
+                                        TEST_IFACE, 0)) < 0) {
+            printf("error adding route %u: %d\n", i, res);
+            return res;
+        }
+    }
+    /* mix of routed and unrouted destinations */
+    for (unsigned i = 0; i < TEST_DSTS_NUMOF; i++) {
+        _random_addr(&_dsts[i], random_uint32_range(0, 2 * end));
+    }
+    return 0;
+}
+
+int main(void)
+{
+    unsigned routes = 0;
+
+    puts("main starting");
+    for (unsigned i = 0; i < ARRAY_SIZE(_routes_numof); i++) {
+        xtimer_t timer = { .callback = _timer_callback };
+        gnrc_ipv6_nib_ft_t fte;
+        uint32_t n = 0;
+
+        if (_add_routes(routes, _routes_numof[i]) < 0) {
+            return 1;
+        }
+        routes = _routes_numof[i];
+        _flag = 0;
+        xtimer_set(&timer, TEST_DURATION);
+        while (!_flag) {
+            gnrc_ipv6_nib_ft_get(&_dsts[n % TEST_DSTS_NUMOF], NULL, &fte);
+            n++;
+        }
+        printf("{ \"routes\" : %u, \"result\" : %" PRIu32 " }\n", routes, n);
+    }
+
+    return 0;
+}
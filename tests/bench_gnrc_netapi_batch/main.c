@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure received UDP packets per second and context switches
+ *              per packet
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "msg.h"
+#include "net/gnrc.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/udp.h"
+#include "schedstatistics.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (1000000U)
+#endif
+
+#define TEST_PORT           (5683U)
+#define TEST_PAYLOAD_LEN    (32U)
+#define TEST_PKT_LEN        (sizeof(ipv6_hdr_t) + sizeof(udp_hdr_t) + \
+                             TEST_PAYLOAD_LEN)
+#define SINK_MSG_QUEUE_SIZE (8U)
+
+static const unsigned _bursts[] = { 1, 4, 8 };
+static uint8_t _frame[TEST_PKT_LEN];
+static char _sink_stack[THREAD_STACKSIZE_DEFAULT];
+static volatile uint32_t _received = 0;
+static volatile unsigned _flag = 0;
+
+static void _timer_callback(void *arg)
+{
+    (void)arg;
+
+    _flag = 1;
+}
+
+static void *_sink(void *arg)
+{
+    msg_t msg, msg_queue[SINK_MSG_QUEUE_SIZE];
+    gnrc_netreg_entry_t reg = GNRC_NETREG_ENTRY_INIT_BATCH(TEST_PORT,
+                                                           thread_getpid());
+
+    (void)arg;
+    msg_init_queue(msg_queue, SINK_MSG_QUEUE_SIZE);
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &reg);
+    while (1) {
+        msg_receive(&msg);
+        switch (msg.type) {
+            case GNRC_NETAPI_MSG_TYPE_RCV:
+                gnrc_pktbuf_release(msg.content.ptr);
+                _received++;
+                break;
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH: {
+                unsigned numof = gnrc_netapi_batch_numof(msg.content.ptr);
+
+                for (unsigned i = 0; i < numof; i++) {
+                    gnrc_pktbuf_release(gnrc_netapi_batch_get(msg.content.ptr,
+                                                              i));
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                _received += numof;
+                break;
+            }
+#endif
+            default:
+                break;
+        }
+    }
+    return NULL;
+}
+
+static void _init_frame(void)
+{
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)_frame;
+    udp_hdr_t *udp = (udp_hdr_t *)(ipv6 + 1);
+    uint16_t udp_len = sizeof(udp_hdr_t) + TEST_PAYLOAD_LEN;
+    uint16_t csum;
+
+    memset(_frame, 0, sizeof(_frame));
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(udp_len);
+    ipv6->nh = PROTNUM_UDP;
+    ipv6->hl = 64;
+    ipv6->src = ipv6_addr_loopback;
+    ipv6->dst = ipv6_addr_loopback;
+    udp->src_port = byteorder_htons(TEST_PORT + 1);
+    udp->dst_port = byteorder_htons(TEST_PORT);
+    udp->length = byteorder_htons(udp_len);
+    memset(udp + 1, 0xa5, TEST_PAYLOAD_LEN);
+    csum = ipv6_hdr_inet_csum(0, ipv6, PROTNUM_UDP, udp_len);
+    csum = ~inet_csum(csum, (uint8_t *)udp, udp_len);
+    udp->checksum = byteorder_htons((csum == 0) ? 0xffff : csum);
+}
+
+static unsigned _switches(void)
+{
+    unsigned res = 0;
+
+    for (unsigned i = 0; i <= KERNEL_PID_LAST; i++) {
+        res += sched_pidlist[i].schedules;
+    }
+    return res;
+}
+
+/* passes a burst of received packets up the stack like gnrc_netif does */
+static void _inject(unsigned burst)
+{
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    static gnrc_netapi_batch_t batch;
+#endif
+
+    for (unsigned i = 0; i < burst; i++) {
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _frame, sizeof(_frame),
+                                              GNRC_NETTYPE_IPV6);
+
+        if (pkt == NULL) {
+            break;
+        }
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+        if (!gnrc_netapi_batch_dispatch_receive(&batch, GNRC_NETTYPE_IPV6,
+                                                GNRC_NETREG_DEMUX_CTX_ALL,
+                                                pkt)) {
+#else
+        if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6,
+                                          GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+#endif
+            gnrc_pktbuf_release(pkt);
+        }
+    }
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    gnrc_netapi_batch_flush(&batch);
+#endif
+}
+
+int main(void)
+{
+    puts("main starting");
+    _init_frame();
+    thread_create(_sink_stack, sizeof(_sink_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _sink, NULL, "sink");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_bursts); i++) {
+        xtimer_t timer = { .callback = _timer_callback };
+        uint32_t received;
+        unsigned switches;
+
+        _flag = 0;
+        _received = 0;
+        switches = _switches();
+        xtimer_set(&timer, TEST_DURATION);
+        while (!_flag) {
+            /* all stack threads have higher priority, so the burst is
+             * completely handled when this returns */
+            _inject(_bursts[i]);
+        }
+        switches = _switches() - switches;
+        received = _received;
+        /* switches per packet with two decimal places */
+        switches = (received > 0) ? ((100U * switches) / received) : 0;
+        printf("{ \"burst\" : %u, \"result\" : %" PRIu32 ", "
+               "\"switches_per_pkt\" : %u.%02u }\n", _bursts[i], received,
+               switches / 100, switches % 100);
+    }
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the throughput of a bulk transfer over GNRC TCP
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/gnrc/tcp.h"
+#include "shell.h"
+#include "xtimer.h"
+
+#define MAIN_QUEUE_SIZE     (8U)
+#define TEST_PORT           (12345U)
+#define TEST_CHUNK_SIZE     (2048U)
+#define TEST_RECV_TIMEOUT   (10U * US_PER_SEC)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_tcp_tcb_t _tcb;
+static uint8_t _buf[TEST_CHUNK_SIZE];
+
+static int _server_cmd(int argc, char **argv)
+{
+    gnrc_tcp_ep_t local;
+    uint32_t received = 0;
+    ssize_t res;
+
+    (void)argc;
+    (void)argv;
+    gnrc_tcp_ep_from_str(&local, "[::]");
+    local.port = TEST_PORT;
+    gnrc_tcp_tcb_init(&_tcb);
+    puts("server: waiting for connection");
+    if ((res = gnrc_tcp_open_passive(&_tcb, &local)) < 0) {
+        printf("server: open failed (%d)\n", (int)res);
+        return 1;
+    }
+    /* read until the peer closes the connection */
+    while ((res = gnrc_tcp_recv(&_tcb, _buf, sizeof(_buf),
+                                TEST_RECV_TIMEOUT)) > 0) {
+        received += res;
+    }
+    gnrc_tcp_close(&_tcb);
+    printf("{ \"received\" : %" PRIu32 " }\n", received);
+    return (res < 0) ? 1 : 0;
+}
+
+static int _client_cmd(int argc, char **argv)
+{
+    gnrc_tcp_ep_t remote;
+    uint32_t total, sent = 0;
+    uint64_t start, duration;
+    int res;
+
+    if (argc < 3) {
+        printf("usage: %s <[addr%%netif]:port> <bytes>\n", argv[0]);
+        return 1;
+    }
+    if (gnrc_tcp_ep_from_str(&remote, argv[1]) < 0) {
+        puts("client: unable to parse endpoint");
+        return 1;
+    }
+    total = strtoul(argv[2], NULL, 10);
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = i;
+    }
+    gnrc_tcp_tcb_init(&_tcb);
+    if ((res = gnrc_tcp_open_active(&_tcb, &remote, 0)) < 0) {
+        printf("client: open failed (%d)\n", res);
+        return 1;
+    }
+    start = xtimer_now_usec64();
+    while (sent < total) {
+        size_t len = total - sent;
+        ssize_t tmp = gnrc_tcp_send(&_tcb, _buf,
+                                    (len < sizeof(_buf)) ? len : sizeof(_buf),
+                                    0);
+
+        if (tmp < 0) {
+            printf("client: send failed (%d)\n", (int)tmp);
+            gnrc_tcp_abort(&_tcb);
+            return 1;
+        }
+        sent += tmp;
+    }
+    /* returns when all data and the FIN were acknowledged */
+    gnrc_tcp_close(&_tcb);
+    duration = xtimer_now_usec64() - start;
+    printf("{ \"bytes\" : %" PRIu32 ", \"duration_us\" : %" PRIu32 ", "
+           "\"result_kb_per_s\" : %" PRIu32 ", \"cwnd\" : %" PRIu32 ", "
+           "\"ssthresh\" : %" PRIu32 ", \"retransmits\" : %" PRIu32 " }\n",
+           sent, (uint32_t)duration,
+           (uint32_t)(((uint64_t)sent * US_PER_SEC) / (duration * 1024U)),
+           _tcb.cwnd, _tcb.ssthresh, _tcb.retransmits);
+    return 0;
+}
+
+static const shell_command_t _commands[] = {
+    { "server", "receive one bulk transfer on port 12345", _server_cmd },
+    { "client", "send a bulk transfer", _client_cmd },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
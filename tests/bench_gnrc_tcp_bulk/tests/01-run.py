@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+
+from testrunner import run, setup_child, teardown_child
+
+TEST_BYTES = 256 * 1024
+CLIENT_TAP = os.environ.get("CLIENT_TAP", "tap1")
+
+
+def get_link_local(child):
+    child.sendline("ifconfig")
+    child.expect(r"Iface\s+(\d+)\s")
+    iface = child.match.group(1)
+    child.expect(r"inet6 addr:\s+(fe80:[0-9a-f:]+)\s")
+    return iface, child.match.group(1)
+
+
+def testfunc(server):
+    _, addr = get_link_local(server)
+    server.sendline("server")
+    server.expect_exact("server: waiting for connection")
+
+    env = os.environ.copy()
+    env["PORT"] = CLIENT_TAP
+    client = setup_child(timeout=60, env=env)
+    try:
+        iface, _ = get_link_local(client)
+        client.sendline("client [{}%{}]:12345 {}".format(addr, iface,
+                                                         TEST_BYTES))
+        client.expect(r"{ \"bytes\" : (\d+), \"duration_us\" : \d+, "
+                      r"\"result_kb_per_s\" : \d+, \"cwnd\" : \d+, "
+                      r"\"ssthresh\" : \d+, \"retransmits\" : \d+ }")
+        assert int(client.match.group(1)) == TEST_BYTES
+    finally:
+        teardown_child(client)
+    server.expect(r"{ \"received\" : (\d+) }")
+    assert int(server.match.group(1)) == TEST_BYTES
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the throughput of SHA-256 when hashing a firmware
+ *              image sized input in chunks of different sizes
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "hashes/sha256.h"
+#include "kernel_defines.h"
+#include "macros/units.h"
+#include "xtimer.h"
+
+#ifndef TEST_IMAGE_SIZE
+/* number of bytes to hash per measurement */
+#define TEST_IMAGE_SIZE     (512U * 1024U)
+#endif
+
+#define TEST_CHUNK_MAX      (4096U)
+
+/* 64 bytes is a single block per update, 4096 bytes is a typical flash page or
+ * the buffer of a firmware update */
+static const uint16_t _chunks[] = { 64, 256, 4096 };
+static uint8_t _buf[TEST_CHUNK_MAX];
+static uint8_t _digest[SHA256_DIGEST_LENGTH];
+
+static void _bench(uint16_t chunk)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256_context_t ctx;
+    uint32_t start, time;
+
+    start = xtimer_now_usec();
+    sha256_init(&ctx);
+    /* the image is the buffer repeated, independent of the chunk size */
+    for (unsigned offset = 0; offset < TEST_IMAGE_SIZE; offset += chunk) {
+        sha256_update(&ctx, &_buf[offset % TEST_CHUNK_MAX], chunk);
+    }
+    sha256_final(&ctx, digest);
+    time = xtimer_now_usec() - start;
+    if (time == 0) {
+        time = 1;
+    }
+    if (chunk == _chunks[0]) {
+        memcpy(_digest, digest, sizeof(_digest));
+    }
+    else if (memcmp(_digest, digest, sizeof(_digest)) != 0) {
+        printf("{ \"chunk\" : %u, \"error\" : \"wrong digest\" }\n", chunk);
+        return;
+    }
+    /* bytes per millisecond, i.e. kB/s */
+    printf("{ \"chunk\" : %u, \"result\" : %" PRIu32, chunk,
+           (uint32_t)(((uint64_t)TEST_IMAGE_SIZE * US_PER_MS) / time));
+#ifdef CLOCK_CORECLOCK
+    printf(", \"bytes_per_kcycle\" : %" PRIu32,
+           (uint32_t)(((uint64_t)TEST_IMAGE_SIZE * 1000U) /
+                      ((uint64_t)time * (CLOCK_CORECLOCK / MHZ(1)))));
+#endif
+    puts(" }");
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = (uint8_t)((i * 167) + 13);
+    }
+    puts("main starting");
+    for (unsigned i = 0; i < ARRAY_SIZE(_chunks); i++) {
+        _bench(_chunks[i]);
+    }
+    puts("done");
+    return 0;
+}
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+CHUNKS = (64, 256, 4096)
+
+
+def testfunc(child):
+    child.expect_exact("main starting")
+    for chunk in CHUNKS:
+        child.expect(r"{{ \"chunk\" : {}, \"result\" : \d+"
+                     r"(, \"bytes_per_kcycle\" : \d+)? }}".format(chunk))
+    child.expect_exact("done")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the throughput of the Internet checksum for different
+ *              buffer sizes and alignments
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "macros/units.h"
+#include "net/inet_csum.h"
+#include "xtimer.h"
+
+#ifndef TEST_BYTES
+/* number of bytes to checksum per measurement */
+#define TEST_BYTES          (256U * 1024U)
+#endif
+
+#define TEST_ALIGN_MAX      (4U)
+
+static const uint16_t _sizes[] = { 8, 20, 64, 127, 256, 1280 };
+static uint8_t _buf[1280 + TEST_ALIGN_MAX];
+
+static uint16_t _csum_bytewise(const uint8_t *buf, size_t len)
+{
+    uint32_t csum = 0;
+
+    for (unsigned i = 0; i < len; i++) {
+        csum += (i & 1) ? buf[i] : (buf[i] << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void _bench(uint16_t size, unsigned align)
+{
+    const uint8_t *buf = &_buf[align];
+    unsigned iterations = TEST_BYTES / size;
+    uint64_t bytes = (uint64_t)iterations * size;
+    volatile uint16_t sum = 0;
+    uint32_t start, time;
+
+    if (inet_csum(0, buf, size) != _csum_bytewise(buf, size)) {
+        printf("{ \"size\" : %u, \"align\" : %u, \"error\" : \"wrong checksum\" }\n",
+               size, align);
+        return;
+    }
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < iterations; i++) {
+        sum = inet_csum(sum, buf, size);
+    }
+    time = xtimer_now_usec() - start;
+    if (time == 0) {
+        time = 1;
+    }
+    /* bytes per millisecond */
+    printf("{ \"size\" : %u, \"align\" : %u, \"result\" : %" PRIu32,
+           size, align, (uint32_t)((bytes * US_PER_MS) / time));
+#ifdef CLOCK_CORECLOCK
+    printf(", \"bytes_per_kcycle\" : %" PRIu32,
+           (uint32_t)((bytes * 1000U) /
+                      ((uint64_t)time * (CLOCK_CORECLOCK / MHZ(1)))));
+#endif
+    puts(" }");
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = (uint8_t)((i * 167) + 13);
+    }
+    puts("main starting");
+    for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+        for (unsigned align = 0; align < TEST_ALIGN_MAX; align++) {
+            _bench(_sizes[i], align);
+        }
+    }
+    puts("done");
+    return 0;
+}
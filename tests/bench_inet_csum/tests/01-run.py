@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+SIZES = (8, 20, 64, 127, 256, 1280)
+ALIGN_MAX = 4
+
+
+def testfunc(child):
+    child.expect_exact("main starting")
+    for size in SIZES:
+        for align in range(ALIGN_MAX):
+            child.expect(r"{{ \"size\" : {}, \"align\" : {}, \"result\" : \d+"
+                         r"(, \"bytes_per_kcycle\" : \d+)? }}"
+                         .format(size, align))
+    child.expect_exact("done")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
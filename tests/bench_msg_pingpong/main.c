@@ -11,7 +11,8 @@
  * @{
  *
  * @file
- * @brief       Measure messages send per second
+ * @brief       Measure messages send per second, from one and from multiple
+ *              senders
  *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  *
@@ -29,8 +30,25 @@
 #define TEST_DURATION       (1000000U)
 #endif
 
+#ifndef SENDERS_NUMOF
+#define SENDERS_NUMOF       (3U)
+#endif
+
+#ifndef IRQ_PERIOD
+#define IRQ_PERIOD          (1000U)
+#endif
+
+#define SINK_QUEUE_SIZE     (8U)
+
 volatile unsigned _flag = 0;
 static char _stack[THREAD_STACKSIZE_MAIN];
+static char _sink_stack[THREAD_STACKSIZE_DEFAULT];
+static char _sender_stacks[SENDERS_NUMOF][THREAD_STACKSIZE_DEFAULT];
+static kernel_pid_t _sink_pid;
+static volatile uint32_t _received = 0;
+static xtimer_t _irq_timer;
+static uint32_t _irq_target;
+static uint32_t _irq_latency_max = 0;
 
 static void _timer_callback(void*arg)
 {
@@ -51,6 +69,77 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+static void *_sink(void *arg)
+{
+    (void)arg;
+    msg_t test, queue[SINK_QUEUE_SIZE];
+
+#if IS_USED(MODULE_CORE_MSG_LOCKFREE)
+    msg_init_queue_lockfree(queue, SINK_QUEUE_SIZE);
+#else
+    msg_init_queue(queue, SINK_QUEUE_SIZE);
+#endif
+    while(1) {
+        msg_receive(&test);
+        _received++;
+    }
+
+    return NULL;
+}
+
+static void *_sender(void *arg)
+{
+    (void)arg;
+    msg_t test;
+
+    while(!_flag) {
+        msg_send(&test, _sink_pid);
+        /* let the other senders and the receiver of same priority run */
+        thread_yield();
+    }
+
+    return NULL;
+}
+
+static void _irq_callback(void *arg)
+{
+    (void)arg;
+    uint32_t now = xtimer_now_usec();
+    msg_t test;
+
+    if ((now - _irq_target) > _irq_latency_max) {
+        _irq_latency_max = now - _irq_target;
+    }
+    msg_send_int(&test, _sink_pid);
+    _irq_target = now + IRQ_PERIOD;
+    xtimer_set(&_irq_timer, IRQ_PERIOD);
+}
+
+static void _multiple_senders(void)
+{
+    _flag = 0;
+    _sink_pid = thread_create(_sink_stack, sizeof(_sink_stack),
+                              (THREAD_PRIORITY_MAIN + 1),
+                              THREAD_CREATE_STACKTEST, _sink, NULL, "sink");
+    for (unsigned i = 0; i < SENDERS_NUMOF; i++) {
+        thread_create(_sender_stacks[i], sizeof(_sender_stacks[i]),
+                      (THREAD_PRIORITY_MAIN + 1), THREAD_CREATE_STACKTEST,
+                      _sender, NULL, "sender");
+    }
+
+    _irq_timer.callback = _irq_callback;
+    _irq_target = xtimer_now_usec() + IRQ_PERIOD;
+    xtimer_set(&_irq_timer, IRQ_PERIOD);
+    /* the senders and the receiver only run while main sleeps */
+    xtimer_usleep(TEST_DURATION);
+    _flag = 1;
+    xtimer_remove(&_irq_timer);
+
+    printf("{ \"senders\" : %u, \"result\" : %"PRIu32", "
+           "\"irq_latency_max_us\" : %"PRIu32" }\n", SENDERS_NUMOF, _received,
+           _irq_latency_max);
+}
+
 int main(void)
 {
     printf("main starting\n");
@@ -83,5 +172,7 @@ int main(void)
 #endif
     puts(" }");
 
+    _multiple_senders();
+
     return 0;
 }
@@ -13,6 +13,8 @@ from testrunner import run
 
 def testfunc(child):
     child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    child.expect(r"{ \"senders\" : \d+, \"result\" : \d+, "
+                 r"\"irq_latency_max_us\" : \d+ }")
 
 
 if __name__ == "__main__":
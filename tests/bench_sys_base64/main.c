@@ -27,7 +27,71 @@
 
 #define MIN(a, b) (a < b) ? a : b
 
+#ifndef THROUGHPUT_SIZE
+/* number of bytes to encode per run of the throughput benchmark, must be a
+ * multiple of 3 */
+#define THROUGHPUT_SIZE     (768U)
+#endif
+#define THROUGHPUT_RUNS     (1000U)
+
 static char buf[128];
+static uint8_t data[THROUGHPUT_SIZE];
+static char encoded[THROUGHPUT_SIZE / 3 * 4];
+static uint8_t decoded[THROUGHPUT_SIZE + 3];
+
+typedef int (*encode_func_t)(const void *, size_t, void *, size_t *);
+
+static void print_throughput(const char *name, uint32_t time)
+{
+    char tmp[16];
+    /* bytes per millisecond equal kB/s, print as MB/s with three decimals */
+    uint32_t bytes_per_ms = ((uint64_t)THROUGHPUT_SIZE * THROUGHPUT_RUNS * 1000)
+                          / (time ? time : 1);
+
+    print_str(name);
+    print_str(": ");
+    print(tmp, fmt_s32_dfp(tmp, bytes_per_ms, -3));
+    print_str(" MB/s\n");
+}
+
+static void bench_throughput(const char *encode_name, encode_func_t encode,
+                             const char *decode_name)
+{
+    uint32_t start, stop;
+    size_t size;
+
+    size = sizeof(encoded);
+    if ((BASE64_SUCCESS != encode(data, sizeof(data), encoded, &size)) ||
+        (size != sizeof(encoded))) {
+        print_str(encode_name);
+        print_str(": FAIL\n");
+        return;
+    }
+    size = sizeof(decoded);
+    if ((BASE64_SUCCESS != base64_decode(encoded, sizeof(encoded), decoded,
+                                         &size)) ||
+        (size != sizeof(data)) || (0 != memcmp(data, decoded, sizeof(data)))) {
+        print_str(decode_name);
+        print_str(": FAIL\n");
+        return;
+    }
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < THROUGHPUT_RUNS; i++) {
+        size = sizeof(encoded);
+        encode(data, sizeof(data), encoded, &size);
+    }
+    stop = xtimer_now_usec();
+    print_throughput(encode_name, stop - start);
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < THROUGHPUT_RUNS; i++) {
+        size = sizeof(decoded);
+        base64_decode(encoded, sizeof(encoded), decoded, &size);
+    }
+    stop = xtimer_now_usec();
+    print_throughput(decode_name, stop - start);
+}
 
 static const char input[96] = "This is an extremely, enormously, greatly, "
                               "immensely, tremendously, remarkably lengthy "
@@ -95,5 +159,13 @@ int main(void) {
     print_str("Decoding 1.000 x 96 bytes (128 bytes in base64): ");
     print_u32_dec(stop - start);
     print_str(" µs\n");
+
+    /* throughput for payloads that use all symbols of the alphabets */
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)((i * 167) + 13);
+    }
+    bench_throughput("base64 encode", base64_encode, "base64 decode");
+    bench_throughput("base64url encode", base64url_encode,
+                     "base64url decode");
     return 0;
 }
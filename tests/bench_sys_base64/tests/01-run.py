@@ -15,6 +15,9 @@ def testfunc(child):
     child.expect_exact("Verifying that base64 decoding works for benchmark input: OK\r\n")
     child.expect(r"Encoding 1\.000 x 96 bytes \(128 bytes in base64\): [0-9]+ µs\r\n")
     child.expect(r"Decoding 1\.000 x 96 bytes \(128 bytes in base64\): [0-9]+ µs\r\n")
+    for alphabet in ("base64", "base64url"):
+        for op in ("encode", "decode"):
+            child.expect(r"{} {}: [0-9]+\.[0-9]{{3}} MB/s\r\n".format(alphabet, op))
 
 
 if __name__ == "__main__":
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the cost of setting, removing, and firing ztimers with
+ *              many timers set on a clock
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "ztimer.h"
+
+/* number of set or remove operations measured per number of timers */
+#ifndef TEST_OPS
+#define TEST_OPS            (10000U)
+#endif
+
+/* timers set for measuring set and remove must not fire before they are
+ * removed again */
+#define TEST_SET_MIN        (1000000U)
+#define TEST_SET_SPREAD     (0xfffffU)
+/* time until the timers fire in the fire measurement */
+#define TEST_FIRE_DELAY     (20000U)
+
+static const unsigned _numofs[] = { 10, 100, 1000 };
+static ztimer_t _timers[1000];
+static volatile unsigned _fired;
+static volatile uint32_t _last_fired;
+static uint32_t _seed = 0x12345678;
+
+static uint32_t _rand(void)
+{
+    /* xorshift32 */
+    _seed ^= _seed << 13;
+    _seed ^= _seed >> 17;
+    _seed ^= _seed << 5;
+    return _seed;
+}
+
+static void _cb(void *arg)
+{
+    (void)arg;
+    _fired++;
+    _last_fired = ztimer_now(ZTIMER_USEC);
+}
+
+/* converts the µs a number of operations took to ns per operation */
+static unsigned long _ns_per_op(uint32_t usec, unsigned ops)
+{
+    return ((uint64_t)usec * 1000U) / ops;
+}
+
+static void _bench(unsigned numof)
+{
+    unsigned rounds = TEST_OPS / numof;
+    uint32_t set = 0, remove = 0, start, target;
+
+    for (unsigned i = 0; i < numof; i++) {
+        _timers[i] = (ztimer_t){ .callback = _cb };
+    }
+    for (unsigned r = 0; r < rounds; r++) {
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned i = 0; i < numof; i++) {
+            ztimer_set(ZTIMER_USEC, &_timers[i],
+                       TEST_SET_MIN + (_rand() & TEST_SET_SPREAD));
+        }
+        set += ztimer_now(ZTIMER_USEC) - start;
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned i = 0; i < numof; i++) {
+            ztimer_remove(ZTIMER_USEC, &_timers[i]);
+        }
+        remove += ztimer_now(ZTIMER_USEC) - start;
+    }
+
+    /* all timers expire at once, so the time from their target time until
+     * the last callback is the cost of firing them */
+    _fired = 0;
+    target = ztimer_now(ZTIMER_USEC) + TEST_FIRE_DELAY;
+    for (unsigned i = 0; i < numof; i++) {
+        ztimer_set(ZTIMER_USEC, &_timers[i],
+                   target - ztimer_now(ZTIMER_USEC));
+    }
+    while (_fired < numof) {}
+
+    printf("{ \"timers\" : %u, \"set_ns\" : %lu, \"remove_ns\" : %lu, "
+           "\"fire_ns\" : %lu }\n", numof, _ns_per_op(set, rounds * numof),
+           _ns_per_op(remove, rounds * numof),
+           _ns_per_op(_last_fired - target, numof));
+}
+
+int main(void)
+{
+    puts("main starting");
+    for (unsigned i = 0; i < ARRAY_SIZE(_numofs); i++) {
+        _bench(_numofs[i]);
+    }
+    puts("SUCCESS");
+    return 0;
+}
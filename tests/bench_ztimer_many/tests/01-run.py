@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for timers in (10, 100, 1000):
+        child.expect(r"{ \"timers\" : %d, \"set_ns\" : \d+, "
+                     r"\"remove_ns\" : \d+, \"fire_ns\" : \d+ }" % timers)
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for priority event queues
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "event/prio.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#define EVENTS_NUMOF    (6U)
+#define STACKSIZE       (THREAD_STACKSIZE_DEFAULT)
+#define PRIO            (THREAD_PRIORITY_MAIN - 1)
+
+static void _handler(event_t *event);
+static void _post_urgent(event_t *event);
+
+static char _stack[STACKSIZE];
+static event_prio_queue_t _queue;
+static event_prio_queue_t _thread_queue = EVENT_PRIO_QUEUE_INIT_DETACHED;
+static event_prio_t _events[EVENTS_NUMOF];
+static event_prio_t _urgent_poster = EVENT_PRIO_INIT(_post_urgent);
+static unsigned _order[2 * EVENTS_NUMOF];
+static unsigned _handled;
+
+static void _handler(event_t *event)
+{
+    event_prio_t *ev = container_of(event, event_prio_t, super);
+
+    _order[_handled++] = ev - _events;
+}
+
+static void _post_urgent(event_t *event)
+{
+    (void)event;
+    /* must be handled before the events already queued in lane 2 */
+    event_prio_post(&_queue, &_events[5], 0);
+}
+
+static void _expect_order(const unsigned *order, unsigned numof)
+{
+    expect(_handled == numof);
+    for (unsigned i = 0; i < numof; i++) {
+        expect(_order[i] == order[i]);
+    }
+    _handled = 0;
+}
+
+static void test_priorities(void)
+{
+    static const unsigned order[] = { 2, 1, 3, 0, 4 };
+
+    event_prio_post(&_queue, &_events[0], 3);
+    event_prio_post(&_queue, &_events[1], 1);
+    event_prio_post(&_queue, &_events[2], 0);
+    event_prio_post(&_queue, &_events[3], 1);
+    event_prio_post(&_queue, &_events[4], CONFIG_EVENT_PRIO_NUMOF - 1);
+    /* posting a queued event has no effect, not even on its lane */
+    event_prio_post(&_queue, &_events[1], 0);
+
+    expect(event_prio_drain(&_queue, SIZE_MAX) == ARRAY_SIZE(order));
+    _expect_order(order, ARRAY_SIZE(order));
+    expect(event_prio_get(&_queue) == NULL);
+    puts("priorities: OK");
+}
+
+static void test_cancel(void)
+{
+    static const unsigned order[] = { 4, 1, 3 };
+
+    for (unsigned i = 0; i < 4; i++) {
+        event_prio_post(&_queue, &_events[i], 2);
+    }
+    event_prio_post(&_queue, &_events[4], 1);
+    /* first, last and middle of a lane */
+    event_prio_cancel(&_queue, &_events[0]);
+    event_prio_cancel(&_queue, &_events[2]);
+    /* not queued */
+    event_prio_cancel(&_queue, &_events[5]);
+    /* only event of a lane */
+    event_prio_post(&_queue, &_events[5], 0);
+    event_prio_cancel(&_queue, &_events[5]);
+
+    expect(event_prio_drain(&_queue, SIZE_MAX) == ARRAY_SIZE(order));
+    _expect_order(order, ARRAY_SIZE(order));
+
+    /* cancelled events can be posted again */
+    event_prio_post(&_queue, &_events[0], 0);
+    expect(event_prio_get(&_queue) == &_events[0]);
+    expect(event_prio_get(&_queue) == NULL);
+    puts("cancel: OK");
+}
+
+static void test_drain(void)
+{
+    static const unsigned order[] = { 5, 0, 1, 2, 3 };
+
+    event_prio_post(&_queue, &_urgent_poster, 1);
+    for (unsigned i = 0; i < 4; i++) {
+        event_prio_post(&_queue, &_events[i], 2);
+    }
+
+    /* the event posted by _urgent_poster is handled right after it */
+    expect(event_prio_drain(&_queue, 4) == 4);
+    _expect_order(&order[0], 3);
+    expect(event_prio_drain(&_queue, 4) == 2);
+    _expect_order(&order[3], 2);
+    expect(event_prio_drain(&_queue, 4) == 0);
+    puts("drain: OK");
+}
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+    event_prio_queue_claim(&_thread_queue);
+    event_prio_loop(&_thread_queue);
+    return NULL;
+}
+
+static void test_loop(void)
+{
+    static const unsigned order[] = { 3, 4 };
+
+    thread_create(_stack, sizeof(_stack), PRIO, THREAD_CREATE_STACKTEST,
+                  _thread, NULL, "event_prio");
+    /* the thread has a higher priority, it handles each event right away */
+    event_prio_post(&_thread_queue, &_events[3], 2);
+    event_prio_post(&_thread_queue, &_events[4], 0);
+    _expect_order(order, ARRAY_SIZE(order));
+    puts("loop: OK");
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        _events[i] = (event_prio_t)EVENT_PRIO_INIT(_handler);
+    }
+    event_prio_queue_init(&_queue);
+
+    test_priorities();
+    test_cancel();
+    test_drain();
+    test_loop();
+
+    puts("[SUCCESS]");
+    return 0;
+}
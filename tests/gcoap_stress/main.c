@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Stress test for gcoap with thousands of concurrent confirmable
+ *              requests
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "mutex.h"
+#include "net/gcoap.h"
+#include "net/ipv6/addr.h"
+#include "net/nanocoap_sock.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifndef TEST_CONCURRENCY_MAX
+#define TEST_CONCURRENCY_MAX    (1024U)
+#endif
+
+#ifndef TEST_REQUESTS
+#define TEST_REQUESTS           (4096U)
+#endif
+
+#define TEST_SERVER_PORT        (5684U)
+#define TEST_PATH               "/stress"
+
+static const unsigned _concurrency[] = { 16, 256, TEST_CONCURRENCY_MAX };
+static char _server_stack[THREAD_STACKSIZE_DEFAULT];
+static uint8_t _server_buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+static mutex_t _round_done = MUTEX_INIT_LOCKED;
+static unsigned _pending;
+static unsigned _failed;
+
+static ssize_t _stress_handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                               void *context)
+{
+    (void)context;
+    return coap_reply_simple(pkt, COAP_CODE_205, buf, len, COAP_FORMAT_TEXT,
+                             NULL, 0);
+}
+
+/* resources of the nanocoap server */
+const coap_resource_t coap_resources[] = {
+    { TEST_PATH, COAP_GET, _stress_handler, NULL },
+};
+
+const unsigned coap_resources_numof = ARRAY_SIZE(coap_resources);
+
+static void *_server(void *arg)
+{
+    sock_udp_ep_t local = { .family = AF_INET6, .port = TEST_SERVER_PORT };
+
+    (void)arg;
+    nanocoap_server(&local, _server_buf, sizeof(_server_buf));
+    return NULL;
+}
+
+/* called in the gcoap thread */
+static void _resp_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
+                          const sock_udp_ep_t *remote)
+{
+    (void)remote;
+
+    if ((memo->state != GCOAP_MEMO_RESP) ||
+        (coap_get_code_class(pdu) != COAP_CLASS_SUCCESS)) {
+        _failed++;
+    }
+    if (--_pending == 0) {
+        mutex_unlock(&_round_done);
+    }
+}
+
+/* sends one round of concurrent requests; returns the number sent */
+static unsigned _send_round(const sock_udp_ep_t *remote, unsigned numof)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+    unsigned sent = 0;
+
+    /* the server has lower priority, so all requests are queued at its
+     * socket before the first response is sent */
+    _pending = numof;
+    for (unsigned i = 0; i < numof; i++) {
+        gcoap_req_init(&pdu, buf, sizeof(buf), COAP_METHOD_GET, TEST_PATH);
+        coap_hdr_set_type(pdu.hdr, COAP_TYPE_CON);
+        ssize_t len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+
+        if (gcoap_req_send(buf, len, remote, _resp_handler, NULL) == 0) {
+            break;
+        }
+        sent++;
+    }
+    /* the gcoap thread only accesses _pending in _resp_handler, and those
+     * calls can only start once this thread blocks */
+    _failed += numof - sent;
+    _pending -= numof - sent;
+    if (_pending > 0) {
+        mutex_lock(&_round_done);
+    }
+    return sent;
+}
+
+int main(void)
+{
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = TEST_SERVER_PORT };
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    puts("main starting");
+    thread_create(_server_stack, sizeof(_server_stack), THREAD_PRIORITY_MAIN + 1,
+                  THREAD_CREATE_STACKTEST, _server, NULL, "nanocoap");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_concurrency); i++) {
+        unsigned requests = 0;
+        uint32_t start, duration;
+
+        _failed = 0;
+        start = xtimer_now_usec();
+        while (requests < TEST_REQUESTS) {
+            unsigned sent = _send_round(&remote, _concurrency[i]);
+
+            if (sent == 0) {
+                break;
+            }
+            requests += sent;
+        }
+        duration = xtimer_now_usec() - start;
+        /* requests per second */
+        printf("{ \"concurrent\" : %u, \"requests\" : %u, \"result\" : %"
+               PRIu32 ", \"failed\" : %u }\n", _concurrency[i], requests,
+               (uint32_t)(((uint64_t)requests * US_PER_SEC) / duration),
+               _failed);
+    }
+    return 0;
+}
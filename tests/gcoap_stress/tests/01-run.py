@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for concurrent in (16, 256, 1024):
+        child.expect(r"{ \"concurrent\" : %d, \"requests\" : (\d+), "
+                     r"\"result\" : \d+, \"failed\" : (\d+) }" % concurrent,
+                     timeout=120)
+        assert int(child.match.group(1)) >= 4096
+        assert int(child.match.group(2)) == 0
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import socket
+import sys
+
+from scapy.all import Ether, IPv6, TCP, sendp, srp1
+from testrunner import run
+
+from shared_func import sudo_guard, get_host_tap_device, get_host_ll_addr, \
+                        get_riot_l2_addr, get_riot_ll_addr, \
+                        generate_port_number, verify_pktbuf_empty
+
+TS_VAL = 0x12345678
+
+
+def testfunc(func):
+    def runner(child):
+        tap = get_host_tap_device()
+        host_ll = get_host_ll_addr(tap)
+        dst_ll = get_riot_ll_addr(child)
+        dst_l2 = get_riot_l2_addr(child)
+        port = generate_port_number()
+
+        # Setup RIOT Node wait for incoming connections from host system
+        child.sendline('gnrc_tcp_tcb_init')
+        child.expect_exact('gnrc_tcp_tcb_init: argc=1, argv[0] = gnrc_tcp_tcb_init')
+        child.sendline('gnrc_tcp_open_passive [::]:{}'.format(port))
+        child.expect(r'gnrc_tcp_open_passive: argc=2, '
+                     r'argv\[0\] = gnrc_tcp_open_passive, '
+                     r'argv\[1\] = \[::\]:(\d+)\r\n')
+        assert int(child.match.group(1)) == port
+
+        try:
+            print("- {} ".format(func.__name__), end="")
+            if child.logfile == sys.stdout:
+                func(child, tap, host_ll, dst_l2, dst_ll, port)
+                print("")
+            else:
+                try:
+                    func(child, tap, host_ll, dst_l2, dst_ll, port)
+                    print("SUCCESS")
+                except Exception as e:
+                    print("FAILED")
+                    raise e
+        finally:
+            child.sendline('gnrc_tcp_close')
+
+    return runner
+
+
+def send_syn(child, src_if, src_ll, dst_l2, dst_ll, dst_port, options):
+    syn = TCP(dport=dst_port, sport=2342, flags="S", seq=1, options=options)
+    syn_ack = srp1(Ether(dst=dst_l2) / IPv6(src=src_ll, dst=dst_ll) / syn,
+                   iface=src_if, timeout=child.timeout, verbose=0)
+    assert syn_ack is not None
+    assert syn_ack[TCP].flags == "SA"
+
+    # Abort the handshake, the node returns to LISTEN
+    sendp(Ether(dst=dst_l2) / IPv6(src=src_ll, dst=dst_ll) /
+          TCP(dport=dst_port, sport=2342, flags="R", seq=2),
+          iface=src_if, verbose=0)
+    return dict(syn_ack[TCP].options)
+
+
+def verify_server_works(child, src_if, dst_ll, dst_port):
+    with socket.socket(socket.AF_INET6, socket.SOCK_STREAM) as sock:
+        sock.settimeout(child.timeout)
+        addr_info = socket.getaddrinfo(dst_ll + '%' + src_if, dst_port,
+                                       type=socket.SOCK_STREAM)
+        sock.connect(addr_info[0][-1])
+        child.expect_exact('gnrc_tcp_open_passive: returns 0')
+    verify_pktbuf_empty(child)
+
+
+@testfunc
+def test_options_negotiated(child, src_if, src_ll, dst_l2, dst_ll, dst_port):
+    options = send_syn(child, src_if, src_ll, dst_l2, dst_ll, dst_port,
+                       [('MSS', 1220), ('NOP', None), ('WScale', 7),
+                        ('Timestamp', (TS_VAL, 0))])
+    assert 'MSS' in options
+    assert 'WScale' in options
+    assert 'Timestamp' in options
+    assert options['Timestamp'][1] == TS_VAL
+    verify_server_works(child, src_if, dst_ll, dst_port)
+
+
+@testfunc
+def test_options_not_offered(child, src_if, src_ll, dst_l2, dst_ll, dst_port):
+    options = send_syn(child, src_if, src_ll, dst_l2, dst_ll, dst_port,
+                       [('MSS', 1220)])
+    assert 'MSS' in options
+    assert 'WScale' not in options
+    assert 'Timestamp' not in options
+    verify_server_works(child, src_if, dst_ll, dst_port)
+
+
+@testfunc
+def test_invalid_option_length(child, src_if, src_ll, dst_l2, dst_ll, dst_port):
+    # Window scale option with a length of 4 must be dropped
+    syn = TCP(dport=dst_port, sport=2342, flags="S", seq=1, dataofs=6)
+    sendp(Ether(dst=dst_l2) / IPv6(src=src_ll, dst=dst_ll) / syn /
+          b"\x03\x04\x07\x00", iface=src_if, verbose=0)
+    verify_server_works(child, src_if, dst_ll, dst_port)
+
+
+if __name__ == "__main__":
+    sudo_guard(uses_scapy=True)
+    script = sys.modules[__name__]
+    tests = [getattr(script, t) for t in script.__dict__
+             if type(getattr(script, t)).__name__ == "function"
+             and t.startswith("test_")]
+    for test in tests:
+        res = run(test, timeout=10, echo=False)
+        if res != 0:
+            sys.exit(res)
+    print(os.path.basename(sys.argv[0]) + ": success\n")
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Test for a sender preempted between reserving and publishing its
+ *          slot in a lock-free message queue
+ *
+ * The main thread reserves a queue slot the way a sender does before it
+ * writes the message, and is then preempted by a higher priority sender. The
+ * messages published behind the reserved slot must still be received.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+
+#define QUEUE_SIZE      (4U)
+
+static msg_t _queue[QUEUE_SIZE];
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static kernel_pid_t _main_pid;
+
+static void *_sender(void *arg)
+{
+    unsigned *values = arg;
+
+    for (unsigned i = 1; i <= values[0]; i++) {
+        msg_t m = { .content.value = values[i] };
+
+        msg_send(&m, _main_pid);
+    }
+    return NULL;
+}
+
+static void _start_sender(unsigned *values, uint8_t prio)
+{
+    thread_create(_stack, sizeof(_stack), prio, THREAD_CREATE_STACKTEST,
+                  _sender, values, "sender");
+}
+
+static int _expect(int res, uint32_t value)
+{
+    msg_t m;
+
+    if (msg_try_receive(&m) != res) {
+        printf("FAILURE: expected %s\n", (res == 1) ? "message" : "none");
+        return 0;
+    }
+    if ((res == 1) && (m.content.value != value)) {
+        printf("FAILURE: got %" PRIu32 ", expected %" PRIu32 "\n",
+               m.content.value, value);
+        return 0;
+    }
+    return 1;
+}
+
+int main(void)
+{
+    static unsigned first[] = { 2, 1, 2 };
+    static unsigned second[] = { 1, 3 };
+    thread_t *me = thread_get_active();
+    msg_t m;
+
+    _main_pid = thread_getpid();
+    msg_init_queue_lockfree(_queue, QUEUE_SIZE);
+
+    /* reserve slot 0 like a sender does before writing its message ... */
+    unsigned reserved = me->msg_queue.write_count++;
+
+    /* ... and get preempted by a higher priority sender */
+    _start_sender(first, THREAD_PRIORITY_MAIN - 1);
+    puts("preempted");
+    if (!_expect(1, 1) || !_expect(1, 2) || !_expect(-1, 0)) {
+        return 1;
+    }
+
+    /* a receiver blocked behind the unpublished slot is woken up */
+    _start_sender(second, THREAD_PRIORITY_MAIN + 1);
+    msg_receive(&m);
+    if (m.content.value != 3) {
+        printf("FAILURE: got %" PRIu32 ", expected 3\n", m.content.value);
+        return 1;
+    }
+    puts("woken up");
+
+    /* the preempted sender publishes its message */
+    msg_t *slot = &_queue[reserved & (QUEUE_SIZE - 1)];
+    slot->content.value = 0;
+    slot->sender_pid = _main_pid;
+    if (!_expect(1, 0) || !_expect(-1, 0)) {
+        return 1;
+    }
+    if (msg_avail() != 0) {
+        puts("FAILURE: queue not empty");
+        return 1;
+    }
+
+    /* all slots are usable again */
+    for (unsigned i = 0; i < QUEUE_SIZE; i++) {
+        m.content.value = 10 + i;
+        if (msg_send_to_self(&m) != 1) {
+            puts("FAILURE: queue full");
+            return 1;
+        }
+    }
+    if (msg_send_to_self(&m) != 0) {
+        puts("FAILURE: queue overflow");
+        return 1;
+    }
+    for (unsigned i = 0; i < QUEUE_SIZE; i++) {
+        if (!_expect(1, 10 + i)) {
+            return 1;
+        }
+    }
+
+    puts("SUCCESS");
+    return 0;
+}
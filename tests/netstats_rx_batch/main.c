@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the receive batching of netdev_tap
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "irq.h"
+#include "shell.h"
+#include "shell_commands.h"
+#include "xtimer.h"
+
+static int _rx_hold(int argc, char **argv)
+{
+    if (argc < 2) {
+        printf("usage: %s <ms>\n", argv[0]);
+        return 1;
+    }
+
+    uint32_t duration = (uint32_t)atoi(argv[1]) * US_PER_MS;
+
+    puts("rx_hold: start");
+    /* frames arriving in the meantime stay pending on the TAP and are all
+     * received when the single (deferred) SIGIO is handled */
+    unsigned state = irq_disable();
+    uint32_t start = xtimer_now_usec();
+    while ((xtimer_now_usec() - start) < duration) {}
+    irq_restore(state);
+    puts("rx_hold: done");
+    return 0;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "rx_hold", "block interrupts for <ms> milliseconds", _rx_hold },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
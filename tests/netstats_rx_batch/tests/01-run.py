@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import socket
+import sys
+
+from testrunner import run
+
+RX_BATCH_MAX = int(os.environ.get("RX_BATCH_MAX", 8))
+# enough frames to hit the limit several times and leave a partial batch
+FRAMES = (3 * RX_BATCH_MAX) + 2
+# IEEE 802 local experimental EtherType, dropped by GNRC
+ETHERTYPE = b"\x88\xb5"
+
+
+def get_riot_if(child):
+    child.sendline("ifconfig")
+    child.expect(r"Iface\s+(\d+)\s")
+    iface = child.match.group(1)
+    child.expect(r"HWaddr: ([A-Fa-f0-9:]+)\s")
+    return iface, bytes.fromhex(child.match.group(1).replace(":", ""))
+
+
+def get_rx_batch_stats(child, iface):
+    child.sendline("ifconfig {} stats rxbatch".format(iface))
+    child.expect(r"Events (\d+)  frames (\d+) \(max\. (\d+) per event\)")
+    events, frames, frames_max = (int(g) for g in child.match.groups())
+    child.expect(r"Limit reached (\d+)")
+    return events, frames, frames_max, int(child.match.group(1))
+
+
+def testfunc(child):
+    iface, riot_l2 = get_riot_if(child)
+    frame = riot_l2 + b"\x02\x00\x00\x00\x00\x01" + ETHERTYPE + bytes(46)
+
+    with socket.socket(socket.AF_PACKET, socket.SOCK_RAW) as sock:
+        sock.bind((os.environ["TAPDEV"], 0))
+
+        child.sendline("ifconfig {} stats rxbatch reset".format(iface))
+        child.expect_exact("Reset statistics for module RX batches!")
+
+        # keep RIOT from handling the TAP while all frames are queued
+        child.sendline("rx_hold 500")
+        child.expect_exact("rx_hold: start")
+        for _ in range(FRAMES):
+            sock.send(frame)
+        child.expect_exact("rx_hold: done")
+
+    events, frames, frames_max, limit_reached = get_rx_batch_stats(child, iface)
+    # the host may send frames of its own to RIOT in the meantime
+    assert frames >= FRAMES, "frames: {}".format(frames)
+    assert frames_max == RX_BATCH_MAX, "frames_max: {}".format(frames_max)
+    assert limit_reached >= FRAMES // RX_BATCH_MAX, \
+        "limit_reached: {}".format(limit_reached)
+    assert events < frames, "events: {}".format(events)
+
+    # the layer 2 statistics are not affected by the batch statistics
+    child.sendline("ifconfig {} stats l2".format(iface))
+    child.expect(r"RX packets (\d+)  bytes \d+")
+    assert int(child.match.group(1)) >= FRAMES
+
+
+if __name__ == "__main__":
+    if os.geteuid() != 0:
+        print("\x1b[1;31mThis test requires root privileges.\n"
+              "It's sending Ethernet frames over the TAP.\x1b[0m\n",
+              file=sys.stderr)
+        sys.exit(1)
+    sys.exit(run(testfunc))
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the schedstatistics_latency module
+ *
+ * Wakes up a thread with a higher priority than main a couple of times and
+ * lets two threads with a lower priority yield to each other, then prints the
+ * statistics with `ps`.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "ps.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#include "test_utils/interactive_sync.h"
+
+#define WAKEUPS     (10U)
+#define YIELDS      (10U)
+
+static char _waiter_stack[THREAD_STACKSIZE_DEFAULT];
+static char _yielder_stacks[2][THREAD_STACKSIZE_DEFAULT];
+
+static void *_waiter(void *arg)
+{
+    (void)arg;
+    msg_t msg;
+
+    while (1) {
+        msg_receive(&msg);
+    }
+    return NULL;
+}
+
+static void *_yielder(void *arg)
+{
+    (void)arg;
+    msg_t msg;
+
+    for (unsigned i = 0; i < YIELDS; i++) {
+        thread_yield();
+    }
+    /* block forever */
+    msg_receive(&msg);
+    return NULL;
+}
+
+int main(void)
+{
+    kernel_pid_t waiter;
+
+    test_utils_interactive_sync();
+
+    waiter = thread_create(_waiter_stack, sizeof(_waiter_stack),
+                           THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                           _waiter, NULL, "waiter");
+    for (unsigned i = 0; i < 2; i++) {
+        thread_create(_yielder_stacks[i], sizeof(_yielder_stacks[i]),
+                      THREAD_PRIORITY_MAIN + 1, THREAD_CREATE_STACKTEST,
+                      _yielder, NULL, "yielder");
+    }
+    /* the yielders run while main sleeps */
+    xtimer_usleep(100 * US_PER_MS);
+
+    for (unsigned i = 0; i < WAKEUPS; i++) {
+        msg_t msg;
+
+        /* the waiter preempts main every time */
+        msg_send(&msg, waiter);
+        xtimer_usleep(10 * US_PER_MS);
+    }
+
+    ps();
+    puts("TEST DONE");
+    return 0;
+}
@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+WAKEUPS = 10
+YIELDS = 10
+
+# pid, name, switches, wake p50, wake p99 and preemptions of a thread
+THREAD_RE = (r'\t *(\d+) \| (\w+) +\|[^|]+\|[^|]+\|[^|]+\|[^|]+\|[^|]+\| *'
+             r'\d+\.\d+% \| +(\d+) \| +(\d+us|-) \| +(\d+us|-) \| +(\d+)\r\n')
+
+
+def testfunc(child):
+    child.expect(r'\tpid \| .*\| runtime  \| switches  \| '
+                 r'wake p50 \| wake p99 \| preempt\r\n')
+    threads = {}
+    while child.expect([THREAD_RE, r'\t +\| SUM']) == 0:
+        name = child.match.group(2)
+        threads.setdefault(name, []).append({
+            "switches": int(child.match.group(3)),
+            "p50": child.match.group(4),
+            "p99": child.match.group(5),
+            "preempt": int(child.match.group(6)),
+        })
+    child.expect_exact("TEST DONE")
+
+    waiter, = threads["waiter"]
+    main, = threads["main"]
+    yielders = threads["yielder"]
+    # the waiter was woken up every time and never preempted
+    assert waiter["switches"] > WAKEUPS, waiter
+    assert waiter["p50"] != "-" and waiter["p99"] != "-", waiter
+    assert waiter["preempt"] == 0, waiter
+    # main was preempted by the waiter every time it woke it up
+    assert main["preempt"] >= WAKEUPS, main
+    assert main["p50"] != "-", main
+    # yielding to a thread of the same priority is no preemption
+    assert len(yielders) == 2, yielders
+    for yielder in yielders:
+        assert yielder["switches"] > YIELDS, yielder
+        assert yielder["preempt"] == 0, yielder
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
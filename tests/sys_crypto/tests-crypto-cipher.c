@@ -60,6 +60,54 @@ static void test_crypto_cipher_aes_decrypt(void)
     TEST_ASSERT_MESSAGE(1 == cmp, "wrong plaintext");
 }
 
+static void test_crypto_cipher_aes_blocks(void)
+{
+    cipher_t cipher;
+    int err;
+    /* not a multiple of the number of blocks ciphers may process at once */
+    uint8_t input[7 * 16], expected[7 * 16], data[7 * 16];
+    uint8_t chain[16] = { 0 };
+
+    for (unsigned i = 0; i < sizeof(input); i++) {
+        input[i] = i * 11;
+    }
+    err = cipher_init(&cipher, CIPHER_AES_128, TEST_KEY, 16);
+    TEST_ASSERT_EQUAL_INT(1, err);
+
+    for (unsigned i = 0; i < sizeof(input); i += 16) {
+        err = cipher_encrypt(&cipher, &input[i], &expected[i]);
+        TEST_ASSERT_EQUAL_INT(1, err);
+    }
+    err = cipher_encrypt_blocks(&cipher, input, data, 7);
+    TEST_ASSERT_EQUAL_INT(1, err);
+    TEST_ASSERT_MESSAGE(1 == compare(expected, data, sizeof(data)),
+                        "wrong ciphertext");
+
+    /* in place */
+    err = cipher_decrypt_blocks(&cipher, data, data, 7);
+    TEST_ASSERT_EQUAL_INT(1, err);
+    TEST_ASSERT_MESSAGE(1 == compare(input, data, sizeof(data)),
+                        "wrong plaintext");
+
+    /* CBC with zero IV */
+    for (unsigned i = 0; i < sizeof(input); i += 16) {
+        uint8_t block[16];
+
+        memcpy(block, &input[i], 16);
+        for (unsigned j = 0; j < 16; j++) {
+            block[j] ^= (i == 0) ? 0 : expected[i - 16 + j];
+        }
+        err = cipher_encrypt(&cipher, block, &expected[i]);
+        TEST_ASSERT_EQUAL_INT(1, err);
+    }
+    err = cipher_encrypt_chain(&cipher, chain, input, data, 7);
+    TEST_ASSERT_EQUAL_INT(1, err);
+    TEST_ASSERT_MESSAGE(1 == compare(expected, data, sizeof(data)),
+                        "wrong CBC ciphertext");
+    TEST_ASSERT_MESSAGE(1 == compare(&expected[6 * 16], chain, 16),
+                        "wrong chaining value");
+}
+
 static void test_crypto_cipher_init_aes_key_length(void)
 {
     cipher_t cipher;
@@ -99,6 +147,7 @@ Test *tests_crypto_cipher_tests(void)
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_cipher_aes_encrypt),
         new_TestFixture(test_crypto_cipher_aes_decrypt),
+        new_TestFixture(test_crypto_cipher_aes_blocks),
         new_TestFixture(test_crypto_cipher_init_aes_key_length),
     };
 
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the trace_event module
+ *
+ * Records events of all types, a message exchange and a contended mutex, then
+ * dumps them.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "mutex.h"
+#include "thread.h"
+#include "trace_event.h"
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static mutex_t _mutex = MUTEX_INIT;
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+    msg_t msg;
+
+    /* runs once main blocks on sending the message */
+    msg_receive(&msg);
+    /* main is blocked on the mutex now */
+    trace_event_instant("received", msg.content.value);
+    mutex_unlock(&_mutex);
+    return NULL;
+}
+
+int main(void)
+{
+    msg_t msg = { .content.value = 42 };
+    kernel_pid_t pid;
+
+    trace_event_reset();
+    trace_event_begin("test", 0);
+    trace_event_counter("counter", 1);
+    mutex_lock(&_mutex);
+    pid = thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN + 1,
+                        THREAD_CREATE_STACKTEST, _thread, NULL, "receiver");
+    msg_send(&msg, pid);
+    /* blocks until the receiver unlocks the mutex */
+    mutex_lock(&_mutex);
+    trace_event_counter("counter", 2);
+    trace_event_end("test", 0);
+
+    trace_event_dump();
+    return 0;
+}
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import struct
+import sys
+from testrunner import run
+
+EVENT_STRUCT = struct.Struct("<IIIBBh")
+EVENT_BEGIN = 0
+EVENT_END = 1
+EVENT_INSTANT = 2
+EVENT_COUNTER = 3
+EVENT_SWITCH = 5
+EVENT_MSG_SEND = 6
+FLAG_ISR = 0x80
+
+
+def testfunc(child):
+    child.expect(r"TRACE_EVENT 1 (\d+) (\d+)\r\n")
+    numof = int(child.match.group(2))
+    strings = {}
+    while child.expect([r"S ([0-9a-f]{8}) (\S*)\r\n", r"T (\d+) (\S*)\r\n"]) == 0:
+        strings[child.match.group(2)] = int(child.match.group(1), 16)
+    threads = {child.match.group(2): int(child.match.group(1))}
+    while child.expect([r"T (\d+) (\S*)\r\n", r"E ([0-9a-f]{32})\r\n"]) == 0:
+        threads[child.match.group(2)] = int(child.match.group(1))
+    events = []
+    while True:
+        event = EVENT_STRUCT.unpack(bytes.fromhex(child.match.group(1)))
+        events.append(event)
+        if child.expect([r"E ([0-9a-f]{32})\r\n", "TRACE_EVENT END"]) == 1:
+            break
+    assert len(events) == numof
+    for name in ("test", "counter", "msg_send", "mutex_lock", "received",
+                 "sched_switch"):
+        assert name in strings, name
+    # timestamps do not go backwards, apart from overflows of the 32-bit
+    # timer (the cycle counter overflows within a minute)
+    for prev, event in zip(events, events[1:]):
+        assert (event[0] - prev[0]) % (1 << 32) < (1 << 31), (prev, event)
+    # context switches are recorded as thread context
+    assert not any(event[3] == (EVENT_SWITCH | FLAG_ISR) for event in events)
+    # (name, type, argument) of the events that are not context switches
+    sequence = [(event[1], event[3] & ~FLAG_ISR, event[2])
+                for event in events
+                if (event[3] & ~FLAG_ISR) != EVENT_SWITCH]
+    receiver = threads["receiver"]
+    expected = [
+        (strings["test"], EVENT_BEGIN, 0),
+        (strings["counter"], EVENT_COUNTER, 1),
+        (strings["msg_send"], EVENT_MSG_SEND, receiver),
+        (strings["mutex_lock"], EVENT_BEGIN, None),
+        (strings["received"], EVENT_INSTANT, 42),
+        (strings["mutex_lock"], EVENT_END, None),
+        (strings["counter"], EVENT_COUNTER, 2),
+        (strings["test"], EVENT_END, 0),
+    ]
+    assert len(sequence) == len(expected), sequence
+    for event, exp in zip(sequence, expected):
+        assert event[0] == exp[0] and event[1] == exp[1], (event, exp)
+        assert exp[2] is None or event[2] == exp[2], (event, exp)
+    # the receiver was scheduled
+    assert any((event[3] & ~FLAG_ISR) == EVENT_SWITCH and event[2] == receiver
+               for event in events)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
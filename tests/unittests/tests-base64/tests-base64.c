@@ -11,6 +11,7 @@
 #if (TEST_BASE64_SHOW_OUTPUT == 1)
 #include <stdio.h>
 #endif
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 #include "embUnit.h"
@@ -498,6 +499,92 @@ static void test_base64_13_size_estimation(void) {
     }
 }
 
+/* bit-wise reference encoder */
+static void _encode_ref(const uint8_t *in, size_t len, char *out, bool urlsafe)
+{
+    static const char *symbols =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+    size_t bit;
+
+    for (bit = 0; bit < len * 8; bit += 6) {
+        unsigned code = 0;
+
+        for (unsigned i = 0; i < 6; i++) {
+            unsigned pos = bit + i;
+
+            code <<= 1;
+            if ((pos < len * 8) && (in[pos / 8] & (0x80 >> (pos % 8)))) {
+                code |= 1;
+            }
+        }
+        if (code == 62) {
+            *out++ = urlsafe ? '-' : '+';
+        }
+        else if (code == 63) {
+            *out++ = urlsafe ? '_' : '/';
+        }
+        else {
+            *out++ = symbols[code];
+        }
+    }
+    for (; bit % 24; bit += 6) {
+        *out++ = '=';
+    }
+}
+
+static void test_base64_14_all_lengths(void)
+{
+    uint8_t data[80], decoded[80 + 2];
+    char expected[112], base64_out[112];
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        /* covers all codes */
+        data[i] = (uint8_t)((i * 181) + 7);
+    }
+    for (size_t len = 1; len <= sizeof(data); len++) {
+        for (unsigned url = 0; url < 2; url++) {
+            size_t out_size = sizeof(base64_out);
+            size_t decoded_size = sizeof(decoded);
+            int res;
+
+            _encode_ref(data, len, expected, url);
+            if (url) {
+                res = base64url_encode(data, len, base64_out, &out_size);
+            }
+            else {
+                res = base64_encode(data, len, base64_out, &out_size);
+            }
+            TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS, res);
+            TEST_ASSERT_EQUAL_INT(base64_estimate_encode_size(len), out_size);
+            TEST_ASSERT_EQUAL_INT(0, memcmp(expected, base64_out, out_size));
+
+            res = base64_decode(base64_out, out_size, decoded, &decoded_size);
+            TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS, res);
+            TEST_ASSERT_EQUAL_INT(len, decoded_size);
+            TEST_ASSERT_EQUAL_INT(0, memcmp(data, decoded, len));
+        }
+    }
+}
+
+static void test_base64_15_decode_skip_symbols(void)
+{
+    static const char base64_in[] =
+        "VGhpcyBpcyBhbiBleHRyZW1lbHksIGVub3Jtb3VzbHksIGdy\n"
+        "ZWF0bHksIGltbWVuc2VseSwgdHJl bWVuZG91c2x5LCByZW1h\r\n"
+        "cmthYmx5IGxlbmd0aHkgc2VudGVuY2Uh";
+    static const char expected[] = "This is an extremely, enormously, greatly, "
+                                    "immensely, tremendously, remarkably "
+                                    "lengthy sentence!";
+    uint8_t data_out[sizeof(base64_in)];
+    size_t data_out_size = sizeof(data_out);
+
+    TEST_ASSERT_EQUAL_INT(BASE64_SUCCESS,
+                          base64_decode(base64_in, sizeof(base64_in) - 1,
+                                        data_out, &data_out_size));
+    TEST_ASSERT_EQUAL_INT(sizeof(expected) - 1, data_out_size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, data_out, data_out_size));
+}
+
 Test *tests_base64_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -515,6 +602,8 @@ Test *tests_base64_tests(void)
         new_TestFixture(test_base64_11_urlsafe_encode_int),
         new_TestFixture(test_base64_12_urlsafe_decode_int),
         new_TestFixture(test_base64_13_size_estimation),
+        new_TestFixture(test_base64_14_all_lengths),
+        new_TestFixture(test_base64_15_decode_skip_symbols),
     };
 
     EMB_UNIT_TESTCALLER(base64_tests, NULL, NULL, fixtures);
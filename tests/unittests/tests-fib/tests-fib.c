@@ -976,6 +976,193 @@ static void test_fib_20_replace_prefix(void)
     fib_deinit(&test_fib_table);
 }
 
+/*
+* @brief testing that the longest matching prefix wins regardless of the order
+*        the entries are added
+*/
+static void test_fib_21_longest_prefix_match(void)
+{
+    size_t add_buf_size = 16;
+    char addr_dst[add_buf_size];
+    char addr_nxt_hop[add_buf_size];
+    char addr_nxt[add_buf_size];
+    char addr_lookup[add_buf_size];
+    kernel_pid_t iface_id = KERNEL_PID_UNDEF;
+    uint32_t next_hop_flags = 0;
+
+    memset(addr_dst, 0, add_buf_size);
+    memset(addr_nxt, 0, add_buf_size);
+    memset(addr_nxt_hop, 0, add_buf_size);
+    memset(addr_lookup, 0, add_buf_size);
+
+    /* set the bytes to 0x01..0x10 of the lookup address */
+    for(size_t i = 0; i < add_buf_size; i++) {
+        addr_lookup[i] = i+1;
+    }
+
+    /* add a default gateway entry with next-hop 0x01.. */
+    addr_nxt[0] = 0x01;
+    fib_add_entry(&test_fib_table, 42, (uint8_t *)addr_dst,
+                  add_buf_size, 0x123,
+                  (uint8_t *)addr_nxt, add_buf_size, 0x23,
+                  100000);
+
+    /* add a /32 prefix entry 0x01..0x04 with next-hop 0x32.. */
+    memcpy(addr_dst, addr_lookup, 4);
+    addr_nxt[0] = 0x32;
+    fib_add_entry(&test_fib_table, 42, (uint8_t *)addr_dst,
+                  add_buf_size, ((32UL << FIB_FLAG_NET_PREFIX_SHIFT) | 0x123),
+                  (uint8_t *)addr_nxt, add_buf_size, 0x23,
+                  100000);
+
+    /* add a /100 prefix entry 0x01..0x0c,0x00 with next-hop 0x64.. */
+    memcpy(addr_dst, addr_lookup, 12);
+    addr_dst[12] = addr_lookup[12] & 0xf0;
+    addr_nxt[0] = 0x64;
+    fib_add_entry(&test_fib_table, 42, (uint8_t *)addr_dst,
+                  add_buf_size, ((100UL << FIB_FLAG_NET_PREFIX_SHIFT) | 0x123),
+                  (uint8_t *)addr_nxt, add_buf_size, 0x23,
+                  100000);
+
+    /* add a /64 prefix entry 0x01..0x08 with next-hop 0x40.. */
+    memset(addr_dst, 0, add_buf_size);
+    memcpy(addr_dst, addr_lookup, 8);
+    addr_nxt[0] = 0x40;
+    fib_add_entry(&test_fib_table, 42, (uint8_t *)addr_dst,
+                  add_buf_size, ((64UL << FIB_FLAG_NET_PREFIX_SHIFT) | 0x123),
+                  (uint8_t *)addr_nxt, add_buf_size, 0x23,
+                  100000);
+
+    /* the /100 prefix is the longest match */
+    int ret = fib_get_next_hop(&test_fib_table, &iface_id,
+                               (uint8_t *)addr_nxt_hop, &add_buf_size,
+                               &next_hop_flags, (uint8_t *)addr_lookup,
+                               add_buf_size, 0x123);
+
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    TEST_ASSERT_EQUAL_INT(0x64, addr_nxt_hop[0]);
+
+    /* the /64 prefix is the longest match when bit 96 differs */
+    addr_lookup[12] ^= 0x80;
+    ret = fib_get_next_hop(&test_fib_table, &iface_id,
+                           (uint8_t *)addr_nxt_hop, &add_buf_size,
+                           &next_hop_flags, (uint8_t *)addr_lookup,
+                           add_buf_size, 0x123);
+
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    TEST_ASSERT_EQUAL_INT(0x40, addr_nxt_hop[0]);
+
+    /* the /32 prefix is the longest match when bit 32 differs */
+    addr_lookup[4] ^= 0x80;
+    ret = fib_get_next_hop(&test_fib_table, &iface_id,
+                           (uint8_t *)addr_nxt_hop, &add_buf_size,
+                           &next_hop_flags, (uint8_t *)addr_lookup,
+                           add_buf_size, 0x123);
+
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    TEST_ASSERT_EQUAL_INT(0x32, addr_nxt_hop[0]);
+
+    /* only the default gateway matches when bit 0 differs */
+    addr_lookup[0] ^= 0x80;
+    ret = fib_get_next_hop(&test_fib_table, &iface_id,
+                           (uint8_t *)addr_nxt_hop, &add_buf_size,
+                           &next_hop_flags, (uint8_t *)addr_lookup,
+                           add_buf_size, 0x123);
+
+    TEST_ASSERT_EQUAL_INT(0, ret);
+    TEST_ASSERT_EQUAL_INT(0x01, addr_nxt_hop[0]);
+
+#if (TEST_FIB_SHOW_OUTPUT == 1)
+    fib_print_fib_table(&test_fib_table);
+    puts("");
+    universal_address_print_table();
+    puts("");
+#endif
+    fib_deinit(&test_fib_table);
+}
+
+/*
+* @brief filling the FIB with entries of different lifetimes, shortening
+* the lifetime of one entry and reusing the slots of the expired ones
+* It is expected that exactly the expired entries are removed
+*/
+static void test_fib_22_purge_expired_entries(void)
+{
+    size_t add_buf_size = 16;
+    char addr_dst[add_buf_size];
+    char addr_nxt[add_buf_size];
+    char addr_nxt_hop[add_buf_size];
+    kernel_pid_t iface_id = KERNEL_PID_UNDEF;
+    uint32_t next_hop_flags = 0;
+    size_t entries = 20;
+    size_t expired = 0;
+
+    memset(addr_nxt, 0, add_buf_size);
+    snprintf(addr_nxt, add_buf_size, "Test next hop");
+    for (size_t i = 0; i < entries; ++i) {
+        /* every third entry expires after 1 ms, the others much later */
+        uint32_t lifetime = (i % 3 == 0) ? 1 : (10000 + entries - i);
+
+        snprintf(addr_dst, add_buf_size, "Test address %02d", (int)i);
+        TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42,
+                                               (uint8_t *)addr_dst, add_buf_size - 1, 0x0,
+                                               (uint8_t *)addr_nxt, add_buf_size - 1, 0x0,
+                                               lifetime));
+        expired += (lifetime == 1);
+    }
+
+    /* shorten the lifetime of one of the long living entries */
+    snprintf(addr_dst, add_buf_size, "Test address %02d", 10);
+    TEST_ASSERT_EQUAL_INT(0, fib_update_entry(&test_fib_table,
+                                              (uint8_t *)addr_dst, add_buf_size - 1,
+                                              (uint8_t *)addr_nxt, add_buf_size - 1,
+                                              0x0, 1));
+    expired++;
+
+    xtimer_usleep(2 * US_PER_MS);
+
+    for (size_t i = 0; i < entries; ++i) {
+        bool gone = (i % 3 == 0) || (i == 10);
+        size_t nxt_size = add_buf_size;
+
+        snprintf(addr_dst, add_buf_size, "Test address %02d", (int)i);
+        int ret = fib_get_next_hop(&test_fib_table, &iface_id,
+                                   (uint8_t *)addr_nxt_hop, &nxt_size,
+                                   &next_hop_flags, (uint8_t *)addr_dst,
+                                   add_buf_size - 1, 0x0);
+        TEST_ASSERT_EQUAL_INT(gone ? -EHOSTUNREACH : 0, ret);
+    }
+    TEST_ASSERT_EQUAL_INT(entries - expired, fib_get_num_used_entries(&test_fib_table));
+
+    /* the freed slots are reused and expire again */
+    for (size_t i = 0; i < expired; ++i) {
+        snprintf(addr_dst, add_buf_size, "Test address %02d", (int)(entries + i));
+        TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42,
+                                               (uint8_t *)addr_dst, add_buf_size - 1, 0x0,
+                                               (uint8_t *)addr_nxt, add_buf_size - 1, 0x0,
+                                               1));
+    }
+    TEST_ASSERT_EQUAL_INT(entries, fib_get_num_used_entries(&test_fib_table));
+
+    xtimer_usleep(2 * US_PER_MS);
+
+    size_t nxt_size = add_buf_size;
+    TEST_ASSERT_EQUAL_INT(-EHOSTUNREACH,
+                          fib_get_next_hop(&test_fib_table, &iface_id,
+                                           (uint8_t *)addr_nxt_hop, &nxt_size,
+                                           &next_hop_flags, (uint8_t *)addr_dst,
+                                           add_buf_size - 1, 0x0));
+    TEST_ASSERT_EQUAL_INT(entries - expired, fib_get_num_used_entries(&test_fib_table));
+
+#if (TEST_FIB_SHOW_OUTPUT == 1)
+    fib_print_fib_table(&test_fib_table);
+    puts("");
+    universal_address_print_table();
+    puts("");
+#endif
+    fib_deinit(&test_fib_table);
+}
+
 Test *tests_fib_tests(void)
 {
     fib_init(&test_fib_table);
@@ -1000,6 +1187,8 @@ Test *tests_fib_tests(void)
                         new_TestFixture(test_fib_18_get_next_hop_invalid_parameters),
                         new_TestFixture(test_fib_19_default_gateway),
                         new_TestFixture(test_fib_20_replace_prefix),
+                        new_TestFixture(test_fib_21_longest_prefix_match),
+                        new_TestFixture(test_fib_22_purge_expired_entries),
     };
 
     EMB_UNIT_TESTCALLER(fib_tests, NULL, NULL, fixtures);
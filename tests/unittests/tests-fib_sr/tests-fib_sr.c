@@ -15,6 +15,7 @@
 #include "thread.h"
 #include "net/fib.h"
 #include "universal_address.h"
+#include "xtimer.h"
 
 /**
  * @brief maximum number of source routes
@@ -700,6 +701,144 @@ static void test_fib_sr_12_get_consecutive_sr(void)
     fib_deinit(&test_fib_sr_table);
 }
 
+/*
+ * @brief create a source route that expires and one that does not, and get a
+ *        route to trigger the purge of the expired one
+ * It is expected that the expired source route releases its destination and
+ * all entries of its path
+ */
+static void test_fib_sr_13_purge_expired_sr(void)
+{
+    fib_sr_t *local_sourceroutes[2];
+    size_t add_buf_size = 16;
+    char addr_nxt[add_buf_size];
+
+    /* Create SR1 X0,.., X9,XX with a lifetime of 1 ms */
+    TEST_ASSERT_EQUAL_INT(0, fib_sr_create(&test_fib_sr_table, &local_sourceroutes[0],
+                                           42, 0x0, 1));
+    TEST_ASSERT_EQUAL_INT(0, _create_sr("Some address X", 0, 10, local_sourceroutes[0], 16));
+    snprintf(addr_nxt, add_buf_size, "Some address XX");
+    TEST_ASSERT_EQUAL_INT(0, fib_sr_entry_append(&test_fib_sr_table, local_sourceroutes[0],
+                                                 (uint8_t *)&addr_nxt,
+                                                 add_buf_size)
+                          );
+
+    /* Create SR2 Y1,.., Y7,YY */
+    TEST_ASSERT_EQUAL_INT(0, fib_sr_create(&test_fib_sr_table, &local_sourceroutes[1],
+                                           42, 0x0, 10000));
+    TEST_ASSERT_EQUAL_INT(0, _create_sr("Some address Y", 1, 8, local_sourceroutes[1], 16));
+    snprintf(addr_nxt, add_buf_size, "Some address YY");
+    TEST_ASSERT_EQUAL_INT(0, fib_sr_entry_append(&test_fib_sr_table, local_sourceroutes[1],
+                                                 (uint8_t *)&addr_nxt,
+                                                 add_buf_size)
+                          );
+
+    xtimer_usleep(2 * US_PER_MS);
+
+    size_t addr_list_elements = 11;
+    size_t element_size = 16;
+    uint8_t addr_list[ addr_list_elements * element_size ];
+    kernel_pid_t sr_iface_id;
+    uint32_t sr_flags = 0x0;
+
+    TEST_ASSERT_EQUAL_INT(0, fib_sr_get_route(&test_fib_sr_table, (uint8_t *)&addr_nxt,
+                                              add_buf_size, &sr_iface_id, &sr_flags,
+                                              addr_list, &addr_list_elements, &element_size,
+                                              false, NULL)
+                          );
+    TEST_ASSERT_EQUAL_INT(8, addr_list_elements);
+
+    /* the expired source route is gone, including its destination */
+    TEST_ASSERT_EQUAL_INT(0, local_sourceroutes[0]->sr_lifetime);
+    TEST_ASSERT_NULL(local_sourceroutes[0]->sr_path);
+    TEST_ASSERT_NULL(local_sourceroutes[0]->sr_dest);
+
+    /* only the entries of SR2 are still in use */
+    unsigned used = 0;
+    for (size_t i = 0; i < TEST_MAX_FIB_SR_ENTRIES; ++i) {
+        used += (_sr_datapool[i].address != NULL);
+    }
+    TEST_ASSERT_EQUAL_INT(8, used);
+
+    addr_list_elements = 11;
+    snprintf(addr_nxt, add_buf_size, "Some address XX");
+    TEST_ASSERT(fib_sr_get_route(&test_fib_sr_table, (uint8_t *)&addr_nxt,
+                                 add_buf_size, &sr_iface_id, &sr_flags,
+                                 addr_list, &addr_list_elements, &element_size,
+                                 false, NULL) != 0);
+
+    fib_deinit(&test_fib_sr_table);
+}
+
+/*
+ * @brief create a source route, change its destination by overwriting and
+ *        deleting the last hop and look it up by the new destination
+ * It is expected that only the current destination finds the route
+ */
+static void test_fib_sr_14_get_route_after_destination_change(void)
+{
+    fib_sr_t *local_sourceroutes[1];
+    size_t add_buf_size = 16;
+    char addr_old[add_buf_size];
+    char addr_new[add_buf_size];
+    size_t addr_list_elements = 10;
+    size_t element_size = 16;
+    uint8_t addr_list[ addr_list_elements * element_size ];
+    kernel_pid_t sr_iface_id;
+    uint32_t sr_flags = 0x0;
+
+    TEST_ASSERT_EQUAL_INT(0, fib_sr_create(&test_fib_sr_table, &local_sourceroutes[0],
+                                           42, 0x0, 10000));
+    TEST_ASSERT_EQUAL_INT(0, _create_sr("Some address X", 0, 10, local_sourceroutes[0], 16));
+
+    /* replace the destination X9 by XY */
+    snprintf(addr_old, add_buf_size, "Some address X9");
+    snprintf(addr_new, add_buf_size, "Some address XY");
+    TEST_ASSERT_EQUAL_INT(0, fib_sr_entry_overwrite(&test_fib_sr_table, local_sourceroutes[0],
+                                                    (uint8_t *)&addr_old, add_buf_size,
+                                                    (uint8_t *)&addr_new, add_buf_size)
+                          );
+    TEST_ASSERT(fib_sr_get_route(&test_fib_sr_table, (uint8_t *)&addr_old,
+                                 add_buf_size, &sr_iface_id, &sr_flags,
+                                 addr_list, &addr_list_elements, &element_size,
+                                 false, NULL) != 0);
+    addr_list_elements = 10;
+    TEST_ASSERT_EQUAL_INT(0, fib_sr_get_route(&test_fib_sr_table, (uint8_t *)&addr_new,
+                                              add_buf_size, &sr_iface_id, &sr_flags,
+                                              addr_list, &addr_list_elements, &element_size,
+                                              false, NULL)
+                          );
+    TEST_ASSERT_EQUAL_INT(10, addr_list_elements);
+
+    /* delete the destination XY, so X8 becomes the destination */
+    TEST_ASSERT_EQUAL_INT(0, fib_sr_entry_delete(&test_fib_sr_table, local_sourceroutes[0],
+                                                 (uint8_t *)&addr_new, add_buf_size, true)
+                          );
+    addr_list_elements = 10;
+    TEST_ASSERT(fib_sr_get_route(&test_fib_sr_table, (uint8_t *)&addr_new,
+                                 add_buf_size, &sr_iface_id, &sr_flags,
+                                 addr_list, &addr_list_elements, &element_size,
+                                 false, NULL) != 0);
+    snprintf(addr_old, add_buf_size, "Some address X8");
+    addr_list_elements = 10;
+    TEST_ASSERT_EQUAL_INT(0, fib_sr_get_route(&test_fib_sr_table, (uint8_t *)&addr_old,
+                                              add_buf_size, &sr_iface_id, &sr_flags,
+                                              addr_list, &addr_list_elements, &element_size,
+                                              false, NULL)
+                          );
+    TEST_ASSERT_EQUAL_INT(9, addr_list_elements);
+
+    /* remove the source route */
+    TEST_ASSERT_EQUAL_INT(0, fib_sr_delete(&test_fib_sr_table, local_sourceroutes[0]));
+    addr_list_elements = 10;
+    TEST_ASSERT(fib_sr_get_route(&test_fib_sr_table, (uint8_t *)&addr_old,
+                                 add_buf_size, &sr_iface_id, &sr_flags,
+                                 addr_list, &addr_list_elements, &element_size,
+                                 false, NULL) != 0);
+
+    fib_deinit(&test_fib_sr_table);
+}
+
 Test *tests_fib_sr_tests(void)
 {
     test_fib_sr_table.data.source_routes = &_entries_sr;
@@ -722,6 +861,8 @@ Test *tests_fib_sr_tests(void)
         new_TestFixture(test_fib_sr_10_create_sr_with_hops_and_get_a_route),
         new_TestFixture(test_fib_sr_11_create_sr_with_hops_and_get_a_partial_route),
         new_TestFixture(test_fib_sr_12_get_consecutive_sr),
+        new_TestFixture(test_fib_sr_13_purge_expired_sr),
+        new_TestFixture(test_fib_sr_14_get_route_after_destination_change),
     };
 
     EMB_UNIT_TESTCALLER(fib_sr_tests, NULL, NULL, fixtures);
@@ -19,6 +19,7 @@
 
 #include "net/gcoap.h"
 
+#include "_gcoap_resource_trie.h"
 #include "unittests-constants.h"
 #include "tests-gcoap.h"
 
@@ -49,6 +50,34 @@ static gcoap_listener_t listener_second = {
     .next          = NULL
 };
 
+/*
+ * Resources for the resource trie, sorted by path like for the linear search.
+ */
+static const coap_resource_t trie_resources[] = {
+    { .path = "/sub", .methods = (COAP_GET | COAP_MATCH_SUBTREE) },
+    { .path = "/sub/exact", .methods = (COAP_GET | COAP_POST) },
+    { .path = "/tree", .methods = (COAP_GET | COAP_MATCH_SUBTREE) },
+    { .path = "/value", .methods = (COAP_GET) },
+};
+
+static const coap_resource_t trie_resources_second[] = {
+    { .path = "/tree/leaf", .methods = (COAP_GET | COAP_DELETE) },
+};
+
+static gcoap_listener_t trie_listener = {
+    .resources     = &trie_resources[0],
+    .resources_len = ARRAY_SIZE(trie_resources),
+    .link_encoder  = NULL,
+    .next          = NULL
+};
+
+static gcoap_listener_t trie_listener_second = {
+    .resources     = &trie_resources_second[0],
+    .resources_len = ARRAY_SIZE(trie_resources_second),
+    .link_encoder  = NULL,
+    .next          = NULL
+};
+
 static const char *resource_list_str = "</act/switch>,</sensor/temp>,</test/info/all>,</second/part>";
 
 /*
@@ -385,6 +414,126 @@ static void test_gcoap__server_get_resource_list(void)
     TEST_ASSERT_EQUAL_STRING(resource_list_str, (char *)res);
 }
 
+/*
+ * Helper for the resource trie tests: looks up path of a request with the
+ * given method in the resource trie.
+ */
+static int _trie_find(unsigned code, char *path,
+                      const coap_resource_t **resource,
+                      gcoap_listener_t **listener)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+
+    ssize_t len = gcoap_request(&pdu, &buf[0], sizeof(buf), code, path);
+    /* parse it like a received request */
+    if ((len <= 0) || (coap_parse(&pdu, &buf[0], len) < 0)) {
+        return -EINVAL;
+    }
+
+    *resource = NULL;
+    *listener = NULL;
+    return _gcoap_resource_trie_find(&pdu, resource, listener);
+}
+
+/*
+ * Resource trie: exact matches, subtree matches and the precedence of
+ * resources matching the same request.
+ */
+static void test_gcoap__server_resource_trie_match(void)
+{
+    const coap_resource_t *resource;
+    gcoap_listener_t *listener;
+
+    TEST_ASSERT(_gcoap_resource_trie_add(&trie_listener));
+    TEST_ASSERT(_gcoap_resource_trie_add(&trie_listener_second));
+
+    /* exact match */
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _trie_find(COAP_METHOD_GET, "/value", &resource,
+                                     &listener));
+    TEST_ASSERT(&trie_resources[3] == resource);
+    TEST_ASSERT(&trie_listener == listener);
+
+    /* subtree resource matches itself, paths below and, like
+     * coap_match_path(), paths it is a character prefix of */
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _trie_find(COAP_METHOD_GET, "/sub", &resource,
+                                     &listener));
+    TEST_ASSERT(&trie_resources[0] == resource);
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _trie_find(COAP_METHOD_GET, "/sub/a/b", &resource,
+                                     &listener));
+    TEST_ASSERT(&trie_resources[0] == resource);
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _trie_find(COAP_METHOD_GET, "/subway", &resource,
+                                     &listener));
+    TEST_ASSERT(&trie_resources[0] == resource);
+
+    /* exact and subtree resource match: the one registered first that allows
+     * the method wins, as with the linear search */
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _trie_find(COAP_METHOD_GET, "/sub/exact", &resource,
+                                     &listener));
+    TEST_ASSERT(&trie_resources[0] == resource);
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _trie_find(COAP_METHOD_POST, "/sub/exact", &resource,
+                                     &listener));
+    TEST_ASSERT(&trie_resources[1] == resource);
+
+    /* ... also across listeners */
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _trie_find(COAP_METHOD_GET, "/tree/leaf", &resource,
+                                     &listener));
+    TEST_ASSERT(&trie_resources[2] == resource);
+    TEST_ASSERT(&trie_listener == listener);
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _trie_find(COAP_METHOD_DELETE, "/tree/leaf", &resource,
+                                     &listener));
+    TEST_ASSERT(&trie_resources_second[0] == resource);
+    TEST_ASSERT(&trie_listener_second == listener);
+}
+
+/*
+ * Resource trie: paths that match no resource and resources that do not allow
+ * the method, which gcoap answers with 4.04 and 4.05.
+ */
+static void test_gcoap__server_resource_trie_no_match(void)
+{
+    const coap_resource_t *resource;
+    gcoap_listener_t *listener;
+
+    /* relies on the resources added by
+     * test_gcoap__server_resource_trie_match() */
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_NO_PATH,
+                          _trie_find(COAP_METHOD_GET, "/nothing", &resource,
+                                     &listener));
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_NO_PATH,
+                          _trie_find(COAP_METHOD_GET, "/su", &resource,
+                                     &listener));
+    /* /value is no subtree resource */
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_NO_PATH,
+                          _trie_find(COAP_METHOD_GET, "/value/x", &resource,
+                                     &listener));
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_NO_PATH,
+                          _trie_find(COAP_METHOD_GET, "/valu", &resource,
+                                     &listener));
+    TEST_ASSERT_NULL(resource);
+
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_WRONG_METHOD,
+                          _trie_find(COAP_METHOD_DELETE, "/value", &resource,
+                                     &listener));
+    TEST_ASSERT_NULL(resource);
+    /* path only matched by a subtree resource */
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_WRONG_METHOD,
+                          _trie_find(COAP_METHOD_PUT, "/sub/x", &resource,
+                                     &listener));
+    /* none of the resources matching exactly and by subtree allows PUT */
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_WRONG_METHOD,
+                          _trie_find(COAP_METHOD_PUT, "/tree/leaf", &resource,
+                                     &listener));
+}
+
 Test *tests_gcoap_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -398,7 +547,9 @@ Test *tests_gcoap_tests(void)
         new_TestFixture(test_gcoap__server_get_resp),
         new_TestFixture(test_gcoap__server_con_req),
         new_TestFixture(test_gcoap__server_con_resp),
-        new_TestFixture(test_gcoap__server_get_resource_list)
+        new_TestFixture(test_gcoap__server_get_resource_list),
+        new_TestFixture(test_gcoap__server_resource_trie_match),
+        new_TestFixture(test_gcoap__server_resource_trie_no_match),
     };
 
     EMB_UNIT_TESTCALLER(gcoap_tests, NULL, NULL, fixtures);
@@ -23,6 +23,7 @@
 
 #include "_nib-internal.h"
 #include "_nib-arsm.h"
+#include "_nib-offl_trie.h"
 
 #include "unittests-constants.h"
 
@@ -1635,6 +1636,172 @@ static void test_nib_offl_iter__three_elem_middle_removed(void)
     TEST_ASSERT_NULL(_nib_offl_iter(res));
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+static _nib_offl_entry_t *_trie_add(const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    static const ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                 { .u64 = TEST_UINT64 } } };
+    _nib_offl_entry_t *dst = _nib_offl_alloc(&next_hop, IFACE, pfx, pfx_len);
+
+    if (dst != NULL) {
+        dst->mode |= _FT;
+    }
+    return dst;
+}
+
+static void _trie_remove(_nib_offl_entry_t *dst)
+{
+    dst->mode = _EMPTY;
+    _nib_offl_clear(dst);
+}
+
+/*
+ * Creates off-link entries with nested prefixes of length 16, 32, 48 and 64 of
+ * the same address, in an order that requires inserting above and below
+ * existing trie nodes, and looks up addresses that match different numbers of
+ * them.
+ * Expected result: the entry with the longest matching prefix is returned,
+ * NULL if none matches
+ */
+static void test_nib_offl_trie_get_match__longest_prefix(void)
+{
+    _nib_offl_entry_t *dst16, *dst32, *dst48, *dst64;
+    static const ipv6_addr_t pfx = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    ipv6_addr_t addr;
+
+    TEST_ASSERT_NOT_NULL((dst48 = _trie_add(&pfx, 48)));
+    TEST_ASSERT_NOT_NULL((dst16 = _trie_add(&pfx, 16)));
+    TEST_ASSERT_NOT_NULL((dst64 = _trie_add(&pfx, 64)));
+    TEST_ASSERT_NOT_NULL((dst32 = _trie_add(&pfx, 32)));
+    TEST_ASSERT(_nib_offl_trie_get_match(&pfx) == dst64);
+    addr = pfx;
+    addr.u8[6] ^= 0x20;     /* bit 50 */
+    TEST_ASSERT(_nib_offl_trie_get_match(&addr) == dst48);
+    addr = pfx;
+    addr.u8[4] ^= 0x01;     /* bit 39 */
+    TEST_ASSERT(_nib_offl_trie_get_match(&addr) == dst32);
+    addr = pfx;
+    addr.u8[3] ^= 0x01;     /* bit 31 */
+    TEST_ASSERT(_nib_offl_trie_get_match(&addr) == dst16);
+    addr = pfx;
+    addr.u8[0] ^= 0x80;     /* bit 0 */
+    TEST_ASSERT_NULL(_nib_offl_trie_get_match(&addr));
+}
+
+/*
+ * Creates three off-link entries with prefixes that diverge within the same
+ * byte, looks them up, removes the middle one and looks them up again.
+ * Expected result: every address matches the entry of its prefix, the address
+ * of the removed prefix and an address of an unknown prefix match nothing
+ */
+static void test_nib_offl_trie_get_match__diverging(void)
+{
+    _nib_offl_entry_t *dst[3];
+    ipv6_addr_t pfx = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                 { .u64 = TEST_UINT64 } } };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(dst); i++) {
+        pfx.u8[5] = i + 1;
+        TEST_ASSERT_NOT_NULL((dst[i] = _trie_add(&pfx, 48)));
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(dst); i++) {
+        pfx.u8[5] = i + 1;
+        TEST_ASSERT(_nib_offl_trie_get_match(&pfx) == dst[i]);
+    }
+    pfx.u8[5] = ARRAY_SIZE(dst) + 1;
+    TEST_ASSERT_NULL(_nib_offl_trie_get_match(&pfx));
+    _trie_remove(dst[1]);
+    pfx.u8[5] = 2;
+    TEST_ASSERT_NULL(_nib_offl_trie_get_match(&pfx));
+    pfx.u8[5] = 1;
+    TEST_ASSERT(_nib_offl_trie_get_match(&pfx) == dst[0]);
+    pfx.u8[5] = 3;
+    TEST_ASSERT(_nib_offl_trie_get_match(&pfx) == dst[2]);
+}
+
+/*
+ * Creates two off-link entries with the same prefix but different next hops.
+ * Expected result: the entry stored first in the table is returned, the other
+ * one after the first one was removed
+ */
+static void test_nib_offl_trie_get_match__same_prefix(void)
+{
+    _nib_offl_entry_t *dst1, *dst2;
+    ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                    { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t pfx = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+
+    TEST_ASSERT_NOT_NULL((dst1 = _nib_offl_alloc(&next_hop, IFACE, &pfx,
+                                                 GLOBAL_PREFIX_LEN)));
+    dst1->mode |= _FT;
+    next_hop.u64[1].u64++;
+    TEST_ASSERT_NOT_NULL((dst2 = _nib_offl_alloc(&next_hop, IFACE, &pfx,
+                                                 GLOBAL_PREFIX_LEN)));
+    dst2->mode |= _FT;
+    TEST_ASSERT(dst1 < dst2);
+    TEST_ASSERT(_nib_offl_trie_get_match(&pfx) == dst1);
+    _trie_remove(dst1);
+    TEST_ASSERT(_nib_offl_trie_get_match(&pfx) == dst2);
+    _trie_remove(dst2);
+    TEST_ASSERT_NULL(_nib_offl_trie_get_match(&pfx));
+}
+
+/*
+ * Removes the off-link entries of nested prefixes from the middle outwards.
+ * Expected result: the entry with the longest remaining matching prefix is
+ * returned after each removal
+ */
+static void test_nib_offl_trie_remove__nested(void)
+{
+    _nib_offl_entry_t *dst16, *dst32, *dst48;
+    static const ipv6_addr_t pfx = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+
+    TEST_ASSERT_NOT_NULL((dst16 = _trie_add(&pfx, 16)));
+    TEST_ASSERT_NOT_NULL((dst32 = _trie_add(&pfx, 32)));
+    TEST_ASSERT_NOT_NULL((dst48 = _trie_add(&pfx, 48)));
+    _trie_remove(dst32);
+    TEST_ASSERT(_nib_offl_trie_get_match(&pfx) == dst48);
+    _trie_remove(dst48);
+    TEST_ASSERT(_nib_offl_trie_get_match(&pfx) == dst16);
+    _trie_remove(dst16);
+    TEST_ASSERT_NULL(_nib_offl_trie_get_match(&pfx));
+}
+
+/*
+ * Fills the off-link table with entries of different prefixes and prefix
+ * lengths, removes all of them and fills the table again.
+ * Expected result: each prefix matches its own entry while the table is full,
+ * nothing matches once the table is empty and the trie nodes are all available
+ * again for the second round
+ */
+static void test_nib_offl_trie__fill_and_empty(void)
+{
+    _nib_offl_entry_t *dst[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+    ipv6_addr_t pfx = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+
+    for (unsigned round = 0; round < 2; round++) {
+        for (unsigned i = 0; i < ARRAY_SIZE(dst); i++) {
+            /* distinct in the first 40 bits */
+            pfx.u8[4] = i * 37;
+            TEST_ASSERT_NOT_NULL((dst[i] = _trie_add(&pfx, 40 + (i % 8))));
+        }
+        for (unsigned i = 0; i < ARRAY_SIZE(dst); i++) {
+            TEST_ASSERT(_nib_offl_trie_get_match(&dst[i]->pfx) == dst[i]);
+        }
+        /* remove in a different order than added */
+        for (unsigned i = 0; i < ARRAY_SIZE(dst); i++) {
+            _trie_remove(dst[(i * 7) % ARRAY_SIZE(dst)]);
+        }
+        for (unsigned i = 0; i < ARRAY_SIZE(dst); i++) {
+            pfx.u8[4] = i * 37;
+            TEST_ASSERT_NULL(_nib_offl_trie_get_match(&pfx));
+        }
+    }
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_DC)
 /*
  * Creates a destination cache entry.
@@ -2078,6 +2245,13 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_offl_iter__one_elem),
         new_TestFixture(test_nib_offl_iter__three_elem),
         new_TestFixture(test_nib_offl_iter__three_elem_middle_removed),
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+        new_TestFixture(test_nib_offl_trie_get_match__longest_prefix),
+        new_TestFixture(test_nib_offl_trie_get_match__diverging),
+        new_TestFixture(test_nib_offl_trie_get_match__same_prefix),
+        new_TestFixture(test_nib_offl_trie_remove__nested),
+        new_TestFixture(test_nib_offl_trie__fill_and_empty),
+#endif
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_DC)
         new_TestFixture(test_nib_dc_add__success),
         new_TestFixture(test_nib_dc_remove),
@@ -171,6 +171,39 @@ static void test_vrb_gc(void)
                                                  base.tag));
 }
 
+static void test_vrb_gc__partial(void)
+{
+    gnrc_sixlowpan_frag_rb_base_t base = _base;
+    uint32_t now = xtimer_now_usec();
+
+    /* add entries alternating between timed out and current ones in
+     * non-chronological order */
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        base.arrival = (i & 1) ? (now - i)
+                     : (now - CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US - 1000 - i);
+        TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_vrb_add(&base,
+                                                         &_dummy_netif,
+                                                         _out_dst,
+                                                         sizeof(_out_dst)));
+        base.tag++;
+    }
+    gnrc_sixlowpan_frag_vrb_gc();
+    base.tag = _base.tag;
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        gnrc_sixlowpan_frag_vrb_t *res = gnrc_sixlowpan_frag_vrb_get(
+                base.src, base.src_len, base.tag
+            );
+
+        if (i & 1) {
+            TEST_ASSERT_NOT_NULL(res);
+        }
+        else {
+            TEST_ASSERT_NULL(res);
+        }
+        base.tag++;
+    }
+}
+
 static Test *tests_gnrc_sixlowpan_frag_vrb_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -181,6 +214,7 @@ static Test *tests_gnrc_sixlowpan_frag_vrb_tests(void)
         new_TestFixture(test_vrb_get__after_add),
         new_TestFixture(test_vrb_rm),
         new_TestFixture(test_vrb_gc),
+        new_TestFixture(test_vrb_gc__partial),
     };
 
     EMB_UNIT_TESTCALLER(vrb_tests, set_up, NULL, fixtures);
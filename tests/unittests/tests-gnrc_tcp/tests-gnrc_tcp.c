@@ -0,0 +1,633 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/tcp.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/tcp/tcb.h"
+#include "xtimer.h"
+#include "internal/cc.h"
+#include "internal/common.h"
+#include "internal/option.h"
+#include "internal/pkt.h"
+#include "internal/rcvbuf.h"
+
+#include "unittests-constants.h"
+#include "tests-gnrc_tcp.h"
+
+#define RCV_BUF_CONNS   (GNRC_TCP_RCV_BUF_BLOCKS / GNRC_TCP_RCV_BUF_RESERVED_BLOCKS)
+
+extern rcvbuf_t _static_buf;
+
+static struct {
+    tcp_hdr_t hdr;
+    uint8_t opts[(TCP_HDR_OFFSET_MAX - TCP_HDR_OFFSET_MIN) * 4];
+} _seg;
+static gnrc_tcp_tcb_t _tcbs[RCV_BUF_CONNS + 1];
+static uint8_t _data[GNRC_TCP_RCV_BUF_SIZE];
+static uint8_t _read[GNRC_TCP_RCV_BUF_SIZE];
+
+static void set_up(void)
+{
+    memset(&_seg, 0, sizeof(_seg));
+    memset(_tcbs, 0, sizeof(_tcbs));
+    for (size_t i = 0; i < sizeof(_data); i++) {
+        _data[i] = (uint8_t)i;
+    }
+    _rcvbuf_init();
+}
+
+static void _set_opts(const uint8_t *opts, size_t len)
+{
+    uint16_t words = TCP_HDR_OFFSET_MIN + ((len + 3) / 4);
+
+    memcpy(_seg.opts, opts, len);
+    _seg.hdr.off_ctl = byteorder_htons(_option_build_offset_control(words, MSK_SYN));
+}
+
+/* builds a data segment and puts it into the retransmit queue of tcb as
+ * _fsm_call_send() does */
+static void _send_seg(gnrc_tcp_tcb_t *tcb, size_t len)
+{
+    gnrc_pktsnip_t *payload, *tcp;
+    tcp_hdr_t *hdr;
+
+    payload = gnrc_pktbuf_add(NULL, _data, len, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(payload);
+    tcp = gnrc_pktbuf_add(payload, NULL, sizeof(tcp_hdr_t), GNRC_NETTYPE_TCP);
+    TEST_ASSERT_NOT_NULL(tcp);
+    hdr = tcp->data;
+    memset(hdr, 0, sizeof(*hdr));
+    hdr->seq_num = byteorder_htonl(tcb->snd_nxt);
+    hdr->off_ctl = byteorder_htons(_option_build_offset_control(TCP_HDR_OFFSET_MIN,
+                                                                MSK_ACK | MSK_PSH));
+    TEST_ASSERT_EQUAL_INT(0, _pkt_setup_retransmit(tcb, tcp, false));
+    tcb->snd_nxt += len;
+    /* sending consumes one user */
+    gnrc_pktbuf_release(tcp);
+}
+
+static void test_gnrc_tcp__option_parse_no_options(void)
+{
+    option_values_t opts;
+
+    _seg.hdr.off_ctl = byteorder_htons(_option_build_offset_control(TCP_HDR_OFFSET_MIN,
+                                                                   MSK_SYN));
+    TEST_ASSERT_EQUAL_INT(0, _option_parse(&_tcbs[0], &_seg.hdr, &opts));
+    TEST_ASSERT_EQUAL_INT(0, opts.found);
+}
+
+static void test_gnrc_tcp__option_parse_mss(void)
+{
+    static const uint8_t opt[] = { TCP_OPTION_KIND_MSS, TCP_OPTION_LENGTH_MSS, 0x05, 0xb4 };
+    option_values_t opts;
+
+    _set_opts(opt, sizeof(opt));
+    TEST_ASSERT_EQUAL_INT(0, _option_parse(&_tcbs[0], &_seg.hdr, &opts));
+    TEST_ASSERT_EQUAL_INT(1460, _tcbs[0].mss);
+    TEST_ASSERT_EQUAL_INT(0, opts.found);
+}
+
+static void test_gnrc_tcp__option_parse_wnd_scale(void)
+{
+    static const uint8_t opt[] = { TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_WS,
+                                   TCP_OPTION_LENGTH_WS, 7 };
+    option_values_t opts;
+
+    _set_opts(opt, sizeof(opt));
+    TEST_ASSERT_EQUAL_INT(0, _option_parse(&_tcbs[0], &_seg.hdr, &opts));
+    TEST_ASSERT_EQUAL_INT(OPTION_FOUND_WS, opts.found);
+    TEST_ASSERT_EQUAL_INT(7, opts.ws_shift);
+}
+
+static void test_gnrc_tcp__option_parse_wnd_scale_too_large(void)
+{
+    static const uint8_t opt[] = { TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_WS,
+                                   TCP_OPTION_LENGTH_WS, OPTION_WS_SHIFT_MAX + 1 };
+    option_values_t opts;
+
+    _set_opts(opt, sizeof(opt));
+    TEST_ASSERT_EQUAL_INT(0, _option_parse(&_tcbs[0], &_seg.hdr, &opts));
+    TEST_ASSERT_EQUAL_INT(OPTION_FOUND_WS, opts.found);
+    TEST_ASSERT_EQUAL_INT(OPTION_WS_SHIFT_MAX, opts.ws_shift);
+}
+
+static void test_gnrc_tcp__option_parse_timestamps(void)
+{
+    static const uint8_t opt[] = { TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP,
+                                   TCP_OPTION_KIND_TS, TCP_OPTION_LENGTH_TS,
+                                   0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0 };
+    option_values_t opts;
+
+    _set_opts(opt, sizeof(opt));
+    TEST_ASSERT_EQUAL_INT(0, _option_parse(&_tcbs[0], &_seg.hdr, &opts));
+    TEST_ASSERT_EQUAL_INT(OPTION_FOUND_TS, opts.found);
+    TEST_ASSERT(opts.ts_val == 0x12345678);
+    TEST_ASSERT(opts.ts_ecr == 0x9abcdef0);
+}
+
+static void test_gnrc_tcp__option_parse_all(void)
+{
+    /* Option layout of a Linux SYN */
+    static const uint8_t opt[] = { TCP_OPTION_KIND_MSS, TCP_OPTION_LENGTH_MSS, 0x05, 0xa0,
+                                   TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP,
+                                   TCP_OPTION_KIND_TS, TCP_OPTION_LENGTH_TS,
+                                   0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+                                   TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_WS,
+                                   TCP_OPTION_LENGTH_WS, 7 };
+    option_values_t opts;
+
+    _set_opts(opt, sizeof(opt));
+    TEST_ASSERT_EQUAL_INT(0, _option_parse(&_tcbs[0], &_seg.hdr, &opts));
+    TEST_ASSERT_EQUAL_INT(1440, _tcbs[0].mss);
+    TEST_ASSERT_EQUAL_INT(OPTION_FOUND_WS | OPTION_FOUND_TS, opts.found);
+    TEST_ASSERT_EQUAL_INT(7, opts.ws_shift);
+    TEST_ASSERT(opts.ts_val == 1);
+    TEST_ASSERT(opts.ts_ecr == 0);
+}
+
+static void test_gnrc_tcp__option_parse_eol(void)
+{
+    static const uint8_t opt[] = { TCP_OPTION_KIND_EOL, TCP_OPTION_KIND_WS,
+                                   TCP_OPTION_LENGTH_WS, 7 };
+    option_values_t opts;
+
+    _set_opts(opt, sizeof(opt));
+    TEST_ASSERT_EQUAL_INT(0, _option_parse(&_tcbs[0], &_seg.hdr, &opts));
+    TEST_ASSERT_EQUAL_INT(0, opts.found);
+}
+
+static void test_gnrc_tcp__option_parse_invalid_wnd_scale_length(void)
+{
+    static const uint8_t opt[] = { TCP_OPTION_KIND_WS, TCP_OPTION_LENGTH_WS + 1, 7, 0 };
+    option_values_t opts;
+
+    _set_opts(opt, sizeof(opt));
+    TEST_ASSERT_EQUAL_INT(-1, _option_parse(&_tcbs[0], &_seg.hdr, &opts));
+}
+
+static void test_gnrc_tcp__option_parse_invalid_timestamps_length(void)
+{
+    static const uint8_t opt[] = { TCP_OPTION_KIND_TS, TCP_OPTION_LENGTH_TS - 2,
+                                   0x00, 0x00, 0x00, 0x01, 0x00, 0x00 };
+    option_values_t opts;
+
+    _set_opts(opt, sizeof(opt));
+    TEST_ASSERT_EQUAL_INT(-1, _option_parse(&_tcbs[0], &_seg.hdr, &opts));
+}
+
+static void test_gnrc_tcp__option_parse_truncated_timestamps(void)
+{
+    /* Timestamps option does not fit into the option field */
+    static const uint8_t opt[] = { TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP,
+                                   TCP_OPTION_KIND_TS, TCP_OPTION_LENGTH_TS,
+                                   0x00, 0x00, 0x00, 0x01 };
+    option_values_t opts;
+
+    _set_opts(opt, sizeof(opt));
+    TEST_ASSERT_EQUAL_INT(-1, _option_parse(&_tcbs[0], &_seg.hdr, &opts));
+}
+
+static void test_gnrc_tcp__option_parse_zero_length(void)
+{
+    static const uint8_t opt[] = { 0x50, 0x00, 0x00, 0x00 };
+    option_values_t opts;
+
+    _set_opts(opt, sizeof(opt));
+    TEST_ASSERT_EQUAL_INT(-1, _option_parse(&_tcbs[0], &_seg.hdr, &opts));
+}
+
+static void test_gnrc_tcp__option_negotiate(void)
+{
+    option_values_t opts = { .found = OPTION_FOUND_WS | OPTION_FOUND_TS,
+                             .ws_shift = 7, .ts_val = 42, .ts_ecr = 0 };
+
+    _option_negotiate(&_tcbs[0], &opts);
+    TEST_ASSERT(_tcbs[0].status & STATUS_WND_SCALE);
+    TEST_ASSERT(_tcbs[0].status & STATUS_TIMESTAMPS);
+    TEST_ASSERT_EQUAL_INT(7, _tcbs[0].snd_wnd_scale);
+    TEST_ASSERT_EQUAL_INT(_option_wnd_scale(), _tcbs[0].rcv_wnd_scale);
+    TEST_ASSERT(_tcbs[0].ts_recent == 42);
+
+    /* Peer without options disables them again */
+    opts.found = 0;
+    _option_negotiate(&_tcbs[0], &opts);
+    TEST_ASSERT_EQUAL_INT(0, _tcbs[0].status & (STATUS_WND_SCALE | STATUS_TIMESTAMPS));
+    TEST_ASSERT_EQUAL_INT(0, _tcbs[0].snd_wnd_scale);
+    TEST_ASSERT_EQUAL_INT(0, _tcbs[0].rcv_wnd_scale);
+}
+
+static void test_gnrc_tcp__rcvbuf_exhausted(void)
+{
+    /* Reservations are small enough for more connections than receive
+     * buffers fit into the pool */
+    TEST_ASSERT(RCV_BUF_CONNS >= CONFIG_GNRC_TCP_RCV_BUFFERS);
+    for (unsigned i = 0; i < RCV_BUF_CONNS; i++) {
+        TEST_ASSERT_EQUAL_INT(0, _rcvbuf_get_buffer(&_tcbs[i]));
+    }
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, _rcvbuf_get_buffer(&_tcbs[RCV_BUF_CONNS]));
+
+    /* Requesting a buffer again does not take a second reservation */
+    TEST_ASSERT_EQUAL_INT(0, _rcvbuf_get_buffer(&_tcbs[0]));
+
+    _rcvbuf_release_buffer(&_tcbs[0]);
+    TEST_ASSERT_EQUAL_INT(0, _rcvbuf_get_buffer(&_tcbs[RCV_BUF_CONNS]));
+    TEST_ASSERT_EQUAL_INT(RCV_BUF_CONNS * GNRC_TCP_RCV_BUF_RESERVED_BLOCKS,
+                          _static_buf.reserved_numof);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_RCV_BUF_BLOCKS, _static_buf.free_numof);
+
+    /* The pool is no larger than the receive buffers it replaces */
+    TEST_ASSERT(sizeof(_static_buf.blocks) <=
+                CONFIG_GNRC_TCP_RCV_BUFFERS * GNRC_TCP_RCV_BUF_SIZE);
+}
+
+static void test_gnrc_tcp__rcvbuf_free_accounting(void)
+{
+    const size_t part = CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE + 1;
+
+    TEST_ASSERT_EQUAL_INT(0, _rcvbuf_get_buffer(&_tcbs[0]));
+    TEST_ASSERT(_rcvbuf_empty(&_tcbs[0]));
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_RCV_BUF_SIZE, _rcvbuf_get_free(&_tcbs[0]));
+
+    /* Blocks are only taken from the pool as data arrives */
+    TEST_ASSERT_EQUAL_INT(part, _rcvbuf_add(&_tcbs[0], _data, part));
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_RCV_BUF_BLOCKS - 2, _static_buf.free_numof);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_RCV_BUF_SIZE - part, _rcvbuf_get_free(&_tcbs[0]));
+
+    /* The receive buffer of a connection never grows beyond its maximum size */
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_RCV_BUF_SIZE - part,
+                          _rcvbuf_add(&_tcbs[0], _data + part, sizeof(_data)));
+    TEST_ASSERT_EQUAL_INT(0, _rcvbuf_get_free(&_tcbs[0]));
+    TEST_ASSERT_EQUAL_INT(0, _rcvbuf_add(&_tcbs[0], _data, 1));
+
+    /* Completely read blocks are returned to the pool */
+    TEST_ASSERT_EQUAL_INT(part, _rcvbuf_get(&_tcbs[0], _read, part));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data, _read, part));
+    TEST_ASSERT_EQUAL_INT(part, _rcvbuf_get_free(&_tcbs[0]));
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_RCV_BUF_BLOCKS + 1 -
+                          (GNRC_TCP_RCV_BUF_SIZE + CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE - 1) /
+                          CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE,
+                          _static_buf.free_numof);
+
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_RCV_BUF_SIZE - part,
+                          _rcvbuf_get(&_tcbs[0], _read, sizeof(_read)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data + part, _read, GNRC_TCP_RCV_BUF_SIZE - part));
+    TEST_ASSERT(_rcvbuf_empty(&_tcbs[0]));
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_RCV_BUF_BLOCKS, _static_buf.free_numof);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_RCV_BUF_SIZE, _rcvbuf_get_free(&_tcbs[0]));
+}
+
+static void test_gnrc_tcp__rcvbuf_release(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _rcvbuf_get_buffer(&_tcbs[0]));
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_RCV_BUF_SIZE,
+                          _rcvbuf_add(&_tcbs[0], _data, sizeof(_data)));
+    TEST_ASSERT(_static_buf.free_numof < GNRC_TCP_RCV_BUF_BLOCKS);
+
+    _rcvbuf_release_buffer(&_tcbs[0]);
+    TEST_ASSERT(_rcvbuf_empty(&_tcbs[0]));
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_RCV_BUF_BLOCKS, _static_buf.free_numof);
+    TEST_ASSERT_EQUAL_INT(0, _static_buf.reserved_numof);
+
+    /* Releasing twice must not return anything to the pool */
+    _rcvbuf_release_buffer(&_tcbs[0]);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_RCV_BUF_BLOCKS, _static_buf.free_numof);
+    TEST_ASSERT_EQUAL_INT(0, _static_buf.reserved_numof);
+}
+
+static void test_gnrc_tcp__rcvbuf_reservation(void)
+{
+    const size_t block = CONFIG_GNRC_TCP_RCV_BUF_BLOCK_SIZE;
+    const size_t reserved = GNRC_TCP_RCV_BUF_RESERVED_BLOCKS * block;
+    const size_t borrowed = (GNRC_TCP_RCV_BUF_BLOCKS - GNRC_TCP_RCV_BUF_RESERVED_BLOCKS) * block;
+    gnrc_tcp_tcb_t *a = &_tcbs[0];
+    gnrc_tcp_tcb_t *b = &_tcbs[1];
+
+    TEST_ASSERT_EQUAL_INT(0, _rcvbuf_get_buffer(a));
+    TEST_ASSERT_EQUAL_INT(0, _rcvbuf_get_buffer(b));
+
+    /* a borrows every block b did not reserve ... */
+    TEST_ASSERT(borrowed < GNRC_TCP_RCV_BUF_SIZE);
+    TEST_ASSERT_EQUAL_INT(borrowed, _rcvbuf_get_free(a));
+    TEST_ASSERT_EQUAL_INT(borrowed, _rcvbuf_add(a, _data, sizeof(_data)));
+    TEST_ASSERT_EQUAL_INT(0, _rcvbuf_get_free(a));
+    TEST_ASSERT_EQUAL_INT(0, _rcvbuf_add(a, _data, 1));
+
+    /* ... but b still gets its reservation */
+    TEST_ASSERT_EQUAL_INT(reserved, _rcvbuf_get_free(b));
+    TEST_ASSERT_EQUAL_INT(reserved, _rcvbuf_add(b, _data, sizeof(_data)));
+    TEST_ASSERT_EQUAL_INT(0, _rcvbuf_get_free(b));
+
+    /* Read blocks refill the reservation of a, the blocks it borrowed
+     * beyond that can be borrowed by b */
+    TEST_ASSERT_EQUAL_INT(borrowed, _rcvbuf_get(a, _read, sizeof(_read)));
+    TEST_ASSERT_EQUAL_INT(borrowed - reserved, _rcvbuf_get_free(b));
+    TEST_ASSERT_EQUAL_INT(borrowed, _rcvbuf_get_free(a));
+
+    /* Once a is closed, b borrows its blocks up to the full receive buffer */
+    _rcvbuf_release_buffer(a);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_RCV_BUF_SIZE - reserved, _rcvbuf_get_free(b));
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_RCV_BUF_SIZE - reserved,
+                          _rcvbuf_add(b, _data, sizeof(_data)));
+
+    _rcvbuf_release_buffer(b);
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_RCV_BUF_BLOCKS, _static_buf.free_numof);
+    TEST_ASSERT_EQUAL_INT(0, _static_buf.reserved_numof);
+}
+
+static void test_gnrc_tcp__pkt_acknowledge_cumulative(void)
+{
+    gnrc_tcp_tcb_t *tcb = &_tcbs[0];
+    gnrc_pktsnip_t *segs[CONFIG_GNRC_TCP_SND_QUEUE_SIZE];
+
+    gnrc_pktbuf_init();
+    tcb->snd_una = 1000;
+    tcb->snd_nxt = 1000;
+    for (unsigned i = 0; i < CONFIG_GNRC_TCP_SND_QUEUE_SIZE; i++) {
+        _send_seg(tcb, 100);
+        segs[i] = tcb->snd_queue[i];
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_TCP_SND_QUEUE_SIZE, tcb->snd_queue_len);
+
+    /* A partially acknowledged segment stays in the queue */
+    TEST_ASSERT_EQUAL_INT(0, _pkt_acknowledge(tcb, 1050, 0));
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_TCP_SND_QUEUE_SIZE, tcb->snd_queue_len);
+    TEST_ASSERT(tcb->snd_queue[0] == segs[0]);
+
+    /* One ACK releases all segments it covers, the oldest remaining one
+     * moves to the front */
+    TEST_ASSERT_EQUAL_INT(0, _pkt_acknowledge(tcb, 1200, 0));
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_TCP_SND_QUEUE_SIZE - 2, tcb->snd_queue_len);
+    TEST_ASSERT(tcb->snd_queue[0] == segs[2]);
+
+    TEST_ASSERT_EQUAL_INT(0, _pkt_acknowledge(tcb, tcb->snd_nxt, 0));
+    TEST_ASSERT_EQUAL_INT(0, tcb->snd_queue_len);
+    TEST_ASSERT_EQUAL_INT(-ENODATA, _pkt_acknowledge(tcb, tcb->snd_nxt, 0));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_gnrc_tcp__fast_retransmit(void)
+{
+    gnrc_tcp_tcb_t *tcb = &_tcbs[0];
+    uint32_t smss;
+
+    gnrc_pktbuf_init();
+    tcb->cc = GNRC_TCP_CC_DEFAULT;
+    tcb->mss = CONFIG_GNRC_TCP_MSS;
+    tcb->snd_wnd = UINT16_MAX;
+    _cc_init(tcb);
+    smss = gnrc_tcp_cc_smss(tcb);
+
+    /* The default queue keeps enough segments in flight to get the duplicate
+     * ACKs for a lost one */
+    while (tcb->snd_queue_len < CONFIG_GNRC_TCP_SND_QUEUE_SIZE) {
+        _send_seg(tcb, smss);
+    }
+    TEST_ASSERT(tcb->snd_queue_len > DUP_ACK_THRESHOLD);
+
+    /* The first segment is lost, every following one is answered by a
+     * duplicate ACK */
+    for (unsigned i = 1; i < tcb->snd_queue_len; i++) {
+        tcb->dup_acks++;
+        TEST_ASSERT_EQUAL_INT(tcb->dup_acks == DUP_ACK_THRESHOLD, _cc_dup_ack(tcb));
+    }
+    TEST_ASSERT(tcb->status & STATUS_FAST_RECOVERY);
+    TEST_ASSERT_EQUAL_INT(tcb->snd_nxt, tcb->recover);
+
+    /* Only the oldest segment is retransmitted */
+    TEST_ASSERT_EQUAL_INT(-EINVAL, _pkt_setup_retransmit(tcb, tcb->snd_queue[1], true));
+    TEST_ASSERT_EQUAL_INT(0, _pkt_setup_retransmit(tcb, tcb->snd_queue[0], true));
+    gnrc_pktbuf_release(tcb->snd_queue[0]);
+
+    /* The retransmission fills the hole, all data is acknowledged */
+    tcb->snd_una = tcb->snd_nxt;
+    tcb->dup_acks = 0;
+    TEST_ASSERT_EQUAL_INT(0, _pkt_acknowledge(tcb, tcb->snd_una, 0));
+    TEST_ASSERT(!_cc_ack(tcb, CONFIG_GNRC_TCP_SND_QUEUE_SIZE * smss));
+    TEST_ASSERT_EQUAL_INT(0, tcb->status & STATUS_FAST_RECOVERY);
+    TEST_ASSERT_EQUAL_INT(0, tcb->snd_queue_len);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+/* initializes congestion control of tcb with flight bytes in flight and
+ * returns the SMSS */
+static uint32_t _cc_set_up(gnrc_tcp_tcb_t *tcb, uint32_t flight)
+{
+    tcb->cc = GNRC_TCP_CC_DEFAULT;
+    tcb->mss = CONFIG_GNRC_TCP_MSS;
+    tcb->snd_una = 1000;
+    tcb->snd_nxt = 1000 + flight;
+    _cc_init(tcb);
+    return gnrc_tcp_cc_smss(tcb);
+}
+
+static void test_gnrc_tcp__cc_ack(void)
+{
+    gnrc_tcp_tcb_t *tcb = &_tcbs[0];
+    uint32_t smss = _cc_set_up(tcb, 0);
+    uint32_t cwnd = tcb->cwnd;
+
+    TEST_ASSERT_EQUAL_INT(3 * smss, cwnd);
+    TEST_ASSERT_EQUAL_INT(UINT32_MAX, tcb->ssthresh);
+
+    /* Slow start: Grow by the acknowledged bytes, but at most SMSS per ACK */
+    tcb->ssthresh = cwnd + smss + smss / 2;
+    TEST_ASSERT(!_cc_ack(tcb, smss / 2));
+    TEST_ASSERT_EQUAL_INT(cwnd + smss / 2, tcb->cwnd);
+    TEST_ASSERT(!_cc_ack(tcb, 2 * smss));
+    TEST_ASSERT_EQUAL_INT(cwnd + smss + smss / 2, tcb->cwnd);
+
+    /* Congestion avoidance once cwnd reached ssthresh: about SMSS per RTT */
+    cwnd = tcb->cwnd;
+    TEST_ASSERT(!_cc_ack(tcb, smss));
+    TEST_ASSERT_EQUAL_INT(cwnd + (smss * smss) / cwnd, tcb->cwnd);
+    TEST_ASSERT(tcb->cwnd < cwnd + smss);
+}
+
+static void test_gnrc_tcp__cc_dup_ack(void)
+{
+    gnrc_tcp_tcb_t *tcb = &_tcbs[0];
+    uint32_t smss = _cc_set_up(tcb, 0);
+
+    tcb->snd_nxt += 8 * smss;
+    tcb->cwnd = 8 * smss;
+
+    /* Below the threshold, duplicate ACKs change nothing */
+    for (tcb->dup_acks = 1; tcb->dup_acks < DUP_ACK_THRESHOLD; tcb->dup_acks++) {
+        TEST_ASSERT(!_cc_dup_ack(tcb));
+        TEST_ASSERT_EQUAL_INT(8 * smss, tcb->cwnd);
+    }
+
+    /* Enter fast recovery: Halve the flight size, inflate by the segments
+     * that left the network */
+    TEST_ASSERT(_cc_dup_ack(tcb));
+    TEST_ASSERT(tcb->status & STATUS_FAST_RECOVERY);
+    TEST_ASSERT_EQUAL_INT(4 * smss, tcb->ssthresh);
+    TEST_ASSERT_EQUAL_INT((4 + DUP_ACK_THRESHOLD) * smss, tcb->cwnd);
+    TEST_ASSERT_EQUAL_INT(tcb->snd_nxt, tcb->recover);
+
+    /* Every further duplicate ACK inflates the window by SMSS */
+    tcb->dup_acks++;
+    TEST_ASSERT(!_cc_dup_ack(tcb));
+    TEST_ASSERT_EQUAL_INT((5 + DUP_ACK_THRESHOLD) * smss, tcb->cwnd);
+
+    /* Partial ACK: Retransmit the next segment, deflate by the acknowledged
+     * bytes and stay in fast recovery */
+    tcb->snd_una += 2 * smss;
+    tcb->dup_acks = 0;
+    TEST_ASSERT(_cc_ack(tcb, 2 * smss));
+    TEST_ASSERT(tcb->status & STATUS_FAST_RECOVERY);
+    TEST_ASSERT_EQUAL_INT((4 + DUP_ACK_THRESHOLD) * smss, tcb->cwnd);
+
+    /* No second window reduction before the recovery point is acknowledged */
+    for (tcb->dup_acks = 1; tcb->dup_acks <= DUP_ACK_THRESHOLD; tcb->dup_acks++) {
+        TEST_ASSERT(!_cc_dup_ack(tcb));
+    }
+    TEST_ASSERT_EQUAL_INT(4 * smss, tcb->ssthresh);
+
+    /* Full ACK: Leave fast recovery with the window deflated to ssthresh */
+    tcb->snd_nxt += 4 * smss;
+    tcb->snd_una = tcb->recover;
+    tcb->dup_acks = 0;
+    TEST_ASSERT(!_cc_ack(tcb, 6 * smss));
+    TEST_ASSERT_EQUAL_INT(0, tcb->status & STATUS_FAST_RECOVERY);
+    TEST_ASSERT_EQUAL_INT(4 * smss, tcb->cwnd);
+}
+
+static void test_gnrc_tcp__cc_timeout(void)
+{
+    gnrc_tcp_tcb_t *tcb = &_tcbs[0];
+    uint32_t smss = _cc_set_up(tcb, 0);
+
+    tcb->snd_nxt += 8 * smss;
+    tcb->cwnd = 8 * smss;
+    tcb->dup_acks = DUP_ACK_THRESHOLD;
+    TEST_ASSERT(_cc_dup_ack(tcb));
+
+    /* A timeout ends fast recovery and restarts with one segment */
+    _cc_timeout(tcb);
+    TEST_ASSERT_EQUAL_INT(4 * smss, tcb->ssthresh);
+    TEST_ASSERT_EQUAL_INT(smss, tcb->cwnd);
+    TEST_ASSERT_EQUAL_INT(tcb->snd_nxt, tcb->recover);
+    TEST_ASSERT_EQUAL_INT(0, tcb->status & STATUS_FAST_RECOVERY);
+    TEST_ASSERT(tcb->status & STATUS_RTO_RECOVERY);
+
+    /* Repeated timeouts of the same segment do not reduce ssthresh again */
+    tcb->retries = 1;
+    tcb->snd_una += 4 * smss;
+    _cc_timeout(tcb);
+    TEST_ASSERT_EQUAL_INT(4 * smss, tcb->ssthresh);
+    TEST_ASSERT_EQUAL_INT(smss, tcb->cwnd);
+
+    /* Slow start retransmits everything that was in flight ... */
+    tcb->retries = 0;
+    tcb->snd_una += smss;
+    TEST_ASSERT(_cc_ack(tcb, smss));
+    TEST_ASSERT_EQUAL_INT(2 * smss, tcb->cwnd);
+    TEST_ASSERT(tcb->status & STATUS_RTO_RECOVERY);
+
+    /* ... until the data sent before the timeout is acknowledged */
+    tcb->snd_una = tcb->snd_nxt;
+    TEST_ASSERT(!_cc_ack(tcb, 3 * smss));
+    TEST_ASSERT_EQUAL_INT(3 * smss, tcb->cwnd);
+    TEST_ASSERT_EQUAL_INT(0, tcb->status & STATUS_RTO_RECOVERY);
+}
+
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+static void test_gnrc_tcp__pkt_calc_csum_pktsnip_csum(void)
+{
+    static ipv6_hdr_t ipv6_data = {
+        .src = { .u8 = { 0xfe, 0x80, [15] = 0x01 } },
+        .dst = { .u8 = { 0xfe, 0x80, [15] = 0x02 } },
+    };
+    static const gnrc_pktsnip_t ipv6 = {
+        .data = &ipv6_data,
+        .size = sizeof(ipv6_data),
+        .type = GNRC_NETTYPE_IPV6,
+    };
+
+    gnrc_pktbuf_init();
+    for (size_t size = 1; size <= 8; size++) {
+        gnrc_pktsnip_t *payload, *tcp;
+        uint16_t stored, full;
+
+        payload = gnrc_pktbuf_add_csum(NULL, _data, size, GNRC_NETTYPE_UNDEF);
+        TEST_ASSERT_NOT_NULL(payload);
+        TEST_ASSERT(payload->csum != 0);
+        tcp = gnrc_pktbuf_add(payload, NULL, sizeof(tcp_hdr_t), GNRC_NETTYPE_TCP);
+        TEST_ASSERT_NOT_NULL(tcp);
+        memset(tcp->data, 0xa5, sizeof(tcp_hdr_t));
+
+        stored = _pkt_calc_csum(tcp, &ipv6, payload);
+        payload->csum = 0;
+        full = _pkt_calc_csum(tcp, &ipv6, payload);
+        TEST_ASSERT(full != 0);
+        TEST_ASSERT_EQUAL_INT(full, stored);
+
+        /* the stored checksum is dropped when the payload shrinks */
+        payload->csum = inet_csum(0, payload->data, payload->size);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(payload, size - 1));
+        stored = _pkt_calc_csum(tcp, &ipv6, payload);
+        payload->csum = 0;
+        TEST_ASSERT_EQUAL_INT(_pkt_calc_csum(tcp, &ipv6, payload), stored);
+        gnrc_pktbuf_release(tcp);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif /* MODULE_GNRC_PKTSNIP_CSUM */
+
+Test *tests_gnrc_tcp_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_gnrc_tcp__option_parse_no_options),
+        new_TestFixture(test_gnrc_tcp__option_parse_mss),
+        new_TestFixture(test_gnrc_tcp__option_parse_wnd_scale),
+        new_TestFixture(test_gnrc_tcp__option_parse_wnd_scale_too_large),
+        new_TestFixture(test_gnrc_tcp__option_parse_timestamps),
+        new_TestFixture(test_gnrc_tcp__option_parse_all),
+        new_TestFixture(test_gnrc_tcp__option_parse_eol),
+        new_TestFixture(test_gnrc_tcp__option_parse_invalid_wnd_scale_length),
+        new_TestFixture(test_gnrc_tcp__option_parse_invalid_timestamps_length),
+        new_TestFixture(test_gnrc_tcp__option_parse_truncated_timestamps),
+        new_TestFixture(test_gnrc_tcp__option_parse_zero_length),
+        new_TestFixture(test_gnrc_tcp__option_negotiate),
+        new_TestFixture(test_gnrc_tcp__rcvbuf_exhausted),
+        new_TestFixture(test_gnrc_tcp__rcvbuf_free_accounting),
+        new_TestFixture(test_gnrc_tcp__rcvbuf_release),
+        new_TestFixture(test_gnrc_tcp__rcvbuf_reservation),
+        new_TestFixture(test_gnrc_tcp__pkt_acknowledge_cumulative),
+        new_TestFixture(test_gnrc_tcp__fast_retransmit),
+        new_TestFixture(test_gnrc_tcp__cc_ack),
+        new_TestFixture(test_gnrc_tcp__cc_dup_ack),
+        new_TestFixture(test_gnrc_tcp__cc_timeout),
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+        new_TestFixture(test_gnrc_tcp__pkt_calc_csum_pktsnip_csum),
+#endif
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_tcp_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_tcp_tests;
+}
+
+void tests_gnrc_tcp(void)
+{
+    TESTS_RUN(tests_gnrc_tcp_tests());
+}
+/** @} */
@@ -12,12 +12,18 @@
  * @file
  */
 #include <errno.h>
+#include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
 #include "net/gnrc/udp.h"
 #include "net/ipv6/hdr.h"
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+#include "net/gnrc/pktbuf.h"
+#include "net/protnum.h"
+#endif
 
 #include "unittests-constants.h"
 #include "tests-gnrc_udp.h"
@@ -240,6 +246,152 @@ static void test_gnrc_udp__csum_all(void)
     }
 }
 
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+static const uint8_t csum_data[] = TEST_STRING64;
+
+static ipv6_hdr_t csum_ipv6_data = {
+    .nh = PROTNUM_UDP,
+    .src = { .u8 = { 0xfe, 0x80, [15] = 0x01 } },
+    .dst = { .u8 = { 0xfe, 0x80, [15] = 0x02 } },
+};
+
+static gnrc_pktsnip_t csum_ipv6 = {
+    .data = &csum_ipv6_data,
+    .size = sizeof(csum_ipv6_data),
+    .type = GNRC_NETTYPE_IPV6,
+};
+
+/* calculates the UDP checksum of udp, optionally without the payload
+ * checksums stored in the packet snips */
+static uint16_t _pkt_csum(gnrc_pktsnip_t *udp, bool use_stored)
+{
+    uint16_t stored[4] = { 0 };
+    unsigned i = 0;
+
+    if (!use_stored) {
+        for (gnrc_pktsnip_t *snip = udp->next; snip != NULL; snip = snip->next) {
+            stored[i++] = snip->csum;
+            snip->csum = 0;
+        }
+    }
+    ((udp_hdr_t *)udp->data)->checksum = byteorder_htons(0);
+    if (gnrc_udp_calc_csum(udp, &csum_ipv6) < 0) {
+        return 0;
+    }
+    i = 0;
+    if (!use_stored) {
+        for (gnrc_pktsnip_t *snip = udp->next; snip != NULL; snip = snip->next) {
+            snip->csum = stored[i++];
+        }
+    }
+    return byteorder_ntohs(((udp_hdr_t *)udp->data)->checksum);
+}
+
+/* calculates the UDP checksum of the data in a single, unchecksummed snip */
+static uint16_t _data_csum(const uint8_t *data, size_t size)
+{
+    gnrc_pktsnip_t *udp;
+    uint16_t csum;
+
+    udp = gnrc_pktbuf_add(NULL, data, size, GNRC_NETTYPE_UNDEF);
+    udp = gnrc_pktbuf_add(udp, NULL, sizeof(udp_hdr_t), GNRC_NETTYPE_UDP);
+    if (udp == NULL) {
+        return 0;
+    }
+    memset(udp->data, 0, sizeof(udp_hdr_t));
+    csum = _pkt_csum(udp, false);
+    gnrc_pktbuf_release(udp);
+    return csum;
+}
+
+static void test_gnrc_udp__csum_pktsnip_csum(void)
+{
+    gnrc_pktbuf_init();
+    /* split the payload at odd and even positions into two snips */
+    for (size_t split = 0; split <= 5; split++) {
+        gnrc_pktsnip_t *udp;
+        uint16_t expected = _data_csum(csum_data, sizeof(csum_data));
+
+        TEST_ASSERT(expected != 0);
+        udp = gnrc_pktbuf_add_csum(NULL, &csum_data[split],
+                                   sizeof(csum_data) - split,
+                                   GNRC_NETTYPE_UNDEF);
+        TEST_ASSERT_NOT_NULL(udp);
+        if (split > 0) {
+            udp = gnrc_pktbuf_add_csum(udp, csum_data, split, GNRC_NETTYPE_UNDEF);
+            TEST_ASSERT_NOT_NULL(udp);
+            TEST_ASSERT(udp->csum != 0);
+        }
+        TEST_ASSERT(udp->next == NULL || udp->next->csum != 0);
+        udp = gnrc_pktbuf_add(udp, NULL, sizeof(udp_hdr_t), GNRC_NETTYPE_UDP);
+        TEST_ASSERT_NOT_NULL(udp);
+        memset(udp->data, 0, sizeof(udp_hdr_t));
+
+        TEST_ASSERT_EQUAL_INT(expected, _pkt_csum(udp, true));
+        TEST_ASSERT_EQUAL_INT(expected, _pkt_csum(udp, false));
+        gnrc_pktbuf_release(udp);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_gnrc_udp__csum_pktsnip_csum_zeros(void)
+{
+    static const uint8_t zeros[8] = { 0 };
+    gnrc_pktsnip_t *udp;
+
+    gnrc_pktbuf_init();
+    udp = gnrc_pktbuf_add_csum(NULL, zeros, sizeof(zeros), GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(udp);
+    udp = gnrc_pktbuf_add_csum(udp, zeros, 3, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(udp);
+    udp = gnrc_pktbuf_add(udp, NULL, sizeof(udp_hdr_t), GNRC_NETTYPE_UDP);
+    TEST_ASSERT_NOT_NULL(udp);
+    memset(udp->data, 0, sizeof(udp_hdr_t));
+
+    TEST_ASSERT_EQUAL_INT(_pkt_csum(udp, false), _pkt_csum(udp, true));
+    gnrc_pktbuf_release(udp);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_gnrc_udp__csum_pktsnip_csum_mark(void)
+{
+    gnrc_pktsnip_t *payload, *udp;
+
+    gnrc_pktbuf_init();
+    payload = gnrc_pktbuf_add_csum(NULL, csum_data, sizeof(csum_data),
+                                   GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(payload);
+    /* marks the first 5 bytes, the remaining data stays in payload */
+    TEST_ASSERT_NOT_NULL(gnrc_pktbuf_mark(payload, 5, GNRC_NETTYPE_UNDEF));
+    udp = gnrc_pktbuf_add(payload, NULL, sizeof(udp_hdr_t), GNRC_NETTYPE_UDP);
+    TEST_ASSERT_NOT_NULL(udp);
+    memset(udp->data, 0, sizeof(udp_hdr_t));
+
+    TEST_ASSERT_EQUAL_INT(_pkt_csum(udp, false), _pkt_csum(udp, true));
+    gnrc_pktbuf_release(udp);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_gnrc_udp__csum_pktsnip_csum_realloc(void)
+{
+    gnrc_pktsnip_t *payload, *udp;
+
+    gnrc_pktbuf_init();
+    payload = gnrc_pktbuf_add_csum(NULL, csum_data, sizeof(csum_data),
+                                   GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(payload);
+    udp = gnrc_pktbuf_add(payload, NULL, sizeof(udp_hdr_t), GNRC_NETTYPE_UDP);
+    TEST_ASSERT_NOT_NULL(udp);
+    memset(udp->data, 0, sizeof(udp_hdr_t));
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(payload, 33));
+    TEST_ASSERT_EQUAL_INT(_data_csum(csum_data, 33), _pkt_csum(udp, true));
+    TEST_ASSERT_EQUAL_INT(_pkt_csum(udp, false), _pkt_csum(udp, true));
+    gnrc_pktbuf_release(udp);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif /* MODULE_GNRC_PKTSNIP_CSUM */
+
 Test *tests_gnrc_udp_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -252,6 +404,12 @@ Test *tests_gnrc_udp_tests(void)
         new_TestFixture(test_gnrc_udp__csum_ffff),
         new_TestFixture(test_gnrc_udp__csum_zero),
         new_TestFixture(test_gnrc_udp__csum_all),
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+        new_TestFixture(test_gnrc_udp__csum_pktsnip_csum),
+        new_TestFixture(test_gnrc_udp__csum_pktsnip_csum_zeros),
+        new_TestFixture(test_gnrc_udp__csum_pktsnip_csum_mark),
+        new_TestFixture(test_gnrc_udp__csum_pktsnip_csum_realloc),
+#endif
     };
 
     EMB_UNIT_TESTCALLER(gnrc_udp_tests, NULL, NULL, fixtures);
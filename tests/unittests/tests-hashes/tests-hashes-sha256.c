@@ -252,6 +252,32 @@ static void test_hashes_sha256_hash_long_sequence(void)
     TEST_ASSERT(calc_and_compare_hash_wrapper(teststring, hlong_sequence));
 }
 
+static void test_hashes_sha256_hash_long_sequence_split(void)
+{
+    static const char *teststring =
+        {"RIOT is an open-source microkernel-based operating system, designed"
+        " to match the requirements of Internet of Things (IoT) devices and"
+        " other embedded devices. These requirements include a very low memory"
+        " footprint (on the order of a few kilobytes), high energy efficiency"
+        ", real-time capabilities, communication stacks for both wireless and"
+        " wired networks, and support for a wide range of low-power hardware."};
+    size_t len = strlen(teststring);
+
+    /* the parts before and after the split point have all possible offsets to
+     * a block boundary */
+    for (size_t split = 0; split <= 130; split++) {
+        unsigned char hash[SHA256_DIGEST_LENGTH];
+        sha256_context_t sha256;
+
+        sha256_init(&sha256);
+        sha256_update(&sha256, teststring, split);
+        sha256_update(&sha256, teststring + split, len - split);
+        sha256_final(&sha256, hash);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(hlong_sequence, hash,
+                                        SHA256_DIGEST_LENGTH));
+    }
+}
+
 static void test_hashes_sha256_hash_sequence_abc(void)
 {
     static const char *teststring = "abc";
@@ -281,6 +307,7 @@ Test *tests_hashes_sha256_tests(void)
         new_TestFixture(test_hashes_sha256_hash_sequence_failing_compare),
 
         new_TestFixture(test_hashes_sha256_hash_long_sequence),
+        new_TestFixture(test_hashes_sha256_hash_long_sequence_split),
 
         new_TestFixture(test_hashes_sha256_hash_sequence_abc),
         new_TestFixture(test_hashes_sha256_hash_sequence_abc_long),
@@ -13,6 +13,7 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
@@ -165,6 +166,87 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+/* sums up byte-wise, to compare against the word-wise implementation */
+static uint16_t _csum_bytewise(uint16_t sum, const uint8_t *buf, size_t len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < len; i++) {
+        csum += (i & 1) ? buf[i] : (buf[i] << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void test_inet_csum__alignment(void)
+{
+    uint8_t data[300 + sizeof(uint64_t)];
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        data[i] = 0xff - (i * 7);
+    }
+    for (unsigned offset = 0; offset < sizeof(uint64_t); offset++) {
+        for (unsigned len = 0; len <= 300; len += 13) {
+            uint16_t expected = _csum_bytewise(0x1234, &data[offset], len);
+
+            TEST_ASSERT_EQUAL_INT(expected,
+                                  inet_csum(0x1234, &data[offset], len));
+            /* split into two slices at an odd length */
+            if (len > 3) {
+                uint16_t sum = inet_csum_slice(0x1234, &data[offset], 3, 0);
+
+                TEST_ASSERT_EQUAL_INT(expected,
+                                      inet_csum_slice(sum, &data[offset + 3],
+                                                      len - 3, 3));
+            }
+        }
+    }
+}
+
+static void test_inet_csum__copy(void)
+{
+    uint8_t data[300 + sizeof(uint64_t)];
+    uint8_t dst[300 + sizeof(uint64_t)];
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        data[i] = 0xff - (i * 7);
+    }
+    for (unsigned offset = 0; offset < sizeof(uint64_t); offset++) {
+        for (unsigned len = 0; len <= 300; len += 13) {
+            uint16_t expected = inet_csum(0x1234, &data[offset], len);
+
+            memset(dst, 0, sizeof(dst));
+            TEST_ASSERT_EQUAL_INT(expected,
+                                  inet_csum_copy(0x1234, &dst[sizeof(dst) - len],
+                                                 &data[offset], len));
+            TEST_ASSERT_EQUAL_INT(0, memcmp(&dst[sizeof(dst) - len],
+                                            &data[offset], len));
+            /* add checksum of slice calculated standalone at an odd length */
+            if (len > 3) {
+                uint16_t sum = inet_csum_slice(0x1234, &data[offset], 3, 0);
+                uint16_t slice = inet_csum(0, &data[offset + 3], len - 3);
+
+                /* 0x0000 and 0xffff are equivalent in one's complement */
+                TEST_ASSERT_EQUAL_INT(expected % 0xffff,
+                                      inet_csum_add(sum, slice, 3) % 0xffff);
+            }
+        }
+    }
+}
+
+static void test_inet_csum__all_ones(void)
+{
+    uint8_t data[256];
+
+    memset(data, 0xff, sizeof(data));
+    /* sum must not be normalized to 0 */
+    TEST_ASSERT_EQUAL_INT(0xffff, inet_csum(0, data, sizeof(data)));
+    memset(data, 0, sizeof(data));
+    TEST_ASSERT_EQUAL_INT(0, inet_csum(0, data, sizeof(data)));
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +258,9 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__alignment),
+        new_TestFixture(test_inet_csum__copy),
+        new_TestFixture(test_inet_csum__all_ones),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
@@ -139,6 +139,42 @@ void test_netreg_getnext__2_entries(void)
     TEST_ASSERT_NOT_NULL(gnrc_netreg_getnext(res));
 }
 
+void test_netreg_num__many_demux_ctx(void)
+{
+    gnrc_netreg_entry_t many[16];
+    gnrc_netreg_entry_t all = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                         TEST_UINT8);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i++) {
+        gnrc_netreg_entry_init_pid(&many[i], TEST_UINT16 + (i % 8), TEST_UINT8);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &many[i]));
+    }
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &all));
+    for (unsigned i = 0; i < 8; i++) {
+        gnrc_netreg_entry_t *res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16 + i);
+        int num = 0;
+
+        TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(many) / 8,
+                              gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16 + i));
+        while (res != NULL) {
+            TEST_ASSERT_EQUAL_INT(TEST_UINT16 + i, res->demux_ctx);
+            res = gnrc_netreg_getnext(res);
+            num++;
+        }
+        TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(many) / 8, num);
+    }
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_TEST, GNRC_NETREG_DEMUX_CTX_ALL));
+    TEST_ASSERT(&all == gnrc_netreg_lookup(GNRC_NETTYPE_TEST, GNRC_NETREG_DEMUX_CTX_ALL));
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i++) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &many[i]);
+    }
+    gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &all);
+    for (unsigned i = 0; i < 8; i++) {
+        TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16 + i));
+    }
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, GNRC_NETREG_DEMUX_CTX_ALL));
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -155,6 +191,7 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_num__many_demux_ctx),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
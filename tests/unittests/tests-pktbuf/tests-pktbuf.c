@@ -21,6 +21,9 @@
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/pkt.h"
 #include "net/gnrc/pktbuf.h"
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+#include "net/inet_csum.h"
+#endif
 
 #include "unittests-constants.h"
 #include "tests-pktbuf.h"
@@ -245,7 +248,9 @@ static void test_pktbuf_add__packed_struct(void)
     TEST_ASSERT_EQUAL_INT(data.s64, data_cpy->s64);
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC   /* alignment-handling left to malloc, so no certainty here */
+/* alignment-handling left to malloc, and gnrc_pktbuf_slab reuses the same
+ * slot, so no certainty here */
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
 static void test_pktbuf_add__unaligned_in_aligned_hole(void)
 {
     gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, NULL, 8, GNRC_NETTYPE_TEST);
@@ -321,7 +326,8 @@ static void test_pktbuf_mark__pkt_NOT_NULL__size_greater_than_pkt_size(void)
 
 static void test_pktbuf_mark__pkt_NOT_NULL__pkt_data_NULL(void)
 {
-    gnrc_pktsnip_t pkt = { NULL, NULL, sizeof(TEST_STRING16), 1, GNRC_NETTYPE_TEST };
+    gnrc_pktsnip_t pkt = { .next = NULL, .data = NULL, .size = sizeof(TEST_STRING16),
+                           .users = 1, .type = GNRC_NETTYPE_TEST };
 
     TEST_ASSERT_NULL(gnrc_pktbuf_mark(&pkt, sizeof(TEST_STRING16) - 1,
                                       GNRC_NETTYPE_TEST));
@@ -709,7 +715,8 @@ static void test_pktbuf_hold__pkt_null(void)
 
 static void test_pktbuf_hold__pkt_external(void)
 {
-    gnrc_pktsnip_t pkt = { NULL, (void *)TEST_STRING8, sizeof(TEST_STRING8), 1, GNRC_NETTYPE_TEST };
+    gnrc_pktsnip_t pkt = { .next = NULL, .data = (void *)TEST_STRING8, .size = sizeof(TEST_STRING8),
+                           .users = 1, .type = GNRC_NETTYPE_TEST };
 
     gnrc_pktbuf_hold(&pkt, 1);
     TEST_ASSERT(gnrc_pktbuf_is_empty());
@@ -813,7 +820,8 @@ static void test_pktbuf_start_write__pkt_users_2(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+/* gnrc_pktbuf_slab has space outside of CONFIG_GNRC_PKTBUF_SIZE */
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
 static void test_pktbuf_reverse_snips__too_full(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_next, *pkt_huge;
@@ -835,7 +843,7 @@ static void test_pktbuf_reverse_snips__too_full(void)
     gnrc_pktbuf_release(pkt_next);
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#endif /* !MODULE_GNRC_PKTBUF_MALLOC && !MODULE_GNRC_PKTBUF_SLAB */
 
 static void test_pktbuf_reverse_snips__success(void)
 {
@@ -852,6 +860,146 @@ static void test_pktbuf_reverse_snips__success(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+static void test_pktbuf_add_csum__size_0(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    pkt = gnrc_pktbuf_add_csum(NULL, TEST_STRING8, 0, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(0, pkt->csum);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add_csum__success(void)
+{
+    static const char data[] = TEST_STRING64;
+
+    for (size_t size = 1; size <= sizeof(data); size++) {
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add_csum(NULL, data, size,
+                                                   GNRC_NETTYPE_TEST);
+
+        TEST_ASSERT_NOT_NULL(pkt);
+        TEST_ASSERT_EQUAL_INT(size, pkt->size);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(data, pkt->data, size));
+        TEST_ASSERT_EQUAL_INT(inet_csum(0, pkt->data, size), pkt->csum);
+        gnrc_pktbuf_release(pkt);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add_csum__zeros(void)
+{
+    static const uint8_t data[7] = { 0 };
+    gnrc_pktsnip_t *pkt;
+
+    pkt = gnrc_pktbuf_add_csum(NULL, data, sizeof(data), GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    /* 0 marks an unknown checksum, so the equivalent 0xffff is stored */
+    TEST_ASSERT_EQUAL_INT(0xffff, pkt->csum);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add__csum_unknown(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    pkt = gnrc_pktbuf_add(NULL, TEST_STRING8, sizeof(TEST_STRING8),
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(0, pkt->csum);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_mark__csum_reset(void)
+{
+    gnrc_pktsnip_t *pkt, *hdr;
+
+    pkt = gnrc_pktbuf_add_csum(NULL, TEST_STRING16, sizeof(TEST_STRING16),
+                               GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT(pkt->csum != 0);
+    hdr = gnrc_pktbuf_mark(pkt, 3, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT_EQUAL_INT(0, pkt->csum);
+    TEST_ASSERT_EQUAL_INT(0, hdr->csum);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_realloc_data__csum_reset(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    pkt = gnrc_pktbuf_add_csum(NULL, TEST_STRING16, sizeof(TEST_STRING16),
+                               GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT(pkt->csum != 0);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 5));
+    TEST_ASSERT_EQUAL_INT(0, pkt->csum);
+    pkt->csum = inet_csum(0, pkt->data, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, sizeof(TEST_STRING64)));
+    TEST_ASSERT_EQUAL_INT(0, pkt->csum);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_merge_data__csum_reset(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    pkt = gnrc_pktbuf_add_csum(NULL, TEST_STRING8, sizeof(TEST_STRING8),
+                               GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    pkt = gnrc_pktbuf_add_csum(pkt, TEST_STRING16, sizeof(TEST_STRING16),
+                               GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_merge(pkt));
+    TEST_ASSERT_EQUAL_INT(0, pkt->csum);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif /* MODULE_GNRC_PKTSNIP_CSUM */
+
+#if defined(MODULE_GNRC_PKTBUF_SLAB) && defined(DEVELHELP)
+static void test_pktbuf_slab_class_stats(void)
+{
+    gnrc_pktbuf_slab_class_t snips, stats;
+    gnrc_pktsnip_t *pkt;
+
+    gnrc_pktbuf_max_used_reset();
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_slab_class_stats(0, &snips));
+    TEST_ASSERT_EQUAL_INT(0, snips.used);
+    TEST_ASSERT_EQUAL_INT(0, snips.max_used);
+    pkt = gnrc_pktbuf_add(NULL, TEST_STRING8, 8, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    pkt = gnrc_pktbuf_add(pkt, TEST_STRING8, 8, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_slab_class_stats(0, &snips));
+    TEST_ASSERT_EQUAL_INT(2, snips.used);
+    TEST_ASSERT_EQUAL_INT(2, snips.max_used);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF, snips.numof);
+    /* the payload is in the class with the smallest slots */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_slab_class_stats(1, &stats));
+    TEST_ASSERT_EQUAL_INT(2, stats.used);
+    TEST_ASSERT(stats.size >= 8);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_slab_class_stats(0, &snips));
+    TEST_ASSERT_EQUAL_INT(0, snips.used);
+    TEST_ASSERT_EQUAL_INT(2, snips.max_used);
+    gnrc_pktbuf_max_used_reset();
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_slab_class_stats(0, &snips));
+    TEST_ASSERT_EQUAL_INT(0, snips.max_used);
+    /* snips, small and medium payloads */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_slab_class_stats(2, &stats));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, gnrc_pktbuf_slab_class_stats(3, &stats));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif /* MODULE_GNRC_PKTBUF_SLAB && DEVELHELP */
+
 Test *tests_pktbuf_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -868,7 +1016,7 @@ Test *tests_pktbuf_tests(void)
 #endif
         new_TestFixture(test_pktbuf_add__success),
         new_TestFixture(test_pktbuf_add__packed_struct),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
         new_TestFixture(test_pktbuf_add__unaligned_in_aligned_hole),
 #endif
         new_TestFixture(test_pktbuf_add__0_sized_release),
@@ -906,10 +1054,22 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_start_write__NULL),
         new_TestFixture(test_pktbuf_start_write__pkt_users_1),
         new_TestFixture(test_pktbuf_start_write__pkt_users_2),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
         new_TestFixture(test_pktbuf_reverse_snips__too_full),
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#endif
         new_TestFixture(test_pktbuf_reverse_snips__success),
+#ifdef MODULE_GNRC_PKTSNIP_CSUM
+        new_TestFixture(test_pktbuf_add_csum__size_0),
+        new_TestFixture(test_pktbuf_add_csum__success),
+        new_TestFixture(test_pktbuf_add_csum__zeros),
+        new_TestFixture(test_pktbuf_add__csum_unknown),
+        new_TestFixture(test_pktbuf_mark__csum_reset),
+        new_TestFixture(test_pktbuf_realloc_data__csum_reset),
+        new_TestFixture(test_pktbuf_merge_data__csum_reset),
+#endif
+#if defined(MODULE_GNRC_PKTBUF_SLAB) && defined(DEVELHELP)
+        new_TestFixture(test_pktbuf_slab_class_stats),
+#endif
     };
 
     EMB_UNIT_TESTCALLER(gnrc_pktbuf_tests, set_up, NULL, fixtures);
@@ -162,6 +162,75 @@ static void test_add(void)
     }
 }
 
+static void test_add_get_wrap_around(void)
+{
+    for (int i = 0; i < (int)sizeof(_io_buffer); i++) {
+        _io_buffer[i] = TEST_INPUT + i;
+    }
+    /* move the start of the data close to the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 3, tsrb_add(&_tsrb, _io_buffer,
+                                                    BUFFER_SIZE - 3));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 3, tsrb_drop(&_tsrb, BUFFER_SIZE));
+    /* data wraps around the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_add(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(1, tsrb_full(&_tsrb));
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_get(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i), _io_buffer[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(IO_BUFFER_CANARY, _io_buffer[BUFFER_SIZE]);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_empty(&_tsrb));
+}
+
+static void test_get_region(void)
+{
+    uint8_t *data;
+
+    TEST_ASSERT_EQUAL_INT(0, tsrb_get_region(&_tsrb, &data));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, tsrb_add_one(&_tsrb, TEST_INPUT + i));
+    }
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_get_region(&_tsrb, &data));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, data[0]);
+    tsrb_get_commit(&_tsrb, BUFFER_SIZE - 2);
+    TEST_ASSERT_EQUAL_INT(2, tsrb_avail(&_tsrb));
+    /* the region ends at the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(0, tsrb_add_one(&_tsrb, TEST_INPUT));
+    TEST_ASSERT_EQUAL_INT(2, tsrb_get_region(&_tsrb, &data));
+    TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + BUFFER_SIZE - 2), data[0]);
+    tsrb_get_commit(&_tsrb, 2);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_get_region(&_tsrb, &data));
+    TEST_ASSERT(data == _tsrb_buffer);
+    tsrb_get_commit(&_tsrb, 1);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_empty(&_tsrb));
+}
+
+static void test_add_region(void)
+{
+    uint8_t *data;
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_add_region(&_tsrb, &data));
+    TEST_ASSERT(data == _tsrb_buffer);
+    memset(data, TEST_INPUT, BUFFER_SIZE - 2);
+    tsrb_add_commit(&_tsrb, BUFFER_SIZE - 2);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 2, tsrb_avail(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(2, tsrb_add_region(&_tsrb, &data));
+    tsrb_add_commit(&_tsrb, 2);
+    TEST_ASSERT_EQUAL_INT(0, tsrb_add_region(&_tsrb, &data));
+    TEST_ASSERT_EQUAL_INT(4, tsrb_drop(&_tsrb, 4));
+    /* the free space starts at the beginning of the buffer again */
+    TEST_ASSERT_EQUAL_INT(4, tsrb_add_region(&_tsrb, &data));
+    TEST_ASSERT(data == _tsrb_buffer);
+    data[0] = TEST_INPUT + 1;
+    tsrb_add_commit(&_tsrb, 1);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 3, tsrb_avail(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 4, tsrb_drop(&_tsrb, BUFFER_SIZE - 4));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT + 1, tsrb_get_one(&_tsrb));
+}
+
 static Test *tests_tsrb_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -174,6 +243,9 @@ static Test *tests_tsrb_tests(void)
         new_TestFixture(test_drop),
         new_TestFixture(test_add_one),
         new_TestFixture(test_add),
+        new_TestFixture(test_add_get_wrap_around),
+        new_TestFixture(test_get_region),
+        new_TestFixture(test_add_region),
     };
 
     EMB_UNIT_TESTCALLER(tsrb_tests, NULL, tear_down, fixtures);
@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2026 agent
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for ztimer clocks with a timer wheel
+ *
+ * @author      agent <agent@local>
+ */
+
+#include <stdbool.h>
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+#include "ztimer/wheel.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+#define TIMERS_NUMOF    (48U)
+#define OPS_NUMOF       (4000U)
+
+typedef struct {
+    ztimer_t timer;
+    uint32_t start;
+    uint32_t target;
+    bool armed;
+} _timer_t;
+
+static ztimer_mock_t _zmock;
+static ztimer_wheel_t _wheel;
+static _timer_t _timers[TIMERS_NUMOF];
+static unsigned _errors;
+static uint32_t _seed;
+
+static void cb_incr(void *arg)
+{
+    uint32_t *ptr = arg;
+    *ptr += 1;
+}
+
+static void _cb_check(void *arg)
+{
+    _timer_t *t = arg;
+
+    if (!t->armed || (ztimer_now(&_zmock.super) != t->target)) {
+        _errors++;
+    }
+    t->armed = false;
+}
+
+static uint32_t _rand(void)
+{
+    /* xorshift32, so the test is reproducible */
+    _seed ^= _seed << 13;
+    _seed ^= _seed >> 17;
+    _seed ^= _seed << 5;
+    return _seed;
+}
+
+static void _init(unsigned width)
+{
+    ztimer_mock_init(&_zmock, width);
+    ztimer_wheel_init(&_zmock.super, &_wheel);
+}
+
+/**
+ * @brief   Same as test_ztimer_mock_set32 on a clock with a wheel
+ */
+static void test_ztimer_wheel_set32(void)
+{
+    ztimer_clock_t *z = &_zmock.super;
+    uint32_t count = 0;
+    ztimer_t alarm = { .callback = cb_incr, .arg = &count, };
+
+    _init(32);
+    ztimer_set(z, &alarm, 1000);
+    ztimer_mock_advance(&_zmock,  999);   /* now =  999 */
+    TEST_ASSERT_EQUAL_INT(0, count);
+    ztimer_mock_advance(&_zmock,    1);   /* now = 1000 */
+    TEST_ASSERT_EQUAL_INT(1, count);
+    ztimer_mock_advance(&_zmock, 1001);   /* now = 2001 */
+    TEST_ASSERT_EQUAL_INT(1, count);
+    ztimer_set(z, &alarm, 3);
+    ztimer_mock_advance(&_zmock,  999);   /* now = 3000 */
+    TEST_ASSERT_EQUAL_INT(2, count);
+    ztimer_set(z, &alarm, 4000001000ul);
+    ztimer_mock_advance(&_zmock, 1000);   /* now = 4000 */
+    TEST_ASSERT_EQUAL_INT(2, count);
+    ztimer_mock_advance(&_zmock, 4000000000ul); /* now = 4000004000 */
+    TEST_ASSERT_EQUAL_INT(4000004000ul, ztimer_now(z));
+    TEST_ASSERT_EQUAL_INT(3, count);
+    ztimer_set(z, &alarm, 15);
+    ztimer_mock_advance(&_zmock,  14);
+    ztimer_remove(z, &alarm);
+    ztimer_mock_advance(&_zmock, 1000);
+    TEST_ASSERT_EQUAL_INT(3, count);
+    TEST_ASSERT_EQUAL_INT(0, _wheel.numof);
+}
+
+/**
+ * @brief   Timers with the same target all fire, also when the clock
+ *          wraps around
+ */
+static void test_ztimer_wheel_same_target(void)
+{
+    ztimer_clock_t *z = &_zmock.super;
+    uint32_t count = 0;
+    ztimer_t alarms[4];
+
+    _init(32);
+    ztimer_mock_jump(&_zmock, UINT32_MAX - 100);
+    for (unsigned i = 0; i < ARRAY_SIZE(alarms); i++) {
+        alarms[i] = (ztimer_t){ .callback = cb_incr, .arg = &count };
+        ztimer_set(z, &alarms[i], 200);
+    }
+    ztimer_mock_advance(&_zmock, 199);
+    TEST_ASSERT_EQUAL_INT(0, count);
+    ztimer_mock_advance(&_zmock, 1);
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(alarms), count);
+    TEST_ASSERT_EQUAL_INT(99, ztimer_now(z));
+}
+
+/**
+ * @brief   A timer more than 2^31 ticks ahead on an extended clock fires
+ *          neither early nor late
+ */
+static void test_ztimer_wheel_extend_long(void)
+{
+    ztimer_clock_t *z = &_zmock.super;
+    uint32_t count = 0;
+    ztimer_t alarm = { .callback = cb_incr, .arg = &count, };
+
+    _init(16);
+    ztimer_mock_jump(&_zmock, 0x1234);
+    ztimer_set(z, &alarm, 3200000000ul);
+    ztimer_mock_advance(&_zmock, 3199999999ul);
+    TEST_ASSERT_EQUAL_INT(0, count);
+    ztimer_mock_advance(&_zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, count);
+    TEST_ASSERT_EQUAL_INT(0, _wheel.numof);
+}
+
+/**
+ * @brief   Random sets, removes and clock advances, checking that every timer
+ *          fires exactly at its target time
+ */
+static void _random_ops(unsigned width, uint32_t start)
+{
+    ztimer_clock_t *z = &_zmock.super;
+
+    _init(width);
+    _errors = 0;
+    _seed = 0x12345678;
+    ztimer_mock_jump(&_zmock, start);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        _timers[i] = (_timer_t){
+            .timer = { .callback = _cb_check, .arg = &_timers[i] },
+        };
+    }
+    for (unsigned op = 0; op < OPS_NUMOF; op++) {
+        _timer_t *t = &_timers[_rand() % TIMERS_NUMOF];
+        /* spread the timeouts over all levels of the wheel */
+        uint32_t val = _rand() >> (_rand() % 32);
+
+        switch (_rand() % 4) {
+        case 0:
+        case 1:
+            t->start = ztimer_now(z);
+            t->target = t->start + val;
+            t->armed = true;
+            ztimer_set(z, &t->timer, val);
+            break;
+        case 2:
+            t->armed = false;
+            ztimer_remove(z, &t->timer);
+            break;
+        default:
+            ztimer_mock_advance(&_zmock, val >> 8);
+            break;
+        }
+    }
+    /* no timer must have been missed, timers set to 0 last only fire when
+     * the mock is advanced next */
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        if (_timers[i].armed) {
+            TEST_ASSERT((ztimer_now(z) - _timers[i].start) <=
+                        (_timers[i].target - _timers[i].start));
+            ztimer_remove(z, &_timers[i].timer);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(0, _errors);
+    TEST_ASSERT_EQUAL_INT(0, _wheel.numof);
+}
+
+static void test_ztimer_wheel_random32(void)
+{
+    _random_ops(32, UINT32_MAX - 0x1000000);
+}
+
+static void test_ztimer_wheel_random16(void)
+{
+    /* extended clock */
+    _random_ops(16, 0);
+}
+
+Test *tests_ztimer_wheel_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_wheel_set32),
+        new_TestFixture(test_ztimer_wheel_same_target),
+        new_TestFixture(test_ztimer_wheel_extend_long),
+        new_TestFixture(test_ztimer_wheel_random32),
+        new_TestFixture(test_ztimer_wheel_random16),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_tests;
+}
+
+/** @} */